@@ -0,0 +1,44 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file convert.cpp
+/// \brief benchmarks of the colour conversion operators
+
+#include "include/benchmark.hpp"
+
+using namespace visioncpp;
+
+/// \brief the operators of include/operators/convert
+struct Convert {
+  template <size_t C, size_t R>
+  static void run(bench::Suite &s) {
+    bench::point<OP_BGRToRGB, pixel::U8C3, C, R>(s);
+    bench::point<OP_RGBToBGR, pixel::U8C3, C, R>(s);
+    bench::point<OP_U8C3ToF32C3, pixel::U8C3, C, R>(s);
+    bench::point<OP_F32C3ToU8C3, pixel::F32C3, C, R>(s);
+    bench::point<OP_RGBToHSV, pixel::F32C3, C, R>(s);
+    bench::point<OP_HSVToRGB, pixel::F32C3, C, R>(s);
+    bench::point<OP_HSVToU8C3, pixel::F32C3, C, R>(s);
+    bench::point<OP_RGBToGREY, pixel::F32C3, C, R>(s);
+  }
+};
+
+int main(int argc, char **argv) {
+  return bench::run_all<Convert>("convert", argc, argv);
+}
@@ -0,0 +1,43 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file convolution.cpp
+/// \brief benchmarks of the convolution operators
+
+#include "include/benchmark.hpp"
+
+using namespace visioncpp;
+
+/// \brief the operators of include/operators/convolution
+struct Convolution {
+  template <size_t C, size_t R>
+  static void run(bench::Suite &s) {
+    bench::filter<OP_Filter2D, 3, 3, pixel::F32C3, C, R>(s);
+    bench::filter<OP_Filter2D_One, 3, 3, float, C, R>(s);
+    bench::filter<OP_SepFilterRow, 1, 3, float, C, R>(s);
+    bench::filter<OP_SepFilterCol, 3, 1, float, C, R>(s);
+    bench::neighbour<OP_GaussianBlur3x3, 1, 1, 1, 1, pixel::F32C3, C, R>(s);
+    bench::neighbour<OP_SepGaussRow3, 1, 0, 1, 0, float, C, R>(s);
+    bench::neighbour<OP_SepGaussCol3, 0, 1, 0, 1, float, C, R>(s);
+  }
+};
+
+int main(int argc, char **argv) {
+  return bench::run_all<Convolution>("convolution", argc, argv);
+}
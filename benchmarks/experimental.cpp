@@ -0,0 +1,59 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file experimental.cpp
+/// \brief benchmarks of the experimental operators and of the operators at
+/// the root of include/operators
+
+#include "include/benchmark.hpp"
+
+using namespace visioncpp;
+
+/// \brief the operators of include/operators/experimental. OP_Median is not
+/// run: its result type is the type of the neighbourhood, so it cannot be
+/// instantiated by neighbour_operation.
+struct Experimental {
+  template <size_t C, size_t R>
+  static void run(bench::Suite &s) {
+    bench::point2<OP_Add, float, float, C, R>(s);
+    bench::point2<OP_Sub, float, float, C, R>(s);
+    bench::point2<OP_AbsSub, float, float, C, R>(s);
+    bench::point2<OP_Mul, float, float, C, R>(s);
+    bench::point2<OP_Div, float, float, C, R>(s);
+    bench::point2<OP_Merge2Chns, float, float, C, R>(s);
+    bench::point_const<OP_Scale, float, C, R>(s, 2.0f);
+    bench::point_const<OP_Thresh, float, C, R>(s, 0.5f);
+    bench::point<OP_PowerOf2, float, C, R>(s);
+    bench::point<OP_FloatToF32C3, float, C, R>(s);
+    bench::point<OP_FloatToU8C1, float, C, R>(s);
+    bench::point<OP_FloatToUChar, float, C, R>(s);
+    bench::point<OP_U8C1ToFloat, pixel::U8C1, C, R>(s);
+    bench::neighbour<OP_AniDiff_Grey, 1, 1, 1, 1, float, C, R>(s);
+    bench::neighbour<OP_AniDiff, 1, 1, 1, 1, pixel::F32C3, C, R>(s);
+    // operators at the root of include/operators
+    bench::fill<OP_Broadcast, C, R>(s, 1.0f);
+    bench::point_const<OP_ScaleChannelZero, pixel::F32C3, C, R>(s, 0.5f);
+    bench::point_const<OP_ScaleChannelOne, pixel::F32C3, C, R>(s, 0.5f);
+    bench::point_const<OP_ScaleChannelTwo, pixel::F32C3, C, R>(s, 0.5f);
+  }
+};
+
+int main(int argc, char **argv) {
+  return bench::run_all<Experimental>("experimental", argc, argv);
+}
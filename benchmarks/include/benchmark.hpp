@@ -0,0 +1,364 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file benchmark.hpp
+/// \brief This file contains the harness of the operator benchmarks. Each
+/// benchmark builds a one-operator expression on synthetic images, runs it
+/// with several policies and local memory / work-group sizes, and reports the
+/// throughput in Mpix/s, the effective memory bandwidth and the variance of
+/// the run time. The results are printed and written as JSON, so they can be
+/// compared between two builds.
+
+#ifndef VISIONCPP_BENCHMARKS_INCLUDE_BENCHMARK_HPP_
+#define VISIONCPP_BENCHMARKS_INCLUDE_BENCHMARK_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// the display utilities of visioncpp.hpp are not included, so that the
+// benchmarks run headless
+#include <CL/sycl.hpp>
+#include "pixel/pixel.hpp"
+#include "operators/ops.hpp"
+#include "framework/framework.hpp"
+
+// the backend and device of the benchmarks can be chosen when building them
+#ifndef VISIONCPP_BENCH_BACKEND
+#define VISIONCPP_BENCH_BACKEND sycl
+#endif
+#ifndef VISIONCPP_BENCH_DEVICE
+#define VISIONCPP_BENCH_DEVICE cpu
+#endif
+
+namespace bench {
+/// the device used by all the benchmarks
+using Device =
+    visioncpp::internal::Device_<visioncpp::backend::VISIONCPP_BENCH_BACKEND,
+                                 visioncpp::device::VISIONCPP_BENCH_DEVICE>;
+
+/// the local memory and work-group sizes each operator is run with
+using Configs =
+    visioncpp::TuneConfigs<visioncpp::TuneConfig<8, 8, 8, 8>,
+                           visioncpp::TuneConfig<16, 16, 16, 16>,
+                           visioncpp::TuneConfig<32, 8, 32, 8>>;
+
+/// \brief the result of one operator run with one policy and configuration
+struct Result {
+  std::string op;
+  std::string resolution;
+  size_t cols;
+  size_t rows;
+  std::string policy;
+  std::string config;
+  /// the time of each run, in seconds
+  std::vector<double> times;
+  /// the bytes read and written by one run
+  size_t bytes;
+
+  double mean() const {
+    double s = 0;
+    for (auto t : times) s += t;
+    return s / times.size();
+  }
+  double stddev() const {
+    double m = mean(), s = 0;
+    for (auto t : times) s += (t - m) * (t - m);
+    return times.size() > 1 ? std::sqrt(s / (times.size() - 1)) : 0;
+  }
+  double min() const { return *std::min_element(times.begin(), times.end()); }
+  double mpix() const { return cols * rows / mean() * 1e-6; }
+  double gbps() const { return bytes / mean() * 1e-9; }
+};
+
+/// \brief fills a host image with deterministic pseudo random values. Integer
+/// channels cover their whole range and float channels are in [0, 1].
+template <typename T>
+std::vector<T> synthetic(size_t n, unsigned seed = 1) {
+  std::vector<T> v(n);
+  unsigned state = seed * 2654435761u + 1;
+  for (auto &x : v) {
+    state = state * 1664525u + 1013904223u;
+    unsigned r = state >> 8;
+    x = std::is_floating_point<T>::value
+            ? static_cast<T>((r & 0xffff) / 65535.0)
+            : static_cast<T>(r);
+  }
+  return v;
+}
+
+/// \class Suite
+/// \brief Suite runs the operators and collects their results. The command
+/// line options are:
+///   --json FILE   the JSON file receiving the results (default
+///                 bench_<name>.json)
+///   --repeat N    the number of timed runs of each case (default 10)
+///   --only TEXT   only runs the operators whose name contains TEXT
+class Suite {
+ private:
+  std::string name;
+  std::string json;
+  std::string only;
+  size_t repeat;
+  std::vector<Result> results;
+  std::string resolution;
+
+ public:
+  Device dev;
+
+  Suite(const std::string &n, int argc, char **argv)
+      : name(n), json("bench_" + n + ".json"), repeat(10) {
+    for (int i = 1; i + 1 < argc; i += 2) {
+      if (!std::strcmp(argv[i], "--json")) {
+        json = argv[i + 1];
+      } else if (!std::strcmp(argv[i], "--repeat")) {
+        repeat = std::max(1, std::atoi(argv[i + 1]));
+      } else if (!std::strcmp(argv[i], "--only")) {
+        only = argv[i + 1];
+      }
+    }
+  }
+
+  /// \brief sets the name of the resolution of the next cases
+  void set_resolution(const std::string &r) { resolution = r; }
+
+  /// \brief returns whether the operator is selected by --only
+  bool selected(const std::string &op) const {
+    return only.empty() || op.find(only) != std::string::npos;
+  }
+
+  /// \brief runs the expression, whose root is an assign, with every policy
+  /// and configuration
+  /// \param op: the name of the operator
+  /// \param expr: the expression
+  /// \param bytes: the bytes read and written by one run
+  template <typename Expr>
+  void measure(const std::string &op, Expr expr, size_t bytes) {
+    policy<visioncpp::policy::Fuse>(op, "Fuse", expr, bytes);
+    policy<visioncpp::policy::NoFuse>(op, "NoFuse", expr, bytes);
+  }
+
+  /// \brief prints the results and writes the JSON file
+  /// \return int: the exit code of the benchmark
+  int finish() {
+    std::ofstream os(json);
+    os << "{\"benchmark\":\"" << name << "\",\"device\":\"" << dev.name()
+       << "\",\"repeat\":" << repeat << ",\"results\":[";
+    char line[512];
+    for (size_t i = 0; i < results.size(); i++) {
+      const auto &r = results[i];
+      std::snprintf(line, sizeof(line),
+                    "%s\n{\"operator\":\"%s\",\"resolution\":\"%s\","
+                    "\"cols\":%zu,\"rows\":%zu,\"policy\":\"%s\","
+                    "\"config\":\"%s\",\"mean_ms\":%.4f,\"stddev_ms\":%.4f,"
+                    "\"min_ms\":%.4f,\"mpix_per_s\":%.2f,\"gb_per_s\":%.3f}",
+                    i ? "," : "", r.op.c_str(), r.resolution.c_str(), r.cols,
+                    r.rows, r.policy.c_str(), r.config.c_str(),
+                    r.mean() * 1e3, r.stddev() * 1e3, r.min() * 1e3, r.mpix(),
+                    r.gbps());
+      os << line;
+    }
+    os << "\n]}\n";
+    std::cout << results.size() << " results written to " << json
+              << std::endl;
+    return os ? 0 : 1;
+  }
+
+ private:
+  /// runs one policy with every configuration
+  template <visioncpp::policy::PolicyType P, typename Expr>
+  void policy(const std::string &op, const char *plc, Expr &expr,
+              size_t bytes) {
+    using Dispatch = visioncpp::internal::TuneDispatch<P, Configs>;
+    for (size_t c = 0; c < Dispatch::Size; c++) {
+      Result r{op, resolution, Expr::Type::Cols, Expr::Type::Rows, plc,
+               Dispatch::config(c), {}, bytes};
+      /// the first run, which creates the kernels and memories, is not timed
+      Dispatch::time(c, expr, dev,
+                     visioncpp::internal::TuneExtent{false, Expr::Type::Cols,
+                                                     Expr::Type::Rows},
+                     repeat, &r.times);
+      std::printf("%-28s %-6s %-7s %-12s %9.3f ms  +-%6.3f  %9.1f Mpix/s"
+                  "  %7.2f GB/s\n",
+                  op.c_str(), resolution.c_str(), plc, r.config.c_str(),
+                  r.mean() * 1e3, r.stddev() * 1e3, r.mpix(), r.gbps());
+      results.push_back(std::move(r));
+    }
+  }
+};
+
+/// \brief the host storage of an image of pixel type T
+template <typename T>
+struct Host {
+  using Scalar =
+      typename visioncpp::internal::MemoryProperties<T>::ChannelType;
+  static constexpr size_t Channels =
+      visioncpp::internal::MemoryProperties<T>::ChannelSize;
+  /// the bytes of a Cols x Rows image
+  static constexpr size_t bytes(size_t cols, size_t rows) {
+    return cols * rows * Channels * sizeof(Scalar);
+  }
+};
+
+/// \brief assigns the node to an output image and measures it
+/// \param in_bytes: the bytes read from the input images
+template <typename Node>
+void run_node(Suite &s, Node node, const std::string &op, size_t in_bytes) {
+  using Out = typename Node::OutType;
+  constexpr size_t Cols = Node::Type::Cols, Rows = Node::Type::Rows;
+  std::vector<typename Host<Out>::Scalar> out(Cols * Rows *
+                                              Host<Out>::Channels);
+  auto out_node =
+      visioncpp::terminal<Out, Cols, Rows, visioncpp::memory_type::Buffer2D>(
+          out.data());
+  s.measure(op, visioncpp::assign(out_node, node),
+            in_bytes + Host<Out>::bytes(Cols, Rows));
+}
+
+/// \brief creates an input image with synthetic content
+template <typename T, size_t Cols, size_t Rows>
+std::vector<typename Host<T>::Scalar> input(unsigned seed = 1) {
+  return synthetic<typename Host<T>::Scalar>(Cols * Rows * Host<T>::Channels,
+                                             seed);
+}
+
+/// \brief benchmarks a unary point operation
+template <typename OP, typename In, size_t Cols, size_t Rows>
+void point(Suite &s) {
+  auto op = visioncpp::internal::type_name<OP>();
+  if (!s.selected(op)) return;
+  auto data = input<In, Cols, Rows>();
+  auto in = visioncpp::terminal<In, Cols, Rows,
+                                visioncpp::memory_type::Buffer2D>(data.data());
+  run_node(s, visioncpp::point_operation<OP>(in), op,
+           Host<In>::bytes(Cols, Rows));
+}
+
+/// \brief benchmarks a binary point operation on two images
+template <typename OP, typename In1, typename In2, size_t Cols, size_t Rows>
+void point2(Suite &s) {
+  auto op = visioncpp::internal::type_name<OP>();
+  if (!s.selected(op)) return;
+  auto data1 = input<In1, Cols, Rows>(1);
+  auto data2 = input<In2, Cols, Rows>(2);
+  auto in1 =
+      visioncpp::terminal<In1, Cols, Rows, visioncpp::memory_type::Buffer2D>(
+          data1.data());
+  auto in2 =
+      visioncpp::terminal<In2, Cols, Rows, visioncpp::memory_type::Buffer2D>(
+          data2.data());
+  run_node(s, visioncpp::point_operation<OP>(in1, in2), op,
+           Host<In1>::bytes(Cols, Rows) + Host<In2>::bytes(Cols, Rows));
+}
+
+/// \brief benchmarks a binary point operation on an image and a constant
+template <typename OP, typename In, size_t Cols, size_t Rows>
+void point_const(Suite &s, float value) {
+  auto op = visioncpp::internal::type_name<OP>();
+  if (!s.selected(op)) return;
+  auto data = input<In, Cols, Rows>();
+  auto in = visioncpp::terminal<In, Cols, Rows,
+                                visioncpp::memory_type::Buffer2D>(data.data());
+  auto k = visioncpp::terminal<float, visioncpp::memory_type::Const>(value);
+  run_node(s, visioncpp::point_operation<OP>(in, k), op,
+           Host<In>::bytes(Cols, Rows));
+}
+
+/// \brief benchmarks a unary operation broadcasting a constant to an image
+template <typename OP, size_t Cols, size_t Rows>
+void fill(Suite &s, float value) {
+  auto op = visioncpp::internal::type_name<OP>();
+  if (!s.selected(op)) return;
+  auto k = visioncpp::terminal<float, visioncpp::memory_type::Const>(value);
+  run_node(s, visioncpp::point_operation<OP, Cols, Rows,
+                                         visioncpp::memory_type::Buffer2D>(k),
+           op, 0);
+}
+
+/// \brief benchmarks a neighbour operation without filter
+template <typename OP, size_t Halo_T, size_t Halo_L, size_t Halo_B,
+          size_t Halo_R, typename In, size_t Cols, size_t Rows>
+void neighbour(Suite &s) {
+  auto op = visioncpp::internal::type_name<OP>();
+  if (!s.selected(op)) return;
+  auto data = input<In, Cols, Rows>();
+  auto in = visioncpp::terminal<In, Cols, Rows,
+                                visioncpp::memory_type::Buffer2D>(data.data());
+  run_node(s,
+           visioncpp::neighbour_operation<OP, Halo_T, Halo_L, Halo_B, Halo_R>(
+               in),
+           op, Host<In>::bytes(Cols, Rows));
+}
+
+/// \brief benchmarks a neighbour operation with a FCols x FRows box filter
+template <typename OP, size_t FCols, size_t FRows, typename In, size_t Cols,
+          size_t Rows>
+void filter(Suite &s) {
+  auto op = visioncpp::internal::type_name<OP>();
+  if (!s.selected(op)) return;
+  auto data = input<In, Cols, Rows>();
+  std::vector<float> weights(FCols * FRows, 1.0f / (FCols * FRows));
+  auto in = visioncpp::terminal<In, Cols, Rows,
+                                visioncpp::memory_type::Buffer2D>(data.data());
+  auto fltr = visioncpp::terminal<float, FCols, FRows,
+                                  visioncpp::memory_type::Buffer2D,
+                                  visioncpp::scope::Constant>(weights.data());
+  run_node(s, visioncpp::neighbour_operation<OP>(in, fltr), op,
+           Host<In>::bytes(Cols, Rows));
+}
+
+/// \brief benchmarks a down-sampling operation halving the image
+template <typename OP, typename In, size_t Cols, size_t Rows>
+void downsample(Suite &s) {
+  auto op = visioncpp::internal::type_name<OP>();
+  if (!s.selected(op)) return;
+  auto data = input<In, Cols, Rows>();
+  auto in = visioncpp::terminal<In, Cols, Rows,
+                                visioncpp::memory_type::Buffer2D>(data.data());
+  run_node(s,
+           visioncpp::neighbour_operation<OP, Cols / 2, Rows / 2,
+                                          visioncpp::memory_type::Buffer2D>(
+               in),
+           op, Host<In>::bytes(Cols, Rows));
+}
+
+/// \brief runs the operators of Ops at VGA, 1080p and 4K and writes the
+/// results. Ops has a static template function run<Cols, Rows>(Suite &).
+/// \param name: the name of the benchmark
+/// \return int: the exit code of the benchmark
+template <typename Ops>
+int run_all(const std::string &name, int argc, char **argv) {
+  Suite s(name, argc, argv);
+  s.set_resolution("VGA");
+  Ops::template run<640, 480>(s);
+  s.set_resolution("1080p");
+  Ops::template run<1920, 1080>(s);
+  s.set_resolution("4K");
+  Ops::template run<3840, 2160>(s);
+  return s.finish();
+}
+}  // bench
+#endif  // VISIONCPP_BENCHMARKS_INCLUDE_BENCHMARK_HPP_
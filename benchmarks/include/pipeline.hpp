@@ -0,0 +1,318 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file pipeline.hpp
+/// \brief This file contains the harness of the pipeline benchmarks. Each
+/// benchmark runs one of the example pipelines on a sequence of synthetic or
+/// on-disk frames, without any display, with several policies and local
+/// memory / work-group sizes. It reports the frames per second and the
+/// percentiles of the latency of a frame, which includes the copy of the frame
+/// to the device and the copy of the result back to the host.
+
+#ifndef VISIONCPP_BENCHMARKS_INCLUDE_PIPELINE_HPP_
+#define VISIONCPP_BENCHMARKS_INCLUDE_PIPELINE_HPP_
+
+#include <functional>
+#include <stdexcept>
+
+#include "benchmark.hpp"
+
+namespace bench {
+/// the local memory and work-group sizes each pipeline is run with. They are
+/// also used for the kernel breaks scheduled by hand in the pipelines.
+using PipelineConfigs =
+    visioncpp::TuneConfigs<visioncpp::TuneConfig<16, 16, 16, 16>,
+                           visioncpp::TuneConfig<32, 32, 16, 16>>;
+
+/// \brief the latencies of the frames of one pipeline run with one policy and
+/// configuration
+struct Latency {
+  std::string pipeline;
+  size_t cols;
+  size_t rows;
+  std::string policy;
+  std::string config;
+  /// the time of each frame, in seconds
+  std::vector<double> times;
+
+  double total() const {
+    double s = 0;
+    for (auto t : times) s += t;
+    return s;
+  }
+  double fps() const { return times.size() / total(); }
+  double mean() const { return total() / times.size(); }
+  /// \brief returns the p-th percentile of the frame times (nearest rank)
+  double percentile(double p) const {
+    std::vector<double> sorted(times);
+    std::sort(sorted.begin(), sorted.end());
+    size_t rank = static_cast<size_t>(std::ceil(p / 100.0 * sorted.size()));
+    return sorted[rank > 0 ? rank - 1 : 0];
+  }
+};
+
+/// \class Frames
+/// \brief Frames produces the frames fed to a pipeline. The source image is
+/// either read from a binary PGM or PPM file, resized to the size of the
+/// pipeline, or made of synthetic blocks and noise. The frame i is the source
+/// moved i pixels to the left, so consecutive frames have a motion for the
+/// optical flow and two frames d apart are a stereo pair of disparity d.
+class Frames {
+ private:
+  size_t cols;
+  size_t rows;
+  /// the RGB source image
+  std::vector<unsigned char> rgb;
+
+  /// reads a binary PGM (P5) or PPM (P6) file with 8 bits per channel
+  static std::vector<unsigned char> load(const std::string &path,
+                                         size_t &cols, size_t &rows) {
+    std::ifstream in(path, std::ios::binary);
+    std::string magic;
+    size_t header[3];
+    in >> magic;
+    for (size_t i = 0; i < 3 && in; i++) {
+      while (in >> std::ws && in.peek() == '#') {
+        in.ignore(1 << 16, '\n');
+      }
+      in >> header[i];
+    }
+    in.get();
+    if (!in || (magic != "P5" && magic != "P6") || header[2] > 255) {
+      throw std::runtime_error("cannot read the 8 bits PGM or PPM " + path);
+    }
+    cols = header[0];
+    rows = header[1];
+    const size_t chns = magic == "P6" ? 3 : 1;
+    std::vector<unsigned char> data(cols * rows * chns);
+    in.read(reinterpret_cast<char *>(data.data()), data.size());
+    std::vector<unsigned char> out(cols * rows * 3);
+    for (size_t i = 0; i < cols * rows; i++) {
+      for (size_t c = 0; c < 3; c++) {
+        out[i * 3 + c] = data[i * chns + (chns == 3 ? c : 0)];
+      }
+    }
+    return out;
+  }
+
+ public:
+  /// \param c: the column size of the frames
+  /// \param r: the row size of the frames
+  /// \param path: the PGM or PPM file of the source image. A synthetic image
+  /// is used when it is empty.
+  Frames(size_t c, size_t r, const std::string &path)
+      : cols(c), rows(r), rgb(c * r * 3) {
+    if (path.empty()) {
+      auto noise = synthetic<unsigned char>(cols * rows * 3, 7);
+      for (size_t i = 0; i < rgb.size(); i++) {
+        size_t x = i / 3 % cols, y = i / 3 / cols;
+        rgb[i] = ((x / 16 + y / 16) % 2) * 160 + noise[i] % 64;
+      }
+      return;
+    }
+    size_t srcCols, srcRows;
+    auto src = load(path, srcCols, srcRows);
+    for (size_t y = 0; y < rows; y++) {
+      for (size_t x = 0; x < cols; x++) {
+        size_t sx = x * srcCols / cols, sy = y * srcRows / rows;
+        for (size_t c = 0; c < 3; c++) {
+          rgb[(y * cols + x) * 3 + c] = src[(sy * srcCols + sx) * 3 + c];
+        }
+      }
+    }
+  }
+
+  /// \brief writes the frame index with chns channels (1 or 3) to out
+  void get(size_t index, size_t chns, unsigned char *out) const {
+    for (size_t y = 0; y < rows; y++) {
+      for (size_t x = 0; x < cols; x++) {
+        const unsigned char *p = &rgb[(y * cols + (x + index) % cols) * 3];
+        if (chns == 3) {
+          std::memcpy(out + (y * cols + x) * 3, p, 3);
+        } else {
+          out[y * cols + x] = (p[0] + p[1] + p[2]) / 3;
+        }
+      }
+    }
+  }
+};
+
+/// \class PipelineSuite
+/// \brief PipelineSuite runs the pipelines and collects their latencies. The
+/// command line options are:
+///   --json FILE     the JSON file receiving the results (default
+///                   bench_<name>.json)
+///   --frames N      the number of timed frames of each case (default 100)
+///   --warmup N      the number of frames run before the timed ones (default
+///                   2)
+///   --input FILE    a PGM or PPM image used as source of the frames instead
+///                   of the synthetic one
+///   --only TEXT     only runs the pipelines whose name contains TEXT
+///   --policy NAME   only runs the policy NAME (Fuse, NoFuse or Auto)
+class PipelineSuite {
+ private:
+  std::string name;
+  std::string json;
+  std::string only;
+  std::string plc;
+  size_t warmup;
+  std::vector<Latency> results;
+
+ public:
+  Device dev;
+  size_t frames;
+  std::string input;
+
+  PipelineSuite(const std::string &n, int argc, char **argv)
+      : name(n), json("bench_" + n + ".json"), warmup(2), frames(100) {
+    for (int i = 1; i + 1 < argc; i += 2) {
+      if (!std::strcmp(argv[i], "--json")) {
+        json = argv[i + 1];
+      } else if (!std::strcmp(argv[i], "--frames")) {
+        frames = std::max(1, std::atoi(argv[i + 1]));
+      } else if (!std::strcmp(argv[i], "--warmup")) {
+        warmup = std::max(0, std::atoi(argv[i + 1]));
+      } else if (!std::strcmp(argv[i], "--input")) {
+        input = argv[i + 1];
+      } else if (!std::strcmp(argv[i], "--only")) {
+        only = argv[i + 1];
+      } else if (!std::strcmp(argv[i], "--policy")) {
+        plc = argv[i + 1];
+      }
+    }
+  }
+
+  /// \brief returns whether the pipeline and policy are selected
+  bool selected(const std::string &pipeline, const std::string &policy) const {
+    return (only.empty() || pipeline.find(only) != std::string::npos) &&
+           (plc.empty() || policy == plc);
+  }
+
+  /// \brief runs the frames of one case. The prepare function, which fills
+  /// the host memories of the frame, is not timed; the step function, which
+  /// copies the frame in, runs the pipeline and copies the result out, is.
+  /// \return the time of each timed frame, in seconds
+  std::vector<double> time(const std::function<void(size_t)> &prepare,
+                           const std::function<void()> &step) {
+    std::vector<double> times;
+    for (size_t i = 0; i < warmup + frames; i++) {
+      prepare(i);
+      auto begin = visioncpp::internal::tools::get_current_time();
+      step();
+      double t = visioncpp::internal::tools::get_elapse_time(
+          begin, visioncpp::internal::tools::get_current_time());
+      if (i >= warmup) {
+        times.push_back(t);
+      }
+    }
+    return times;
+  }
+
+  /// \brief records the latencies of one case
+  void record(Latency r) {
+    std::printf("%-24s %4zux%-4zu %-7s %-12s %8.1f fps  p50 %8.3f ms"
+                "  p95 %8.3f ms  p99 %8.3f ms\n",
+                r.pipeline.c_str(), r.cols, r.rows, r.policy.c_str(),
+                r.config.c_str(), r.fps(), r.percentile(50) * 1e3,
+                r.percentile(95) * 1e3, r.percentile(99) * 1e3);
+    results.push_back(std::move(r));
+  }
+
+  /// \brief prints the number of results and writes the JSON file
+  /// \return int: the exit code of the benchmark
+  int finish() {
+    std::ofstream os(json);
+    os << "{\"benchmark\":\"" << name << "\",\"device\":\"" << dev.name()
+       << "\",\"frames\":" << frames << ",\"results\":[";
+    char line[512];
+    for (size_t i = 0; i < results.size(); i++) {
+      const auto &r = results[i];
+      std::snprintf(line, sizeof(line),
+                    "%s\n{\"pipeline\":\"%s\",\"cols\":%zu,\"rows\":%zu,"
+                    "\"policy\":\"%s\",\"config\":\"%s\",\"fps\":%.2f,"
+                    "\"mean_ms\":%.4f,\"p50_ms\":%.4f,\"p95_ms\":%.4f,"
+                    "\"p99_ms\":%.4f}",
+                    i ? "," : "", r.pipeline.c_str(), r.cols, r.rows,
+                    r.policy.c_str(), r.config.c_str(), r.fps(),
+                    r.mean() * 1e3, r.percentile(50) * 1e3,
+                    r.percentile(95) * 1e3, r.percentile(99) * 1e3);
+      os << line;
+    }
+    os << "\n]}\n";
+    std::cout << results.size() << " results written to " << json
+              << std::endl;
+    return os ? 0 : 1;
+  }
+};
+
+/// \struct PipelineConfigRun
+/// \brief runs a pipeline with one policy and each configuration of the list
+/// template parameters:
+/// \tparam Pipeline: a struct with the static members Cols, Rows and name(),
+/// and a static template function run<ExecPolicy, LC, LR, LCT, LRT> taking the
+/// suite and returning the times of the frames
+/// \tparam ExecPolicy: the policy the pipeline is run with
+/// \tparam Configs: the list of configurations
+template <typename Pipeline, visioncpp::policy::PolicyType ExecPolicy,
+          typename Configs>
+struct PipelineConfigRun;
+
+/// \brief specialisation of PipelineConfigRun for the end of the list
+template <typename Pipeline, visioncpp::policy::PolicyType ExecPolicy>
+struct PipelineConfigRun<Pipeline, ExecPolicy, visioncpp::TuneConfigs<>> {
+  static void run(PipelineSuite &, const char *) {}
+};
+
+/// \brief specialisation of PipelineConfigRun for the first configuration of
+/// the list
+template <typename Pipeline, visioncpp::policy::PolicyType ExecPolicy,
+          typename Config, typename... Configs>
+struct PipelineConfigRun<Pipeline, ExecPolicy,
+                         visioncpp::TuneConfigs<Config, Configs...>> {
+  static void run(PipelineSuite &s, const char *plc) {
+    s.record(Latency{
+        Pipeline::name(), Pipeline::Cols, Pipeline::Rows, plc,
+        visioncpp::internal::TuneDispatch<
+            ExecPolicy, visioncpp::TuneConfigs<Config>>::config(0),
+        Pipeline::template run<ExecPolicy, Config::LC, Config::LR,
+                               Config::LCT, Config::LRT>(s)});
+    PipelineConfigRun<Pipeline, ExecPolicy,
+                      visioncpp::TuneConfigs<Configs...>>::run(s, plc);
+  }
+};
+
+/// \brief runs the pipeline with the selected policies and every
+/// configuration
+template <typename Pipeline>
+void run_pipeline(PipelineSuite &s) {
+  if (s.selected(Pipeline::name(), "Fuse")) {
+    PipelineConfigRun<Pipeline, visioncpp::policy::Fuse,
+                      PipelineConfigs>::run(s, "Fuse");
+  }
+  if (s.selected(Pipeline::name(), "NoFuse")) {
+    PipelineConfigRun<Pipeline, visioncpp::policy::NoFuse,
+                      PipelineConfigs>::run(s, "NoFuse");
+  }
+  if (s.selected(Pipeline::name(), "Auto")) {
+    PipelineConfigRun<Pipeline, visioncpp::policy::Auto,
+                      PipelineConfigs>::run(s, "Auto");
+  }
+}
+}  // bench
+#endif  // VISIONCPP_BENCHMARKS_INCLUDE_PIPELINE_HPP_
@@ -0,0 +1,207 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file pipelines.cpp
+/// \brief end-to-end benchmarks of the pipelines of the examples
+
+#include "include/pipeline.hpp"
+
+#include "../examples/include/anisotropic_diffusion.hpp"
+#include "../examples/include/bayer_filter.hpp"
+#include "../examples/include/depth_map.hpp"
+#include "../examples/include/harris.hpp"
+#include "../examples/include/optical_flow_LK.hpp"
+#include "../examples/include/pyramid.hpp"
+
+using namespace visioncpp;
+
+/// \brief a device only terminal of a Cols x Rows image of pixel type T
+template <typename T, size_t Cols, size_t Rows>
+auto device_image()
+    -> decltype(terminal<T, Cols, Rows, memory_type::Buffer2D>()) {
+  return terminal<T, Cols, Rows, memory_type::Buffer2D>();
+}
+
+/// \brief the Harris Corner Detector on a colour frame. The pipeline is
+/// built once and each frame only copies the frame in, runs it and copies the
+/// result out.
+struct Harris {
+  static constexpr size_t Cols = 640, Rows = 480;
+  static const char *name() { return "harris"; }
+
+  /// the frame loop run on the pipeline
+  struct Loop {
+    bench::PipelineSuite &s;
+    std::vector<double> times;
+
+    template <typename Pipeline>
+    void operator()(Pipeline &pipeline) {
+      bench::Frames frames(Cols, Rows, s.input);
+      std::vector<unsigned char> frame(Cols * Rows * 3), result(Cols * Rows);
+      times = s.time([&](size_t i) { frames.get(i, 3, frame.data()); },
+                     [&]() {
+                       pipeline.input().reset_input(frame.data());
+                       pipeline.run();
+                       pipeline.read_output(result.data());
+                     });
+    }
+  };
+
+  template <policy::PolicyType P, size_t LC, size_t LR, size_t LCT,
+            size_t LRT>
+  static std::vector<double> run(bench::PipelineSuite &s) {
+    auto in = device_image<pixel::U8C3, Cols, Rows>();
+    auto out = device_image<pixel::U8C1, Cols, Rows>();
+    Loop loop{s, {}};
+    harris::build<P, LC, LR, LCT, LRT>(in, out, s.dev, loop);
+    return loop.times;
+  }
+};
+
+/// \brief the Lucas-Kanade Optical Flow between two consecutive frames
+struct OpticalFlowLK {
+  static constexpr size_t Cols = 640, Rows = 480;
+  static const char *name() { return "optical_flow_LK"; }
+  template <policy::PolicyType P, size_t LC, size_t LR, size_t LCT,
+            size_t LRT>
+  static std::vector<double> run(bench::PipelineSuite &s) {
+    bench::Frames frames(Cols, Rows, s.input);
+    std::vector<unsigned char> previous(Cols * Rows * 3),
+        current(Cols * Rows * 3), result(Cols * Rows * 3);
+    auto prev = device_image<pixel::U8C3, Cols, Rows>();
+    auto in = device_image<pixel::U8C3, Cols, Rows>();
+    auto out = device_image<pixel::U8C3, Cols, Rows>();
+    return s.time(
+        [&](size_t i) {
+          frames.get(i, 3, previous.data());
+          frames.get(i + 1, 3, current.data());
+        },
+        [&]() {
+          prev.reset_input(previous.data());
+          in.reset_input(current.data());
+          optical_flow_LK::run<P, LC, LR, LCT, LRT>(in, prev, out, s.dev);
+          out.read_output(result.data());
+        });
+  }
+};
+
+/// \brief the Simplified Anisotropic Diffusion with its 15 iterations
+struct AnisotropicDiffusion {
+  static constexpr size_t Cols = 640, Rows = 480;
+  static const char *name() { return "anisotropic_diffusion"; }
+  template <policy::PolicyType P, size_t LC, size_t LR, size_t LCT,
+            size_t LRT>
+  static std::vector<double> run(bench::PipelineSuite &s) {
+    bench::Frames frames(Cols, Rows, s.input);
+    std::vector<unsigned char> frame(Cols * Rows * 3),
+        result(Cols * Rows * 3);
+    auto in = device_image<pixel::U8C3, Cols, Rows>();
+    auto tmp = device_image<pixel::F32C3, Cols, Rows>();
+    auto out = device_image<pixel::U8C3, Cols, Rows>();
+    return s.time([&](size_t i) { frames.get(i, 3, frame.data()); },
+                  [&]() {
+                    in.reset_input(frame.data());
+                    anisotropic_diffusion::run<P, LC, LR, LCT, LRT>(
+                        in, tmp, out, s.dev);
+                    out.read_output(result.data());
+                  });
+  }
+};
+
+/// \brief the two level Pyramid with the HSV and grey scale conversions
+struct Pyramid {
+  static constexpr size_t Cols = 640, Rows = 480;
+  static const char *name() { return "pyramid"; }
+  template <policy::PolicyType P, size_t LC, size_t LR, size_t LCT,
+            size_t LRT>
+  static std::vector<double> run(bench::PipelineSuite &s) {
+    bench::Frames frames(Cols, Rows, s.input);
+    std::vector<unsigned char> frame(Cols * Rows * 3),
+        lvl1(Cols / 2 * Rows / 2 * 3), lvl2(Cols / 4 * Rows / 4);
+    auto in = device_image<pixel::U8C3, Cols, Rows>();
+    auto out1 = device_image<pixel::U8C3, Cols / 2, Rows / 2>();
+    auto out2 = device_image<pixel::U8C1, Cols / 4, Rows / 4>();
+    return s.time([&](size_t i) { frames.get(i, 3, frame.data()); },
+                  [&]() {
+                    in.reset_input(frame.data());
+                    pyramid::run<P, LC, LR, LCT, LRT>(in, out1, out2, s.dev);
+                    out1.read_output(lvl1.data());
+                    out2.read_output(lvl2.data());
+                  });
+  }
+};
+
+/// \brief the Bayer Filter demosaic of a 720p raw frame
+struct BayerFilter {
+  static constexpr size_t Cols = 1280, Rows = 720;
+  static const char *name() { return "bayer_filter"; }
+  template <policy::PolicyType P, size_t LC, size_t LR, size_t LCT,
+            size_t LRT>
+  static std::vector<double> run(bench::PipelineSuite &s) {
+    bench::Frames frames(Cols, Rows, s.input);
+    std::vector<unsigned char> frame(Cols * Rows), result(Cols * Rows * 3);
+    auto in = device_image<pixel::U8C1, Cols, Rows>();
+    auto out = device_image<pixel::U8C3, Cols, Rows>();
+    return s.time([&](size_t i) { frames.get(i, 1, frame.data()); },
+                  [&]() {
+                    in.reset_input(frame.data());
+                    bayer_filter::run<P, LC, LR, LCT, LRT>(in, out, s.dev);
+                    out.read_output(result.data());
+                  });
+  }
+};
+
+/// \brief the Depth Map of a stereo pair with a disparity of 8 pixels
+struct DepthMap {
+  static constexpr size_t Cols = 640, Rows = 480;
+  static constexpr size_t Disparity = 8;
+  static const char *name() { return "depth_map"; }
+  template <policy::PolicyType P, size_t LC, size_t LR, size_t LCT,
+            size_t LRT>
+  static std::vector<double> run(bench::PipelineSuite &s) {
+    bench::Frames frames(Cols, Rows, s.input);
+    std::vector<unsigned char> left(Cols * Rows), right(Cols * Rows),
+        result(Cols * Rows);
+    auto in_l = device_image<pixel::U8C1, Cols, Rows>();
+    auto in_r = device_image<pixel::U8C1, Cols, Rows>();
+    auto out = device_image<pixel::U8C1, Cols, Rows>();
+    return s.time(
+        [&](size_t i) {
+          frames.get(i, 1, left.data());
+          frames.get(i + Disparity, 1, right.data());
+        },
+        [&]() {
+          in_l.reset_input(left.data());
+          in_r.reset_input(right.data());
+          depth_map::run<P, LC, LR, LCT, LRT>(in_l, in_r, out, s.dev);
+          out.read_output(result.data());
+        });
+  }
+};
+
+int main(int argc, char **argv) {
+  bench::PipelineSuite s("pipelines", argc, argv);
+  bench::run_pipeline<Harris>(s);
+  bench::run_pipeline<OpticalFlowLK>(s);
+  bench::run_pipeline<AnisotropicDiffusion>(s);
+  bench::run_pipeline<Pyramid>(s);
+  bench::run_pipeline<BayerFilter>(s);
+  bench::run_pipeline<DepthMap>(s);
+  return s.finish();
+}
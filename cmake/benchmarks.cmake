@@ -0,0 +1,36 @@
+# include common configs
+include(common)
+
+project(visioncpp-Benchmarks CXX)
+set(CMAKE_RUNTIME_OUTPUT_DIRECTORY ${CMAKE_BINARY_DIR}/bin/benchmark)
+
+set(VISIONCPP_BENCH_BACKEND "sycl" CACHE STRING
+    "Backend of the benchmarks (sycl or threads)")
+set(VISIONCPP_BENCH_DEVICE "cpu" CACHE STRING
+    "Device of the benchmarks (cpu, gpu or host)")
+
+file(GLOB _srcs ${PROJECT_SOURCE_DIR}/benchmarks/*.cpp)
+set(_bench_runs "")
+# for each benchmark in folder
+foreach(_src ${_srcs})
+
+  # take name of file
+  get_filename_component(filename ${_src} NAME_WE)
+
+  add_executable(bench_${filename} ${_src})
+  target_compile_definitions(bench_${filename} PRIVATE
+    VISIONCPP_BENCH_BACKEND=${VISIONCPP_BENCH_BACKEND}
+    VISIONCPP_BENCH_DEVICE=${VISIONCPP_BENCH_DEVICE})
+  add_sycl_to_target(bench_${filename} ${_src} ${CMAKE_CURRENT_BINARY_DIR})
+
+  list(APPEND _bench_runs
+       COMMAND bench_${filename} --json
+               ${CMAKE_BINARY_DIR}/benchmarks/bench_${filename}.json)
+endforeach(_src ${_srcs})
+
+# runs all the benchmarks and writes their results in build/benchmarks
+add_custom_target(benchmark
+  COMMAND ${CMAKE_COMMAND} -E make_directory ${CMAKE_BINARY_DIR}/benchmarks
+  ${_bench_runs}
+  WORKING_DIRECTORY ${CMAKE_BINARY_DIR}
+  COMMENT "Running the operator benchmarks")
@@ -5,7 +5,7 @@ project(visioncpp-Tests CXX)
 set(CMAKE_RUNTIME_OUTPUT_DIRECTORY ${CMAKE_BINARY_DIR}/bin/test)
 enable_testing()
 
-add_custom_target(testgen COMMAND cd ${PROJECT_SOURCE_DIR}/tests/operators && ${PYTHON_EXECUTABLE} cc-gen.py)
+add_custom_target(testgen COMMAND cd ${PROJECT_SOURCE_DIR}/tests/operators && ${PYTHON_EXECUTABLE} cc-gen.py --builddir ${CMAKE_BINARY_DIR} --testdir ${PROJECT_SOURCE_DIR}/tests/operators)
 
 file(GLOB_RECURSE _srcs
     ${CMAKE_BINARY_DIR}/autogen/*/*.cpp
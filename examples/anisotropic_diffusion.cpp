@@ -36,48 +36,8 @@
 // include VisionCpp
 #include <visioncpp.hpp>
 
-// tunable parameters
-constexpr float k{15.0f};    // edge preserving parameter
-constexpr size_t iters{15};  // controls the blur
-
-// operator which implements the simplified anisotropic diffusion
-struct AniDiff {
-  template <typename T>
-  visioncpp::pixel::F32C3 operator()(T nbr) {
-    // init output pixel
-    cl::sycl::float4 out(0, 0, 0, 0);
-
-    // init sum variable, which is used to normalize
-    cl::sycl::float4 sum_w(0, 0, 0, 0);
-
-    // get center pixel
-    cl::sycl::float4 p1(nbr.at(nbr.I_c, nbr.I_r)[0],
-                        nbr.at(nbr.I_c, nbr.I_r)[1],
-                        nbr.at(nbr.I_c, nbr.I_r)[2], 0);
-
-    // iterate over a 3x3 neighbourhood
-    for (int i = -1; i <= 1; i++) {
-      for (int j = -1; j <= 1; j++) {
-        // get neighbour pixel
-        cl::sycl::float4 p2(nbr.at(nbr.I_c + i, nbr.I_r + j)[0],
-                            nbr.at(nbr.I_c + i, nbr.I_r + j)[1],
-                            nbr.at(nbr.I_c + i, nbr.I_r + j)[2], 0);
-
-        // computes the weight which basically is the difference between pixels
-        cl::sycl::float4 w = cl::sycl::exp((-k) * cl::sycl::fabs(p1 - p2));
-
-        // sum the weights for normalization
-        sum_w += w;
-
-        // store the output
-        out += w * p2;
-      }
-    }
-    // normalize output and return
-    out = out / sum_w;
-    return visioncpp::pixel::F32C3(out.x(), out.y(), out.z());
-  }
-};
+// include the Anisotropic Diffusion pipeline
+#include "include/anisotropic_diffusion.hpp"
 
 // main program
 int main(int argc, char **argv) {
@@ -115,28 +75,6 @@ int main(int argc, char **argv) {
   cv::Mat input;
   cv::Mat outImage(ROWS, COLS, CV_8UC(CHNS), output.get());
 
-  /*
-   This example contains a small expression tree
-   but it uses a device memory which stores a temporary computation.
-   So it is possible to create a loop during the computation
-   and the data is always in the device. It just comes to the host in the last
-   execute.
-
-   Below is the expression tree used for this example
-
-        (in_node)
-         |
-        (frgb)     [OP_U8C3ToF32C3] (convert uchar to float)
-         |
-   ---->(anidiff)  [AniDiff] (It iterates several times in the same node
-   |     |                    applying the anisotropic diffusion serveral times)
-   -------
-         |
-        (urgb)     [OP_F32C3ToU8C3] (convert float to uchar to display)
-
-
-  */
-
   for (;;) {
     // Starting building the tree (use  {} during the creation of the tree)
     {
@@ -163,37 +101,9 @@ int main(int argc, char **argv) {
           visioncpp::terminal<visioncpp::pixel::F32C3, COLS, ROWS,
                               visioncpp::memory_type::Buffer2D>();
 
-      // convert to float
-      auto frgb =
-          visioncpp::point_operation<visioncpp::OP_U8C3ToF32C3>(in_node);
-
-      // assign to temporary device memory
-      auto exec1 = visioncpp::assign(device_memory, frgb);
-
-      // apply anisotropic diffusion
-      auto anidiff =
-          visioncpp::neighbour_operation<AniDiff, 1, 1, 1, 1>(device_memory);
-
-      // assign to the temporary device memory
-      auto exec2 = visioncpp::assign(device_memory, anidiff);
-
-      // convert to uchar
-      auto urgb =
-          visioncpp::point_operation<visioncpp::OP_F32C3ToU8C3>(device_memory);
-
-      // assign to the host memory
-      auto exec3 = visioncpp::assign(out_node, urgb);
-
-      // execution (convert to float)
-      visioncpp::execute<visioncpp::policy::Fuse, 32, 32, 16, 16>(exec1, dev);
-
-      // apply anisotropic diffusion several times
-      for (int i = 0; i < iters; i++) {
-        visioncpp::execute<visioncpp::policy::Fuse, 32, 32, 16, 16>(exec2, dev);
-      }
-
-      // return image to host memory
-      visioncpp::execute<visioncpp::policy::Fuse, 32, 32, 16, 16>(exec3, dev);
+      // execute the pipeline
+      anisotropic_diffusion::run<visioncpp::policy::Fuse, 32, 32, 16, 16>(
+          in_node, device_memory, out_node, dev);
     }
 
     // display results
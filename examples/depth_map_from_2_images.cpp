@@ -36,70 +36,8 @@
 // include VisionCpp
 #include <visioncpp.hpp>
 
-// include limits to define infinity
-#include <limits>
-
-// Tunable parameters for the algorithm
-constexpr int blockSize = 11;
-constexpr int maxDisp = 25;
-
-constexpr int halfBlock = blockSize / 2;
-
-// Stereo block matching algorithm for depth map reconstruction
-struct Stereo_BMA {
-  // function that computers the sum of absolute difference of two blocks
-  float SAD(const float im1[blockSize * blockSize],
-            const float im2[blockSize * blockSize]) {
-    float r = 0;
-    for (size_t i = 0; i < blockSize * blockSize; i++) {
-      r += cl::sycl::fabs(im1[i] - im2[i]);
-    }
-    return r;
-  }
-
-  // Function to get block of size blockSize frin (c,r) pixel
-  template <typename T>
-  void getBlock(const T& I, const int& c, const int& r, const int& layer,
-                float block[blockSize * blockSize]) {
-    int cnt = 0;
-    for (int i2 = -halfBlock; i2 <= halfBlock; i2++) {
-      for (int j2 = -halfBlock; j2 <= halfBlock; j2++) {
-        block[cnt++] = I.at(c + i2, r + j2)[layer];
-      }
-    }
-  }
-
-  // function that computes the depth map
-  template <typename T>
-  visioncpp::pixel::U8C1 operator()(const T& I) {
-    // get block from left image
-    float block_l[blockSize * blockSize];
-    getBlock(I, I.I_c, I.I_r, 0, block_l);
-
-    // start with best sum of absolute difference equals to infinity
-    float bestSAD = std::numeric_limits<float>::infinity();
-    int bestJ = I.I_c;
-
-    // for loop to find best match
-    float block_r[blockSize * blockSize];
-    for (int m = 0; m < maxDisp; m++) {
-      // get block from right image
-      getBlock(I, I.I_c - m, I.I_r, 1, block_r);
-
-      // sum of absolute difference
-      float temp = SAD(block_l, block_r);
-
-      // store the smallest SAD
-      if (temp < bestSAD) {
-        bestSAD = temp;
-        bestJ = I.I_c - m;
-      }
-    }
-
-    // Compute disparity value
-    return visioncpp::pixel::U8C1(I.I_c - bestJ);
-  }
-};
+// include the Depth Map pipeline
+#include "include/depth_map.hpp"
 
 // main program
 int main(int argc, char** argv) {
@@ -154,31 +92,9 @@ int main(int argc, char** argv) {
         visioncpp::terminal<visioncpp::pixel::U8C1, COLS, ROWS,
                             visioncpp::memory_type::Buffer2D>(output.get());
 
-    // convert images to float
-    auto fgrey_l = visioncpp::point_operation<visioncpp::OP_U8C1ToFloat>(in_l);
-    auto fgrey_r = visioncpp::point_operation<visioncpp::OP_U8C1ToFloat>(in_r);
-
-    // merge images
-    auto merge =
-        visioncpp::point_operation<visioncpp::OP_Merge2Chns>(fgrey_l, fgrey_r);
-
-    // compute depth map
-    auto depth = visioncpp::neighbour_operation<
-        Stereo_BMA, halfBlock, halfBlock + maxDisp, halfBlock, halfBlock>(
-        merge);
-
-    // convert to unsigned char for displaying purposes
-    // scale threhold to display
-    auto scale_node = visioncpp::terminal<float, visioncpp::memory_type::Const>(
-        static_cast<float>(8.0f));
-    auto display =
-        visioncpp::point_operation<visioncpp::OP_Scale>(depth, scale_node);
-
-    // assign to the output
-    auto exec = visioncpp::assign(out, display);
-
-    // execute expression tree
-    visioncpp::execute<visioncpp::policy::Fuse, SM, SM, SM, SM>(exec, dev);
+    // execute the pipeline
+    depth_map::run<visioncpp::policy::Fuse, SM, SM, SM, SM>(in_l, in_r, out,
+                                                            dev);
   }
 
   // Display results
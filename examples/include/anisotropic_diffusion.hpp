@@ -0,0 +1,155 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file anisotropic_diffusion.hpp
+/// \brief This file contains the pipeline of the Simplified Anisotropic
+/// Diffusion example, shared by the example and the pipeline benchmarks.
+/// This technique removes noise from an image preserving the edges.
+/// \param k - the edge preserving parameter [the smaller is the k, less things
+///       are considered edges, the bigger, more things are considered as edges]
+/// \param iters - number of iterations [it controls how blurry the image will
+///        become, a higher number means a more blurry image]
+
+#ifndef VISIONCPP_EXAMPLES_INCLUDE_ANISOTROPIC_DIFFUSION_HPP_
+#define VISIONCPP_EXAMPLES_INCLUDE_ANISOTROPIC_DIFFUSION_HPP_
+
+#include <CL/sycl.hpp>
+#include "pixel/pixel.hpp"
+#include "operators/ops.hpp"
+#include "framework/framework.hpp"
+
+namespace anisotropic_diffusion {
+// tunable parameters
+constexpr float k{15.0f};    // edge preserving parameter
+constexpr size_t iters{15};  // controls the blur
+
+// operator which implements the simplified anisotropic diffusion
+struct AniDiff {
+  template <typename T>
+  visioncpp::pixel::F32C3 operator()(T nbr) {
+    // init output pixel
+    cl::sycl::float4 out(0, 0, 0, 0);
+
+    // init sum variable, which is used to normalize
+    cl::sycl::float4 sum_w(0, 0, 0, 0);
+
+    // get center pixel
+    cl::sycl::float4 p1(nbr.at(nbr.I_c, nbr.I_r)[0],
+                        nbr.at(nbr.I_c, nbr.I_r)[1],
+                        nbr.at(nbr.I_c, nbr.I_r)[2], 0);
+
+    // iterate over a 3x3 neighbourhood
+    for (int i = -1; i <= 1; i++) {
+      for (int j = -1; j <= 1; j++) {
+        // get neighbour pixel
+        cl::sycl::float4 p2(nbr.at(nbr.I_c + i, nbr.I_r + j)[0],
+                            nbr.at(nbr.I_c + i, nbr.I_r + j)[1],
+                            nbr.at(nbr.I_c + i, nbr.I_r + j)[2], 0);
+
+        // computes the weight which basically is the difference between pixels
+        cl::sycl::float4 w = cl::sycl::exp((-k) * cl::sycl::fabs(p1 - p2));
+
+        // sum the weights for normalization
+        sum_w += w;
+
+        // store the output
+        out += w * p2;
+      }
+    }
+    // normalize output and return
+    out = out / sum_w;
+    return visioncpp::pixel::F32C3(out.x(), out.y(), out.z());
+  }
+};
+
+/*
+ This pipeline contains a small expression tree
+ but it uses a device memory which stores a temporary computation.
+ So it is possible to create a loop during the computation
+ and the data is always in the device. It just comes to the host in the last
+ execute.
+
+ Below is the expression tree used for this pipeline
+
+      (in_node)
+       |
+      (frgb)     [OP_U8C3ToF32C3] (convert uchar to float)
+       |
+ ---->(anidiff)  [AniDiff] (It iterates several times in the same node
+ |     |                    applying the anisotropic diffusion serveral times)
+ -------
+       |
+      (urgb)     [OP_F32C3ToU8C3] (convert float to uchar to display)
+*/
+
+/// \brief builds the Simplified Anisotropic Diffusion on the frame of the
+/// in_node terminal and executes it, writing the result to the out_node
+/// terminal.
+/// template parameters:
+/// \tparam ExecPolicy: the policy of the execution
+/// \tparam LC: the column size for local memory
+/// \tparam LR: the row size for local memory
+/// \tparam LCT: the size of the workgroup column
+/// \tparam LRT: the size of the workgroup row
+/// function parameters:
+/// \param in_node: the U8C3 terminal holding the frame
+/// \param device_memory: the F32C3 device only terminal holding the
+/// temporary computation
+/// \param out_node: the U8C3 terminal receiving the result
+/// \param dev: the selected device for executing the pipeline
+/// \param n: the number of iterations
+/// \return void
+template <visioncpp::policy::PolicyType ExecPolicy, size_t LC, size_t LR,
+          size_t LCT, size_t LRT, typename In, typename Tmp, typename Out,
+          typename DeviceT>
+void run(In &in_node, Tmp &device_memory, Out &out_node, const DeviceT &dev,
+         size_t n = iters) {
+  // convert to float
+  auto frgb = visioncpp::point_operation<visioncpp::OP_U8C3ToF32C3>(in_node);
+
+  // assign to temporary device memory
+  auto exec1 = visioncpp::assign(device_memory, frgb);
+
+  // apply anisotropic diffusion
+  auto anidiff =
+      visioncpp::neighbour_operation<AniDiff, 1, 1, 1, 1>(device_memory);
+
+  // assign to the temporary device memory
+  auto exec2 = visioncpp::assign(device_memory, anidiff);
+
+  // convert to uchar
+  auto urgb =
+      visioncpp::point_operation<visioncpp::OP_F32C3ToU8C3>(device_memory);
+
+  // assign to the host memory
+  auto exec3 = visioncpp::assign(out_node, urgb);
+
+  // execution (convert to float)
+  visioncpp::execute<ExecPolicy, LC, LR, LCT, LRT>(exec1, dev);
+
+  // apply anisotropic diffusion several times
+  for (size_t i = 0; i < n; i++) {
+    visioncpp::execute<ExecPolicy, LC, LR, LCT, LRT>(exec2, dev);
+  }
+
+  // return image to host memory
+  visioncpp::execute<ExecPolicy, LC, LR, LCT, LRT>(exec3, dev);
+}
+}  // anisotropic_diffusion
+#endif  // VISIONCPP_EXAMPLES_INCLUDE_ANISOTROPIC_DIFFUSION_HPP_
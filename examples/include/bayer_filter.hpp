@@ -0,0 +1,227 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file bayer_filter.hpp
+/// \brief This file contains the pipeline of the Bayer Filter example, shared
+/// by the example and the pipeline benchmarks. It implements the Bayer Filter
+/// Demosaic Method.
+
+#ifndef VISIONCPP_EXAMPLES_INCLUDE_BAYER_FILTER_HPP_
+#define VISIONCPP_EXAMPLES_INCLUDE_BAYER_FILTER_HPP_
+
+#include <cstdlib>
+
+#include <CL/sycl.hpp>
+#include "pixel/pixel.hpp"
+#include "operators/ops.hpp"
+#include "framework/framework.hpp"
+
+namespace bayer_filter {
+// \brief functor which converts bayerRGGB to BGR
+struct BayerRGGBToBGR {
+  template <typename T>
+  visioncpp::pixel::U8C3 operator()(T bayer) {
+    // finding the pattern based on the index
+    int _case = 0;
+    if (bayer.I_r % 2 == 0 && bayer.I_c % 2 == 0) {
+      _case = 1;
+    } else if (bayer.I_r % 2 == 0 && bayer.I_c % 2 == 1) {
+      _case = 2;
+    } else if (bayer.I_r % 2 == 1 && bayer.I_c % 2 == 0) {
+      _case = 3;
+    } else {
+      _case = 4;
+    }
+    switch (_case) {
+      case 1:  // PIXEL R
+      {
+        // Init RGB variables
+        unsigned char R;
+        unsigned char G;
+        unsigned char B;
+
+        // Get G
+        unsigned char G1 = bayer.at(bayer.I_c, bayer.I_r - 1)[0];
+        unsigned char G2 = bayer.at(bayer.I_c + 1, bayer.I_r)[0];
+        unsigned char G3 = bayer.at(bayer.I_c, bayer.I_r + 1)[0];
+        unsigned char G4 = bayer.at(bayer.I_c - 1, bayer.I_r)[0];
+
+        // Get R
+        unsigned char R1 = bayer.at(bayer.I_c, bayer.I_r - 2)[0];
+        unsigned char R2 = bayer.at(bayer.I_c + 2, bayer.I_r)[0];
+        unsigned char R3 = bayer.at(bayer.I_c, bayer.I_r + 2)[0];
+        unsigned char R4 = bayer.at(bayer.I_c - 2, bayer.I_r)[0];
+
+        // Get B
+        unsigned char B1 = bayer.at(bayer.I_c - 1, bayer.I_r - 1)[0];
+        unsigned char B2 = bayer.at(bayer.I_c + 1, bayer.I_r - 1)[0];
+        unsigned char B3 = bayer.at(bayer.I_c + 1, bayer.I_r + 1)[0];
+        unsigned char B4 = bayer.at(bayer.I_c - 1, bayer.I_r + 1)[0];
+
+        // Assign R
+        R = bayer.at(bayer.I_c, bayer.I_r)[0];
+
+        // Assign G
+        if (abs(R1 - R3) < abs(R2 - R4)) {
+          G = (G1 + G3) / 2;
+        } else if (abs(R1 - R3) > abs(R2 - R4)) {
+          G = (G2 + G4) / 2;
+        } else {
+          G = (G1 + G2 + G3 + G4) / 4;
+        }
+
+        // Assign B
+        B = (B1 + B2 + B3 + B4) / 4;
+
+        // Return BGR
+        return visioncpp::pixel::U8C3(B, G, R);
+      } break;
+      case 2:  // PIXEL G1
+      {
+        // Init RGB variables
+        unsigned char R;
+        unsigned char G;
+        unsigned char B;
+
+        // Get R
+        unsigned char R1 = bayer.at(bayer.I_c - 1, bayer.I_r)[0];
+        unsigned char R2 = bayer.at(bayer.I_c + 1, bayer.I_r)[0];
+
+        // Get B
+        unsigned char B1 = bayer.at(bayer.I_c, bayer.I_r - 1)[0];
+        unsigned char B2 = bayer.at(bayer.I_c, bayer.I_r + 1)[0];
+
+        // Assign R
+        R = (R1 + R2) / 2;
+
+        // Assign G
+        G = bayer.at(bayer.I_c, bayer.I_r)[0];
+
+        // Assign B
+        B = (B1 + B2) / 2;
+
+        // Return BGR
+        return visioncpp::pixel::U8C3(B, G, R);
+      } break;
+      case 3:  // Pixel G2
+      {
+        // Init RGB variables
+        unsigned char R;
+        unsigned char G;
+        unsigned char B;
+
+        // Get R
+        unsigned char R1 = bayer.at(bayer.I_c, bayer.I_r - 1)[0];
+        unsigned char R2 = bayer.at(bayer.I_c, bayer.I_r + 1)[0];
+
+        // Get B
+        unsigned char B1 = bayer.at(bayer.I_c - 1, bayer.I_r)[0];
+        unsigned char B2 = bayer.at(bayer.I_c + 1, bayer.I_r)[0];
+
+        // Assign R
+        R = (R1 + R2) / 2;
+
+        // Assign G
+        G = bayer.at(bayer.I_c, bayer.I_r)[0];
+
+        // Assign B
+        B = (B1 + B2) / 2;
+
+        // Return BGR
+        return visioncpp::pixel::U8C3(B, G, R);
+      } break;
+      case 4:  // pixel B
+      {
+        // Init RGB Values
+        unsigned char R;
+        unsigned char G;
+        unsigned char B;
+
+        // Get G
+        unsigned char G1 = bayer.at(bayer.I_c, bayer.I_r - 1)[0];
+        unsigned char G2 = bayer.at(bayer.I_c + 1, bayer.I_r)[0];
+        unsigned char G3 = bayer.at(bayer.I_c, bayer.I_r + 1)[0];
+        unsigned char G4 = bayer.at(bayer.I_c - 1, bayer.I_r)[0];
+
+        // Get B
+        unsigned char B1 = bayer.at(bayer.I_c, bayer.I_r - 2)[0];
+        unsigned char B2 = bayer.at(bayer.I_c + 2, bayer.I_r)[0];
+        unsigned char B3 = bayer.at(bayer.I_c, bayer.I_r + 2)[0];
+        unsigned char B4 = bayer.at(bayer.I_c - 2, bayer.I_r)[0];
+
+        // Get R
+        unsigned char R1 = bayer.at(bayer.I_c - 1, bayer.I_r - 1)[0];
+        unsigned char R2 = bayer.at(bayer.I_c + 1, bayer.I_r - 1)[0];
+        unsigned char R3 = bayer.at(bayer.I_c + 1, bayer.I_r + 1)[0];
+        unsigned char R4 = bayer.at(bayer.I_c - 1, bayer.I_r + 1)[0];
+
+        // Assign R
+        R = (R1 + R2 + R3 + R4) / 4;
+
+        // Assign G
+        if (abs(B1 - B3) < abs(B2 - B4)) {
+          G = (G1 + G3) / 2;
+        } else if (abs(B1 - B3) > abs(B2 - B4)) {
+          G = (G2 + G4) / 2;
+        } else {
+          G = (G1 + G2 + G3 + G4) / 4;
+        }
+
+        // Assign B
+        B = bayer.at(bayer.I_c, bayer.I_r)[0];
+
+        // Return BGR
+        return visioncpp::pixel::U8C3(B, G, R);
+      } break;
+      default: {
+        return visioncpp::pixel::U8C3(0, 0, 0);  // avoid warning
+      } break;
+    }
+  }
+};
+
+/// \brief builds the demosaic of the BayerRGGB image of the in_node terminal
+/// and executes it, writing the BGR image to the out_node terminal.
+/// template parameters:
+/// \tparam ExecPolicy: the policy of the execution
+/// \tparam LC: the column size for local memory
+/// \tparam LR: the row size for local memory
+/// \tparam LCT: the size of the workgroup column
+/// \tparam LRT: the size of the workgroup row
+/// function parameters:
+/// \param in_node: the U8C1 terminal holding the bayer image
+/// \param out_node: the U8C3 terminal receiving the BGR image
+/// \param dev: the selected device for executing the pipeline
+/// \return void
+template <visioncpp::policy::PolicyType ExecPolicy, size_t LC, size_t LR,
+          size_t LCT, size_t LRT, typename In, typename Out, typename DeviceT>
+void run(In &in_node, Out &out_node, const DeviceT &dev) {
+  // Apply demoisaic method (the 2,2,2,2 parameter means the Halo in the Top,
+  // Left, Right, Bottom )
+  auto bgr =
+      visioncpp::neighbour_operation<BayerRGGBToBGR, 2, 2, 2, 2>(in_node);
+
+  // assign to the host memory
+  auto k = visioncpp::assign(out_node, bgr);
+
+  // execute
+  visioncpp::execute<ExecPolicy, LC, LR, LCT, LRT>(k, dev);
+}
+}  // bayer_filter
+#endif  // VISIONCPP_EXAMPLES_INCLUDE_BAYER_FILTER_HPP_
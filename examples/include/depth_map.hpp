@@ -0,0 +1,147 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file depth_map.hpp
+/// \brief This file contains the pipeline of the Depth Map From 2 images
+/// example, shared by the example and the pipeline benchmarks. It implements a
+/// Depth Map reconstruction from two images using the block match algorithm
+/// \param blockSize - this parameter defines the size of the block to be
+/// searched
+/// \param maxDisp - this parameter defines the maximum disparity between
+/// pixels. It means the max number of pixels it will be used to search for the
+/// best match.
+
+#ifndef VISIONCPP_EXAMPLES_INCLUDE_DEPTH_MAP_HPP_
+#define VISIONCPP_EXAMPLES_INCLUDE_DEPTH_MAP_HPP_
+
+// include limits to define infinity
+#include <limits>
+
+#include <CL/sycl.hpp>
+#include "pixel/pixel.hpp"
+#include "operators/ops.hpp"
+#include "framework/framework.hpp"
+
+namespace depth_map {
+// Tunable parameters for the algorithm
+constexpr int blockSize = 11;
+constexpr int maxDisp = 25;
+
+constexpr int halfBlock = blockSize / 2;
+
+// Stereo block matching algorithm for depth map reconstruction
+struct Stereo_BMA {
+  // function that computers the sum of absolute difference of two blocks
+  float SAD(const float im1[blockSize * blockSize],
+            const float im2[blockSize * blockSize]) {
+    float r = 0;
+    for (size_t i = 0; i < blockSize * blockSize; i++) {
+      r += cl::sycl::fabs(im1[i] - im2[i]);
+    }
+    return r;
+  }
+
+  // Function to get block of size blockSize frin (c,r) pixel
+  template <typename T>
+  void getBlock(const T& I, const int& c, const int& r, const int& layer,
+                float block[blockSize * blockSize]) {
+    int cnt = 0;
+    for (int i2 = -halfBlock; i2 <= halfBlock; i2++) {
+      for (int j2 = -halfBlock; j2 <= halfBlock; j2++) {
+        block[cnt++] = I.at(c + i2, r + j2)[layer];
+      }
+    }
+  }
+
+  // function that computes the depth map
+  template <typename T>
+  visioncpp::pixel::U8C1 operator()(const T& I) {
+    // get block from left image
+    float block_l[blockSize * blockSize];
+    getBlock(I, I.I_c, I.I_r, 0, block_l);
+
+    // start with best sum of absolute difference equals to infinity
+    float bestSAD = std::numeric_limits<float>::infinity();
+    int bestJ = I.I_c;
+
+    // for loop to find best match
+    float block_r[blockSize * blockSize];
+    for (int m = 0; m < maxDisp; m++) {
+      // get block from right image
+      getBlock(I, I.I_c - m, I.I_r, 1, block_r);
+
+      // sum of absolute difference
+      float temp = SAD(block_l, block_r);
+
+      // store the smallest SAD
+      if (temp < bestSAD) {
+        bestSAD = temp;
+        bestJ = I.I_c - m;
+      }
+    }
+
+    // Compute disparity value
+    return visioncpp::pixel::U8C1(I.I_c - bestJ);
+  }
+};
+
+/// \brief builds the depth map of the images of the in_l and in_r terminals
+/// and executes it, writing the disparities to the out terminal.
+/// template parameters:
+/// \tparam ExecPolicy: the policy of the execution
+/// \tparam LC: the column size for local memory
+/// \tparam LR: the row size for local memory
+/// \tparam LCT: the size of the workgroup column
+/// \tparam LRT: the size of the workgroup row
+/// function parameters:
+/// \param in_l: the U8C1 terminal holding the left image
+/// \param in_r: the U8C1 terminal holding the right image
+/// \param out: the U8C1 terminal receiving the depth map
+/// \param dev: the selected device for executing the pipeline
+/// \return void
+template <visioncpp::policy::PolicyType ExecPolicy, size_t LC, size_t LR,
+          size_t LCT, size_t LRT, typename In, typename Out, typename DeviceT>
+void run(In &in_l, In &in_r, Out &out, const DeviceT &dev) {
+  // convert images to float
+  auto fgrey_l = visioncpp::point_operation<visioncpp::OP_U8C1ToFloat>(in_l);
+  auto fgrey_r = visioncpp::point_operation<visioncpp::OP_U8C1ToFloat>(in_r);
+
+  // merge images
+  auto merge =
+      visioncpp::point_operation<visioncpp::OP_Merge2Chns>(fgrey_l, fgrey_r);
+
+  // compute depth map
+  auto depth = visioncpp::neighbour_operation<
+      Stereo_BMA, halfBlock, halfBlock + maxDisp, halfBlock, halfBlock>(merge);
+
+  // convert to unsigned char for displaying purposes
+  // scale threhold to display
+  auto scale_node = visioncpp::terminal<float, visioncpp::memory_type::Const>(
+      static_cast<float>(8.0f));
+  auto display =
+      visioncpp::point_operation<visioncpp::OP_Scale>(depth, scale_node);
+
+  // assign to the output
+  auto exec = visioncpp::assign(out, display);
+
+  // execute expression tree
+  visioncpp::execute<ExecPolicy, LC, LR, LCT, LRT>(exec, dev);
+}
+}  // depth_map
+#endif  // VISIONCPP_EXAMPLES_INCLUDE_DEPTH_MAP_HPP_
@@ -0,0 +1,218 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file optical_flow_LK.hpp
+/// \brief This file contains the pipeline of the Lucas-Kanade Optical Flow
+/// example, shared by the example and the pipeline benchmarks.
+/// This optical flow needs to solve the following equation
+/// | u | = inv(sum w  | Dx^2  Dx*Dy | ) * sum w | -Dx*Dt |
+/// | v |      (       | Dx*Dy Dy^2  | )         | -Dy*Dt |
+/// where w is the NxN window of ones
+///
+/// doing algebraic manipulation
+/// n = sum(Dx^2) * sum (Dy^2) - (sum (Dx * Dy)^2)
+/// u = (-sum (Dy^2) * sum (Dx*Dt) + sum (Dx*Dy) * sum (Dy*Dt)) / n
+/// v = ( sum (Dx*Dt) * sum (Dx*Dy) - sum (Dx^2) * sum (Dy*Dt)) / n
+
+#ifndef VISIONCPP_EXAMPLES_INCLUDE_OPTICAL_FLOW_LK_HPP_
+#define VISIONCPP_EXAMPLES_INCLUDE_OPTICAL_FLOW_LK_HPP_
+
+#include <cmath>
+
+#include <CL/sycl.hpp>
+#include "pixel/pixel.hpp"
+#include "operators/ops.hpp"
+#include "framework/framework.hpp"
+
+namespace optical_flow_LK {
+// size of the sum mask
+constexpr size_t N = 15;
+
+// operator that transforms uv coordinates into polar coordinates
+// it was created for displaying the optical flow in RGB
+struct OP_UVtoPolar {
+  visioncpp::pixel::F32C3 operator()(visioncpp::pixel::F32C2 t) {
+    float intensity = cl::sycl::clamp(
+        cl::sycl::sqrt(t[0] * t[0] + t[1] * t[1]) / 2.0f, 0.0f, 1.0f);
+    float angle = cl::sycl::atan2(t[1], t[0]) / (2.0f * M_PI);
+    float chn = 1.0f;
+    return visioncpp::pixel::F32C3(angle, chn, intensity);
+  }
+};
+
+/// \brief builds the Lucas-Kanade Optical Flow between the frames of the prev
+/// and in terminals and executes it, writing the flow displayed in RGB to the
+/// out terminal.
+/// template parameters:
+/// \tparam ExecPolicy: the policy of the execution and of the kernel breaks
+/// \tparam LC: the column size for local memory
+/// \tparam LR: the row size for local memory
+/// \tparam LCT: the size of the workgroup column
+/// \tparam LRT: the size of the workgroup row
+/// function parameters:
+/// \param in: the U8C3 terminal holding the current frame
+/// \param prev: the U8C3 terminal holding the previous frame
+/// \param out: the U8C3 terminal receiving the flow
+/// \param dev: the selected device for executing the pipeline
+/// \return void
+template <visioncpp::policy::PolicyType ExecPolicy, size_t LC, size_t LR,
+          size_t LCT, size_t LRT, typename In, typename Out, typename DeviceT>
+void run(In &in, In &prev, Out &out, const DeviceT &dev) {
+  // defining sum mask
+  constexpr size_t NxN = N * N;
+  float sum_mask[NxN];
+  for (size_t i = 0; i < NxN; i++) {
+    sum_mask[i] = 1.0f;
+  }
+
+  // defining derivatives
+  float prewitt_x[9] = {-1.0f, 0.0f,  1.0f, -2.0f, 0.0f,
+                        2.0f,  -1.0f, 0.0f, 1.0f};
+  float prewitt_y[9] = {-1.0f, -2.0f, -1.0f, 0.0, 0.0f, 0.0f, 1.0f, 2.0f, 1.0f};
+
+  // convert unsigned char to float
+  auto ifrgb = visioncpp::point_operation<visioncpp::OP_U8C3ToF32C3>(in);
+  // convert to grey scale previous and current frame
+  auto ifgrey = visioncpp::point_operation<visioncpp::OP_RGBToGREY>(ifrgb);
+
+  // convert unsigned char to float
+  auto pfrgb = visioncpp::point_operation<visioncpp::OP_U8C3ToF32C3>(prev);
+  // convert to grey scale previous and current frame
+  auto pfgrey = visioncpp::point_operation<visioncpp::OP_RGBToGREY>(pfrgb);
+
+  // apply derivatives in x, y and t (in current and previous images)
+  auto px_filter =
+      visioncpp::terminal<float, 3, 3, visioncpp::memory_type::Buffer2D,
+                          visioncpp::scope::Constant>(prewitt_x);
+  auto py_filter =
+      visioncpp::terminal<float, 3, 3, visioncpp::memory_type::Buffer2D,
+                          visioncpp::scope::Constant>(prewitt_y);
+
+  // break tree before convolution
+  auto iifgrey = visioncpp::schedule<ExecPolicy, LC, LR, LCT, LRT>(ifgrey);
+  auto ppfgrey = visioncpp::schedule<ExecPolicy, LC, LR, LCT, LRT>(pfgrey);
+
+  auto ipx = visioncpp::neighbour_operation<visioncpp::OP_Filter2D>(
+      iifgrey, px_filter);
+  auto ipy = visioncpp::neighbour_operation<visioncpp::OP_Filter2D>(
+      iifgrey, py_filter);
+  auto ppx = visioncpp::neighbour_operation<visioncpp::OP_Filter2D>(
+      ppfgrey, px_filter);
+  auto ppy = visioncpp::neighbour_operation<visioncpp::OP_Filter2D>(
+      ppfgrey, py_filter);
+
+  // break tree after convolution
+  auto iipx = visioncpp::schedule<ExecPolicy, LC, LR, LCT, LRT>(ipx);
+  auto iipy = visioncpp::schedule<ExecPolicy, LC, LR, LCT, LRT>(ipy);
+  auto pppx = visioncpp::schedule<ExecPolicy, LC, LR, LCT, LRT>(ppx);
+  auto pppy = visioncpp::schedule<ExecPolicy, LC, LR, LCT, LRT>(ppy);
+
+  // sum derivatives of current and previous frames
+  auto px = visioncpp::point_operation<visioncpp::OP_Add>(iipx, pppx);
+  auto py = visioncpp::point_operation<visioncpp::OP_Add>(iipy, pppy);
+  auto pt = visioncpp::point_operation<visioncpp::OP_Sub>(ifgrey, pfgrey);
+
+  auto px2 = visioncpp::point_operation<visioncpp::OP_PowerOf2>(px);
+  auto py2 = visioncpp::point_operation<visioncpp::OP_PowerOf2>(py);
+  auto pxy = visioncpp::point_operation<visioncpp::OP_Mul>(px, py);
+  auto pxt = visioncpp::point_operation<visioncpp::OP_Mul>(px, pt);
+  auto pyt = visioncpp::point_operation<visioncpp::OP_Mul>(py, pt);
+
+  // break tree before convolution
+  auto ppx2 = visioncpp::schedule<ExecPolicy, LC, LR, LCT, LRT>(px2);
+  auto ppy2 = visioncpp::schedule<ExecPolicy, LC, LR, LCT, LRT>(py2);
+  auto ppxy = visioncpp::schedule<ExecPolicy, LC, LR, LCT, LRT>(pxy);
+  auto ppxt = visioncpp::schedule<ExecPolicy, LC, LR, LCT, LRT>(pxt);
+  auto ppyt = visioncpp::schedule<ExecPolicy, LC, LR, LCT, LRT>(pyt);
+
+  // Sum neighbours
+  auto sum_mask_node =
+      visioncpp::terminal<float, N, N, visioncpp::memory_type::Buffer2D,
+                          visioncpp::scope::Constant>(sum_mask);
+
+  auto sumpx2 = visioncpp::neighbour_operation<visioncpp::OP_Filter2D>(
+      ppx2, sum_mask_node);
+  auto sumpy2 = visioncpp::neighbour_operation<visioncpp::OP_Filter2D>(
+      ppy2, sum_mask_node);
+  auto sumpxy = visioncpp::neighbour_operation<visioncpp::OP_Filter2D>(
+      ppxy, sum_mask_node);
+  auto sumpxt = visioncpp::neighbour_operation<visioncpp::OP_Filter2D>(
+      ppxt, sum_mask_node);
+  auto sumpyt = visioncpp::neighbour_operation<visioncpp::OP_Filter2D>(
+      ppyt, sum_mask_node);
+
+  // break tree after convolution
+  auto ksumpx2 = visioncpp::schedule<ExecPolicy, LC, LR, LCT, LRT>(sumpx2);
+  auto ksumpy2 = visioncpp::schedule<ExecPolicy, LC, LR, LCT, LRT>(sumpy2);
+  auto ksumpxy = visioncpp::schedule<ExecPolicy, LC, LR, LCT, LRT>(sumpxy);
+  auto ksumpxt = visioncpp::schedule<ExecPolicy, LC, LR, LCT, LRT>(sumpxt);
+  auto ksumpyt = visioncpp::schedule<ExecPolicy, LC, LR, LCT, LRT>(sumpyt);
+
+  // now we can finally apply the formulas
+  // u = (-sum (Dy^2) * sum (Dx*Dt) + sum (Dx*Dy) * sum (Dy*Dt)) / n
+  // v = ( sum (Dx*Dt) * sum (Dx*Dy) - sum (Dx^2) * sum (Dy*Dt)) / n
+
+  // n = sum(Dx^2) * sum (Dy^2) - (sum (Dx * Dy)^2)
+  auto px2py2 = visioncpp::point_operation<visioncpp::OP_Mul>(ksumpx2, ksumpy2);
+  auto pxy2 = visioncpp::point_operation<visioncpp::OP_PowerOf2>(ksumpxy);
+  auto px2py2_Sub_pxy2 =
+      visioncpp::point_operation<visioncpp::OP_Sub>(px2py2, pxy2);
+  auto norm =
+      visioncpp::schedule<ExecPolicy, LC, LR, LCT, LRT>(px2py2_Sub_pxy2);
+
+  // calculate V
+  // v = ( sum (Dx*Dt) * sum (Dx*Dy) - sum (Dx^2) * sum (Dy*Dt)) / n
+  auto pxtpxy = visioncpp::point_operation<visioncpp::OP_Mul>(ksumpxt, ksumpxy);
+  auto px2pyt = visioncpp::point_operation<visioncpp::OP_Mul>(ksumpx2, ksumpyt);
+  auto pxtpxy_Sub_px2pyt =
+      visioncpp::point_operation<visioncpp::OP_Sub>(pxtpxy, px2pyt);
+  auto v =
+      visioncpp::point_operation<visioncpp::OP_Div>(pxtpxy_Sub_px2pyt, norm);
+
+  // calculate U
+  // u = (-sum (Dy^2) * sum (Dx*Dt) + sum (Dx*Dy) * sum (Dy*Dt)) / n
+  auto pxypyt = visioncpp::point_operation<visioncpp::OP_Mul>(ksumpxy, ksumpyt);
+  auto py2pxt = visioncpp::point_operation<visioncpp::OP_Mul>(ksumpy2, ksumpxt);
+  auto pxypft_Sub_py2pxt =
+      visioncpp::point_operation<visioncpp::OP_Sub>(pxypyt, py2pxt);
+  auto u =
+      visioncpp::point_operation<visioncpp::OP_Div>(pxypft_Sub_py2pxt, norm);
+
+  // assign result in one matrix with 2 channels
+  // variable uv contains the optical flow computed for each pixel
+  auto uv = visioncpp::point_operation<visioncpp::OP_Merge2Chns>(u, v);
+
+  // The next operations were created to visualize the optical flow
+  // convert UV into polar coordinates
+  auto polar = visioncpp::point_operation<OP_UVtoPolar>(uv);
+
+  // convert into RGB
+  auto frgb = visioncpp::point_operation<visioncpp::OP_HSVToRGB>(polar);
+
+  // convert float to char
+  auto urgb = visioncpp::point_operation<visioncpp::OP_F32C3ToU8C3>(frgb);
+
+  // assign the urgb to the output node
+  auto k = visioncpp::assign(out, urgb);
+
+  // execute
+  visioncpp::execute<ExecPolicy, LC, LR, LCT, LRT>(k, dev);
+}
+}  // optical_flow_LK
+#endif  // VISIONCPP_EXAMPLES_INCLUDE_OPTICAL_FLOW_LK_HPP_
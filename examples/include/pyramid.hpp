@@ -0,0 +1,109 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file pyramid.hpp
+/// \brief This file contains the pipeline of the Pyramid example, shared by
+/// the example and the pipeline benchmarks. The frame is downsampled twice;
+/// the first level is converted to HSV and the second one to grey scale.
+
+#ifndef VISIONCPP_EXAMPLES_INCLUDE_PYRAMID_HPP_
+#define VISIONCPP_EXAMPLES_INCLUDE_PYRAMID_HPP_
+
+#include <CL/sycl.hpp>
+#include "pixel/pixel.hpp"
+#include "operators/ops.hpp"
+#include "framework/framework.hpp"
+
+namespace pyramid {
+/// \brief builds the pyramid of the frame of the data_in terminal and executes
+/// it, writing its two levels to the data_out_lvl1 and data_out_lvl2
+/// terminals.
+/// template parameters:
+/// \tparam ExecPolicy: the policy of the execution
+/// \tparam LC: the column size for local memory
+/// \tparam LR: the row size for local memory
+/// \tparam LCT: the size of the workgroup column
+/// \tparam LRT: the size of the workgroup row
+/// function parameters:
+/// \param data_in: the U8C3 terminal holding the frame
+/// \param data_out_lvl1: the U8C3 terminal receiving the HSV of the first
+/// level, with half the size of the frame
+/// \param data_out_lvl2: the U8C1 terminal receiving the grey scale of the
+/// second level, with a quarter of the size of the frame
+/// \param dev: the selected device for executing the pipeline
+/// \return void
+template <visioncpp::policy::PolicyType ExecPolicy, size_t LC, size_t LR,
+          size_t LCT, size_t LRT, typename In, typename Out1, typename Out2,
+          typename DeviceT>
+void run(In &data_in, Out1 &data_out_lvl1, Out2 &data_out_lvl2,
+         const DeviceT &dev) {
+  // filter for pyramid; change it to whatever you want
+  float filter_array[3] = {1.0f / 3.0f, 1.0f / 3.0f, 1.0f / 3.0f};
+
+  // pyramid tree creation
+  // column-wise filter for separable convolution in pyramid
+  auto filter_col =
+      visioncpp::terminal<float, 3, 1, visioncpp::memory_type::Buffer2D,
+                          visioncpp::scope::Constant>(filter_array);
+  // row-wise filter for separable convolution in pyramid
+  auto filter_row =
+      visioncpp::terminal<float, 1, 3, visioncpp::memory_type::Buffer2D,
+                          visioncpp::scope::Constant>(filter_array);
+
+  auto pyr_node =
+      visioncpp::pyramid_down<visioncpp::OP_SepFilterCol,
+                              visioncpp::OP_SepFilterRow,
+                              visioncpp::OP_DownsampleClosest, 2>(
+          data_in, filter_col, filter_row);
+
+  // does HSV on downsampled ( lvl 1 ) pyramid
+  // get pyramid ( U8C3 ) and convert it to F32C3
+  auto node_hsv = visioncpp::point_operation<visioncpp::OP_U8C3ToF32C3>(
+      pyr_node.template get<0>());
+  // convert RGB to HSV
+  auto node2_hsv = visioncpp::point_operation<visioncpp::OP_RGBToHSV>(node_hsv);
+  // F32C3 to U8C3 with order of BGR
+  auto node3_hsv =
+      visioncpp::point_operation<visioncpp::OP_HSVToU8C3>(node2_hsv);
+
+  // assign operation
+  auto hsv_node = visioncpp::assign(data_out_lvl1, node3_hsv);
+
+  // lets do GREY on downsampled ( lvl 2 ) pyramid
+  // get pyramid ( U8C3 ) and convert it to F32C3
+  auto node_grey = visioncpp::point_operation<visioncpp::OP_U8C3ToF32C3>(
+      pyr_node.template get<1>());
+  // convert RGB to GREY
+  auto node2_grey =
+      visioncpp::point_operation<visioncpp::OP_RGBToGREY>(node_grey);
+
+  auto node3_grey =
+      visioncpp::point_operation<visioncpp::OP_GREYToCVBGR>(node2_grey);
+
+  // assign operation
+  auto grey_node = visioncpp::assign(data_out_lvl2, node3_grey);
+
+  // execute the pipe
+  // next the hsv
+  visioncpp::execute<ExecPolicy, LC, LR, LCT, LRT>(hsv_node, dev);
+  // next the grey
+  visioncpp::execute<ExecPolicy, LC, LR, LCT, LRT>(grey_node, dev);
+}
+}  // pyramid
+#endif  // VISIONCPP_EXAMPLES_INCLUDE_PYRAMID_HPP_
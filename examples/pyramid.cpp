@@ -32,6 +32,8 @@
 #include <opencv2/opencv.hpp>
 // include VisionCpp
 #include <visioncpp.hpp>
+// include the Pyramid pipeline
+#include "include/pyramid.hpp"
 
 using namespace visioncpp;
 int main(int argc, char **argv) {
@@ -68,9 +70,6 @@ int main(int argc, char **argv) {
       new unsigned char[COLS / 4 * ROWS / 4],
       [](unsigned char *dataMem) { delete[] dataMem; });
 
-  // filter for pyramid; change it to whatever you want
-  float filter_array[3] = {1.0f / 3.0f, 1.0f / 3.0f, 1.0f / 3.0f};
-
   // create opencv mat
   cv::Mat frame;
   cv::Mat output_lvl1(ROWS / 2, COLS / 2, CV_8UC3, img_vcpp_lv1.get());
@@ -89,74 +88,24 @@ int main(int argc, char **argv) {
     cv::resize(frame, frame, cv::Size(COLS, ROWS), 0, 0, cv::INTER_CUBIC);
 
     {
-      // define the VisionCpp pipe
-      // pyramid tree creation
-      // column-wise filter for separable convolution in pyramid
-      auto filter_col =
-          terminal<float, 3, 1, memory_type::Buffer2D, scope::Constant>(
-              filter_array);
-      // row-wise filter for separable convolution in pyramid
-      auto filter_row =
-          terminal<float, 1, 3, memory_type::Buffer2D, scope::Constant>(
-              filter_array);
-      // define the VisionCpp pipe
-
       // input node ( terminal )
       auto data_in =
           terminal<visioncpp::pixel::U8C3, COLS, ROWS, memory_type::Buffer2D>(
               frame.data);
 
-      auto pyr_node =
-          pyramid_down<OP_SepFilterCol, OP_SepFilterRow, OP_DownsampleClosest,
-                       2>(data_in, filter_col, filter_row);
-
-      // does HSV on downsampled ( lvl 1 ) pyramid
-      // create output node
+      // create output nodes
       auto data_out_lvl1 =
           visioncpp::terminal<visioncpp::pixel::U8C3, COLS / 2, ROWS / 2,
                               visioncpp::memory_type::Buffer2D>(
               img_vcpp_lv1.get());
-
-      // get pyramid ( U8C3 ) and convert it to F32C3
-      auto node_hsv = visioncpp::point_operation<visioncpp::OP_U8C3ToF32C3>(
-          pyr_node.get<0>());
-      // convert RGB to HSV
-      auto node2_hsv =
-          visioncpp::point_operation<visioncpp::OP_RGBToHSV>(node_hsv);
-      // F32C3 to U8C3 with order of BGR
-      auto node3_hsv =
-          visioncpp::point_operation<visioncpp::OP_HSVToU8C3>(node2_hsv);
-
-      // assign operation
-      auto hsv_node = visioncpp::assign(data_out_lvl1, node3_hsv);
-
-      // lets do GREY on downsampled ( lvl 2 ) pyramid
-      // create output node
       auto data_out_lvl2 =
           visioncpp::terminal<visioncpp::pixel::U8C1, COLS / 4, ROWS / 4,
                               visioncpp::memory_type::Buffer2D>(
               img_vcpp_lv2.get());
 
-      // get pyramid ( U8C3 ) and convert it to F32C3
-      auto node_grey = visioncpp::point_operation<visioncpp::OP_U8C3ToF32C3>(
-          pyr_node.get<1>());
-      // convert RGB to GREY
-      auto node2_grey =
-          visioncpp::point_operation<visioncpp::OP_RGBToGREY>(node_grey);
-
-      auto node3_grey =
-          visioncpp::point_operation<visioncpp::OP_GREYToCVBGR>(node2_grey);
-
-      // assign operation
-      auto grey_node = visioncpp::assign(data_out_lvl2, node3_grey);
       // execute the pipe
-      // next the hsv
-
-      visioncpp::execute<visioncpp::policy::Fuse, 32, 32, 16, 16>(hsv_node,
-                                                                  dev);
-      // next the grey
-      visioncpp::execute<visioncpp::policy::Fuse, 32, 32, 16, 16>(grey_node,
-                                                                  dev);
+      pyramid::run<visioncpp::policy::Fuse, 32, 32, 16, 16>(
+          data_in, data_out_lvl1, data_out_lvl2, dev);
     }
     // show reference image
     cv::imshow("Reference Image", frame);
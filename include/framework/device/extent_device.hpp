@@ -0,0 +1,87 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for compute vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file extent_device.hpp
+/// \brief This file contains the ExtentDevice used to execute an expression
+/// with a runtime image size on any backend
+
+#ifndef VISIONCPP_INCLUDE_FRAMEWORK_DEVICE_EXTENT_DEVICE_HPP_
+#define VISIONCPP_INCLUDE_FRAMEWORK_DEVICE_EXTENT_DEVICE_HPP_
+
+namespace visioncpp {
+namespace internal {
+/// \class ExtentDevice
+/// \brief ExtentDevice wraps a device and passes the runtime size of the
+/// images to each kernel submitted to it. It is used by the execute function
+/// taking the column and row sizes, by execute_roi and by execute_batch, so
+/// that the fuse and no_fuse policies and the sub-expression evaluation stay
+/// unchanged.
+/// template parameters:
+/// \tparam DeviceT: the wrapped device type
+/// \tparam Extent: the type holding the runtime size of the images
+template <typename DeviceT, typename Extent>
+class ExtentDevice {
+ private:
+  const DeviceT &dev;
+  Extent ext;
+
+ public:
+  /// the handle returned by execute_async
+  using Event = typename DeviceT::Event;
+
+  ExtentDevice(const DeviceT &devArg, Extent extArg)
+      : dev(devArg), ext(extArg) {}
+
+  /// \brief returns the pool of intermediate memories of the wrapped device
+  BufferPool &buffer_pool() const { return dev.buffer_pool(); }
+
+  /// \brief returns the profiler of the wrapped device
+  Profiler &profiler() const { return dev.profiler(); }
+
+  /// \brief returns the name of the wrapped device
+  std::string name() const { return dev.name(); }
+
+  /// \brief returns the local memory of the wrapped device
+  size_t local_mem_size() const { return dev.local_mem_size(); }
+
+  /// \brief returns the number of frames of each execution
+  size_t frames() const { return ext.frames(); }
+
+  template <size_t LC, size_t LR, size_t CGT, size_t RGT, size_t CLT,
+            size_t RLT, typename Expr>
+  void execute(Expr &expr) const {
+    dev.template execute<LC, LR, CGT, RGT, CLT, RLT>(expr, ext);
+  }
+
+  /// \brief runs the launch function on the wrapped device. The launch
+  /// function receives an ExtentDevice with the same image size.
+  /// \param launch: a function submitting the kernels of an expression to the
+  /// device passed to it
+  /// \return Event
+  template <typename Launch>
+  Event launch_async(Launch launch) const {
+    Extent extent = ext;
+    return dev.launch_async([extent, launch](const DeviceT &d) mutable {
+      launch(ExtentDevice(d, extent));
+    });
+  }
+};
+}  // internal
+}  // visioncpp
+#endif  // VISIONCPP_INCLUDE_FRAMEWORK_DEVICE_EXTENT_DEVICE_HPP_
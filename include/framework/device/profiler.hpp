@@ -0,0 +1,300 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for compute vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file profiler.hpp
+/// \brief This file contains the Profiler recording the start and end time of
+/// every kernel submitted to a device, labelled with the nodes of the
+/// expression computed by the kernel.
+
+#ifndef VISIONCPP_INCLUDE_FRAMEWORK_DEVICE_PROFILER_HPP_
+#define VISIONCPP_INCLUDE_FRAMEWORK_DEVICE_PROFILER_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+#if defined(__GNUG__)
+#include <cxxabi.h>
+#endif
+
+namespace visioncpp {
+namespace internal {
+/// function type_name
+/// \brief returns the readable name of the type T. The visioncpp namespace is
+/// removed from the name.
+/// \return std::string
+template <typename T>
+std::string type_name() {
+  std::string name = typeid(T).name();
+#if defined(__GNUG__)
+  int status = 0;
+  char *demangled =
+      abi::__cxa_demangle(name.c_str(), nullptr, nullptr, &status);
+  if (status == 0 && demangled) {
+    name = demangled;
+  }
+  std::free(demangled);
+#endif
+  const std::string ns = "visioncpp::";
+  for (auto pos = name.find(ns); pos != std::string::npos;
+       pos = name.find(ns, pos)) {
+    name.erase(pos, ns.size());
+  }
+  return name;
+}
+
+/// \struct OpName
+/// \brief OpName returns the name of the operator of a node. The operators of
+/// the nodes wrap the user functor (e.g. PixelUnaryOp), whose name is used.
+template <typename OP, typename = void>
+struct OpName {
+  static std::string get() { return type_name<OP>(); }
+};
+
+/// \brief specialisation of OpName for the wrappers of a user functor
+template <typename OP>
+struct OpName<OP, typename std::conditional<true, void,
+                                            typename OP::OP>::type> {
+  static std::string get() { return type_name<typename OP::OP>(); }
+};
+
+/// \struct KernelLabel
+/// \brief KernelLabel builds the label of a kernel from the expression it
+/// computes. Each operation is written with the name of its operator and its
+/// children, e.g. OP_Filter2D(OP_RGBToHSV(Leaf), Leaf). This is the case of
+/// the terminal nodes, including the outputs of the subexpressions computed
+/// by a previous kernel.
+template <typename Node>
+struct KernelLabel {
+  static std::string get() { return "Leaf"; }
+};
+
+/// \brief specialisation of KernelLabel for the unary point operation
+template <typename OP, typename RHS, size_t Cols, size_t Rows, size_t LfType,
+          size_t LVL>
+struct KernelLabel<RUnOP<OP, RHS, Cols, Rows, LfType, LVL>> {
+  static std::string get() {
+    return OpName<OP>::get() + "(" + KernelLabel<RHS>::get() + ")";
+  }
+};
+
+/// \brief specialisation of KernelLabel for the binary point operation
+template <typename OP, typename LHS, typename RHS, size_t Cols, size_t Rows,
+          size_t LfType, size_t LVL>
+struct KernelLabel<RBiOP<OP, LHS, RHS, Cols, Rows, LfType, LVL>> {
+  static std::string get() {
+    return OpName<OP>::get() + "(" + KernelLabel<LHS>::get() + ", " +
+           KernelLabel<RHS>::get() + ")";
+  }
+};
+
+/// \brief specialisation of KernelLabel for the neighbour operation with
+/// filter
+template <typename OP, size_t Halo_T, size_t Halo_L, size_t Halo_B,
+          size_t Halo_R, typename LHS, typename RHS, size_t Cols, size_t Rows,
+          size_t LfType, size_t LVL>
+struct KernelLabel<StnFilt<OP, Halo_T, Halo_L, Halo_B, Halo_R, LHS, RHS, Cols,
+                           Rows, LfType, LVL>> {
+  static std::string get() {
+    return OpName<OP>::get() + "(" + KernelLabel<LHS>::get() + ", " +
+           KernelLabel<RHS>::get() + ")";
+  }
+};
+
+/// \brief specialisation of KernelLabel for the neighbour operation without
+/// filter
+template <typename OP, size_t Halo_T, size_t Halo_L, size_t Halo_B,
+          size_t Halo_R, typename RHS, size_t Cols, size_t Rows, size_t LfType,
+          size_t LVL>
+struct KernelLabel<StnNoFilt<OP, Halo_T, Halo_L, Halo_B, Halo_R, RHS, Cols,
+                             Rows, LfType, LVL>> {
+  static std::string get() {
+    return OpName<OP>::get() + "(" + KernelLabel<RHS>::get() + ")";
+  }
+};
+
+/// \brief specialisation of KernelLabel for the reduction
+template <typename OP, typename RHS, size_t Cols, size_t Rows, size_t LfType,
+          size_t LVL>
+struct KernelLabel<RDCN<OP, RHS, Cols, Rows, LfType, LVL>> {
+  static std::string get() {
+    return OpName<OP>::get() + "(" + KernelLabel<RHS>::get() + ")";
+  }
+};
+
+/// \brief specialisation of KernelLabel for the copy used by the pyramids
+template <typename LHS, typename RHS, size_t Cols, size_t Rows,
+          size_t OffsetColIn, size_t OffsetRowIn, size_t OffsetColOut,
+          size_t OffsetRowOut, size_t LfType, size_t LVL>
+struct KernelLabel<ParallelCopy<LHS, RHS, Cols, Rows, OffsetColIn, OffsetRowIn,
+                                OffsetColOut, OffsetRowOut, LfType, LVL>> {
+  static std::string get() {
+    return "ParallelCopy(" + KernelLabel<RHS>::get() + ")";
+  }
+};
+
+/// \brief specialisation of KernelLabel for the assign. The output of the
+/// kernel is always a terminal node, so only the assigned expression is
+/// written; a kernel assigning a terminal node is a copy.
+template <typename LHS, typename RHS, size_t Cols, size_t Rows, size_t LfType,
+          size_t LVL>
+struct KernelLabel<Assign<LHS, RHS, Cols, Rows, LfType, LVL>> {
+  static std::string get() {
+    auto label = KernelLabel<RHS>::get();
+    return label == "Leaf" ? "Copy(Leaf)" : label;
+  }
+};
+}  // internal
+
+/// \struct KernelRecord
+/// \brief KernelRecord holds the timing of one kernel submitted to a device.
+/// The times are in nanoseconds, measured by the clock of the device, and are
+/// only comparable with the other records of the same device.
+struct KernelRecord {
+  /// the operations computed by the kernel (see internal::KernelLabel)
+  std::string label;
+  /// the time the kernel started running
+  uint64_t start;
+  /// the time the kernel finished running
+  uint64_t end;
+
+  /// \brief returns the duration of the kernel
+  /// \return double: the duration in seconds
+  double seconds() const { return (end - start) * 1e-9; }
+};
+
+/// \class Profiler
+/// \brief Profiler collects a KernelRecord for each kernel submitted to a
+/// device while it is enabled. It is disabled by default. A device and its
+/// copies share the same profiler:
+/// \code
+///   dev.profiler().enable();
+///   visioncpp::execute<visioncpp::policy::Fuse, 8, 8, 8, 8>(expr, dev);
+///   dev.profiler().report(std::cout);
+/// \endcode
+/// The timestamps of a kernel may only be known once it has finished, so they
+/// are read the first time records() or report() is called, which waits for
+/// the kernels still running. A SYCL 1.2 queue has no profiling, so there the
+/// host waits for each kernel to time it: enabling the profiler makes the
+/// kernels of the queue run one at a time with the host.
+class Profiler {
+ public:
+  /// the function returning the start and end time of a kernel
+  using Stamps = std::function<std::pair<uint64_t, uint64_t>()>;
+
+ private:
+  mutable std::mutex lock;
+  /// read on each kernel launch, so it is not guarded by the lock
+  std::atomic<bool> on{false};
+  /// the kernels whose timestamps have not been read yet
+  std::vector<std::pair<std::string, Stamps>> pending;
+  std::vector<KernelRecord> done;
+
+  /// reads the timestamps of the pending kernels. lock must be held.
+  void resolve() {
+    for (auto &p : pending) {
+      auto stamps = p.second();
+      done.push_back(KernelRecord{std::move(p.first), stamps.first,
+                                  stamps.second});
+    }
+    pending.clear();
+  }
+
+ public:
+  /// \brief starts or stops recording the kernels
+  /// \param enabled: whether the kernels submitted from now are recorded
+  void enable(bool enabled = true) { on.store(enabled); }
+
+  /// \brief returns whether the kernels are being recorded
+  bool enabled() const { return on.load(std::memory_order_relaxed); }
+
+  /// \brief records a kernel. It is called by the devices.
+  /// \param label: the operations computed by the kernel
+  /// \param stamps: returns the start and end time of the kernel, waiting for
+  /// it when needed
+  void add(std::string label, Stamps stamps) {
+    std::lock_guard<std::mutex> guard(lock);
+    pending.emplace_back(std::move(label), std::move(stamps));
+  }
+
+  /// \brief removes all the records
+  void clear() {
+    std::lock_guard<std::mutex> guard(lock);
+    pending.clear();
+    done.clear();
+  }
+
+  /// \brief returns the kernels recorded so far, in submission order
+  /// \return std::vector<KernelRecord>
+  std::vector<KernelRecord> records() {
+    std::lock_guard<std::mutex> guard(lock);
+    resolve();
+    return done;
+  }
+
+  /// \brief prints the total time, the number of launches and the mean time
+  /// of each kernel label, the slowest first
+  /// \param os: the output stream
+  /// \return void
+  void report(std::ostream &os) {
+    struct Sum {
+      size_t count = 0;
+      double seconds = 0;
+    };
+    std::map<std::string, Sum> sums;
+    double total = 0;
+    for (const auto &r : records()) {
+      auto &s = sums[r.label];
+      s.count++;
+      s.seconds += r.seconds();
+      total += r.seconds();
+    }
+    std::vector<std::pair<std::string, Sum>> rows(sums.begin(), sums.end());
+    std::sort(rows.begin(), rows.end(),
+              [](const std::pair<std::string, Sum> &a,
+                 const std::pair<std::string, Sum> &b) {
+                return a.second.seconds > b.second.seconds;
+              });
+    auto flags = os.flags();
+    auto precision = os.precision();
+    os << std::fixed << std::setprecision(3);
+    os << "total(ms)   share  calls   mean(ms)  kernel\n";
+    for (const auto &row : rows) {
+      const auto &s = row.second;
+      os << std::setw(9) << s.seconds * 1e3 << std::setw(7)
+         << (total > 0 ? 100 * s.seconds / total : 0) << "%" << std::setw(7)
+         << s.count << std::setw(11) << s.seconds * 1e3 / s.count << "  "
+         << row.first << "\n";
+    }
+    os.flags(flags);
+    os.precision(precision);
+  }
+};
+}  // visioncpp
+#endif  // VISIONCPP_INCLUDE_FRAMEWORK_DEVICE_PROFILER_HPP_
@@ -21,6 +21,10 @@
 /// \brief This file contains the include headers for sycl devices
 #pragma once
 
+#include <future>
+#include <string>
+#include <vector>
+
 namespace visioncpp {
 namespace internal {
 /// \struct DeviceSelector
@@ -49,4 +53,5 @@ struct DeviceSelector<device::host> {
 }  // end internal
 }  // end visioncpp
 #include "extract_accessors.hpp"
+#include "sycl_event.hpp"
 #include "sycl_device.hpp"
@@ -25,6 +25,45 @@
 
 namespace visioncpp {
 namespace internal {
+/// \brief the name of the kernel of an expression executed on a batch of
+/// frames. It is different from the one of the single image kernel.
+template <typename Expr>
+struct BatchKernel;
+
+/// \struct KernelRange
+/// \brief KernelRange gives the name and the nd_range of the kernel of an
+/// expression.
+/// template parameters:
+/// \tparam Expr: the expression of the kernel
+/// \tparam Extent: the size of the images
+template <typename Expr, typename Extent>
+struct KernelRange {
+  static constexpr int Dim = Expr::Type::Dim;
+  using Name = Expr;
+  static inline cl::sycl::nd_range<Dim> get(size_t rGT, size_t cGT,
+                                            size_t RLT, size_t CLT,
+                                            const Extent &) {
+    return cl::sycl::nd_range<Dim>(get_range<Dim>(rGT, cGT),
+                                   get_range<Dim>(RLT, CLT));
+  }
+};
+
+/// \brief specialisation of KernelRange for a batch of frames. The frames are
+/// the third dimension of the kernel, with one work-group per frame in that
+/// dimension.
+template <typename Expr>
+struct KernelRange<Expr, BatchExtent> {
+  static_assert(Expr::Type::Dim == 2, "Only 2D images can be batched");
+  static constexpr int Dim = 3;
+  using Name = BatchKernel<Expr>;
+  static inline cl::sycl::nd_range<Dim> get(size_t rGT, size_t cGT,
+                                            size_t RLT, size_t CLT,
+                                            const BatchExtent &ext) {
+    return cl::sycl::nd_range<Dim>(
+        cl::sycl::range<Dim>(cGT, rGT, ext.frames()),
+        cl::sycl::range<Dim>(CLT, RLT, 1));
+  }
+};
 
 /// \brief specialisation Device_ for sycl
 /// \tparam device type supported by sycl
@@ -35,21 +74,102 @@ class Device_<backend::sycl, dv> {
 
  private:
   mutable QueueType dev;
+  /// when set, the events of the submitted kernels are recorded in it. It is
+  /// only set on the copy of the device made by each call of launch_async, so
+  /// concurrent calls record their kernels separately.
+  std::vector<cl::sycl::event> *recorder;
+  /// the memories of the intermediate results, shared by the copies of the
+  /// device
+  std::shared_ptr<BufferPool> buffers;
+  /// the timings of the kernels, shared by the copies of the device
+  std::shared_ptr<Profiler> prof;
+  /// the local memory of the device, in bytes
+  size_t localMem;
+
+  /// copies the device, recording the events of its kernels in events
+  Device_(const Device_ &d, std::vector<cl::sycl::event> *events)
+      : dev(d.dev),
+        recorder(events),
+        buffers(d.buffers),
+        prof(d.prof),
+        localMem(d.localMem) {}
+
+#if !VISIONCPP_SYCL_121
+  /// returns the current time of the host in nanoseconds
+  static uint64_t host_now() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+  }
+#endif
+
+  /// creates the queue of the device. With SYCL 1.2.1 it is created with the
+  /// profiling property, so that the start and end time of the kernels can be
+  /// read from their events.
+  static QueueType make_queue() {
+    auto handler = [=](cl::sycl::exception_list l) {
+      for (const auto &e : l) {
+        try {
+          std::rethrow_exception(e);
+        } catch (cl::sycl::exception e) {
+          std::cout << e.what() << std::endl;
+        }
+      }
+    };
+#if VISIONCPP_SYCL_121
+    return QueueType(DevType(), handler,
+                     cl::sycl::property_list{
+                         cl::sycl::property::queue::enable_profiling()});
+#else
+    return QueueType(DevType(), handler);
+#endif
+  }
 
  public:
+  /// the handle returned by execute_async
+  using Event = Event_<backend::sycl>;
+
   Device_()
-      : dev(QueueType(DevType(), [=](cl::sycl::exception_list l) {
-          for (const auto &e : l) {
-            try {
-              std::rethrow_exception(e);
-            } catch (cl::sycl::exception e) {
-              std::cout << e.what() << std::endl;
-            }
-          }
-        })) {}
+      : dev(make_queue()),
+        recorder(nullptr),
+        buffers(std::make_shared<BufferPool>()),
+        prof(std::make_shared<Profiler>()),
+        localMem(static_cast<size_t>(
+            dev.get_device()
+                .template get_info<cl::sycl::info::device::local_mem_size>())) {
+  }
+
+  /// \brief returns the pool of the memories used for the intermediate
+  /// results. They are kept between executions and can be released with
+  /// buffer_pool().clear().
+  BufferPool &buffer_pool() const { return *buffers; }
+
+  /// \brief returns the profiler recording the kernels of the device
+  Profiler &profiler() const { return *prof; }
+
+  /// \brief returns the number of frames of each execution on the device
+  static constexpr size_t frames() { return 1; }
+
+  /// \brief returns the local memory available to a workgroup, in bytes. The
+  /// kernels needing more are launched with a smaller local memory size.
+  size_t local_mem_size() const { return localMem; }
+
+  /// \brief returns the name of the device selected by the queue. It is used
+  /// to tell the devices apart in the autotuning cache.
+  std::string name() const {
+    return "sycl:" +
+           dev.get_device().template get_info<cl::sycl::info::device::name>();
+  }
+  /// \brief submits the kernel of the expression to the queue.
+  /// \param expr: the expression to be executed
+  /// \param extArg: the size of the images. By default the compile-time size of
+  /// the nodes is used and the global range is CGT x RGT; otherwise the global
+  /// range is deduced from the runtime size of the expression. A batch of
+  /// frames is executed by a single kernel of three dimensions, and a region
+  /// of interest by the work-groups covering it.
   template <size_t LC, size_t LR, size_t CGT, size_t RGT, size_t CLT,
-            size_t RLT, typename Expr>
-  void execute(Expr &expr) const {
+            size_t RLT, typename Expr, typename Extent = StaticExtent>
+  void execute(Expr &expr, Extent extArg = Extent()) const {
     /// generating the short class name for the AMD gpu
     constexpr size_t TotalLeaves = LeafCount<Expr::ND_Category, Expr>::Count;
     /// replacing the the leaf node in the expression tree with a placeholder
@@ -57,9 +177,24 @@ class Device_<backend::sycl, dv> {
     using placeHolderExprType =
         typename MakePlaceHolderExprHelper<Expr::ND_Category, Expr,
                                            TotalLeaves - 1>::Type;
+    const Extent ext =
+        kernel_extent<LC, LR, Expr::CThread, Expr::RThread>(extArg);
+    const size_t cGT =
+        get_global_threads<LC, CLT>(kernel_cols<Expr::CThread>(ext));
+    const size_t rGT =
+        get_global_threads<LR, RLT>(kernel_rows<Expr::RThread>(ext));
 
+    /// the label is only built when the kernel is traced
+    const bool traced = trace::enabled();
+    TraceScope scope("kernel", traced ? KernelLabel<Expr>::get() : "",
+                     traced ? "\"global\":[" + std::to_string(cGT) + "," +
+                                  std::to_string(rGT) + "]"
+                            : "");
+#if !VISIONCPP_SYCL_121
+    const uint64_t submitted = host_now();
+#endif
     /// submitting the lambda expression to the sycl queue.
-    dev.submit([&](cl::sycl::handler &cgh) {
+    auto event = dev.submit([&](cl::sycl::handler &cgh) {
 
       /// creating global accessors on all input output buffers
       auto global_accessor_tuple = extract_accessors(cgh, expr);
@@ -74,23 +209,61 @@ class Device_<backend::sycl, dv> {
                                                device_only_accessor_tuple);
       /// submitting the kernel lambda to the parallel
 
-      cgh.parallel_for<Expr>(
-          cl::sycl::nd_range<Expr::Type::Dim>(
-              visioncpp::internal::get_range<Expr::Type::Dim>(RGT, CGT),
-              visioncpp::internal::get_range<Expr::Type::Dim>(RLT, CLT)),
-          [=](cl::sycl::nd_item<Expr::Type::Dim> itemID) {
+      using Range = KernelRange<Expr, Extent>;
+      cgh.parallel_for<typename Range::Name>(
+          Range::get(rGT, cGT, RLT, CLT, ext),
+          [=](cl::sycl::nd_item<Range::Dim> itemID) {
             /// creating the index access for each thread
-            auto cOffset = visioncpp::internal::memLocation<LC, LR>(itemID);
+            auto cOffset = visioncpp::internal::memLocation<LC, LR>(itemID, ext);
 
             /// creating the eval expression for evaluating the expression
             /// tree. The output now moved to the front so the Output_offset
             /// should be reduced by one.
-            eval<Output_offset, LC, LR, placeHolderExprType>(cOffset,
-                                                             device_tuple);
+            eval_tile<Output_offset, LC, LR, placeHolderExprType>(
+                cOffset, device_tuple);
           });
     });
+    if (recorder) {
+      recorder->push_back(event);
+    }
+    if (prof->enabled()) {
+#if VISIONCPP_SYCL_121
+      prof->add(KernelLabel<Expr>::get(), [event]() mutable {
+        using Info = cl::sycl::info::event_profiling;
+        event.wait();
+        return std::make_pair(
+            static_cast<uint64_t>(
+                event.template get_profiling_info<Info::command_start>()),
+            static_cast<uint64_t>(
+                event.template get_profiling_info<Info::command_end>()));
+      });
+#else
+      /// the SYCL 1.2 queue has no profiling, so the kernel is timed on the
+      /// host from its submission to its end. The host waits for it, which
+      /// serialises the queue while the profiler is enabled.
+      event.wait();
+      const uint64_t end = host_now();
+      prof->add(KernelLabel<Expr>::get(), [submitted, end]() {
+        return std::make_pair(submitted, end);
+      });
+#endif
+    }
     dev.throw_asynchronous();
   }
+
+  /// \brief runs the launch function and returns a handle on all the kernels
+  /// it has submitted to the queue. The sycl queue is already asynchronous, so
+  /// the kernels are only recorded here and the host does not wait for them.
+  /// The launch function receives a copy of the device sharing its queue.
+  /// \param launch: a function submitting the kernels of an expression to the
+  /// device passed to it
+  /// \return Event
+  template <typename Launch>
+  Event launch_async(Launch launch) const {
+    std::vector<cl::sycl::event> events;
+    launch(Device_(*this, &events));
+    return Event(std::move(events));
+  }
 };
 }  // namespace internal
 }  // namespace visioncpp
@@ -0,0 +1,81 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file sycl_event.hpp
+/// \brief This file contains the handle returned by execute_async when the
+/// expression is run on the sycl backend.
+
+#ifndef VISIONCPP_INCLUDE_FRAMEWORK_DEVICE_SYCL_SYCL_EVENT_HPP_
+#define VISIONCPP_INCLUDE_FRAMEWORK_DEVICE_SYCL_SYCL_EVENT_HPP_
+
+namespace visioncpp {
+namespace internal {
+
+/// \brief specialisation of Event_ for sycl. It holds the sycl events of all
+/// the kernels submitted for one expression. The kernels of two expressions
+/// sharing a terminal node are already ordered by the sycl runtime through
+/// their buffers, so no explicit dependency is needed to chain them.
+template <>
+class Event_<backend::sycl> {
+ private:
+  std::vector<cl::sycl::event> events;
+
+ public:
+  Event_() = default;
+  explicit Event_(std::vector<cl::sycl::event> evs) : events(std::move(evs)) {}
+
+  /// \brief blocks until all the kernels of the expression have finished.
+  /// Asynchronous errors raised by the kernels are thrown from here.
+  /// \return void
+  void wait() {
+    TraceScope scope("wait", "wait");
+    for (auto &e : events) {
+      e.wait_and_throw();
+    }
+  }
+
+  /// \brief polls the kernels of the expression without blocking
+  /// \return bool: true when all the kernels have finished
+  bool is_complete() const {
+    for (const auto &e : events) {
+      auto status =
+          e.get_info<cl::sycl::info::event::command_execution_status>();
+      if (status != cl::sycl::info::event_command_status::complete) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /// \brief chains a host function to the expression. The function is run on
+  /// a separate thread once all the kernels of the expression have finished.
+  /// \param f: the host function to be run
+  /// \return std::future holding the result of f
+  template <typename F>
+  auto then(F f) -> std::future<decltype(f())> {
+    Event_ self = *this;
+    return std::async(std::launch::async, [self, f]() mutable {
+      self.wait();
+      return f();
+    });
+  }
+};
+}  // namespace internal
+}  // namespace visioncpp
+#endif  // VISIONCPP_INCLUDE_FRAMEWORK_DEVICE_SYCL_SYCL_EVENT_HPP_
@@ -0,0 +1,230 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file extract_host_accessors.hpp
+/// \brief This file is used to provide an access mechanism for terminal nodes
+/// on the host when the expression is executed by the threads backend.
+
+#ifndef VISIONCPP_INCLUDE_FRAMEWORK_DEVICE_THREADS_EXTRACT_HOST_ACCESSORS_HPP_
+#define VISIONCPP_INCLUDE_FRAMEWORK_DEVICE_THREADS_EXTRACT_HOST_ACCESSORS_HPP_
+
+namespace visioncpp {
+namespace internal {
+namespace threads {
+/// \struct HostMemoryAccess
+/// \brief HostMemoryAccess is used to create the HostTileAccessor of a
+/// VisionMemory. The sycl host accessor created on the buffer is kept alive by
+/// the HostTileAccessor until the kernel is finished.
+/// template parameters:
+/// \tparam AccMd: the access mode required by the kernel
+/// \tparam Memory: the VisionMemory type
+/// \tparam LeafType: the memory type of the VisionMemory
+template <cl::sycl::access::mode AccMd, typename Memory,
+          size_t LeafType = Memory::LeafType>
+struct HostMemoryAccess {
+  using Accessor = HostTileAccessor<typename Memory::ElementType, Memory::Dim,
+                                    Memory::scope>;
+  static Accessor get(Memory &mem) {
+    using HostAcc = typename Memory::template HostAccessor<AccMd>;
+    return Accessor(std::make_shared<HostAcc>(*mem.syclData));
+  }
+};
+/// \brief specialisation of the HostMemoryAccess when the memory_type is
+/// constant variable. The ConstMemory is passed by value to the kernel.
+template <cl::sycl::access::mode AccMd, typename Memory>
+struct HostMemoryAccess<AccMd, Memory, memory_type::Const> {
+  using Accessor = typename Memory::template Accessor<AccMd>;
+  static Accessor get(Memory &mem) { return Accessor(*mem.syclData); }
+};
+/// \brief specialisation of the HostMemoryAccess when the memory_type is
+/// Pitched2D. The row pitch of the memory is passed with its accessor.
+template <cl::sycl::access::mode AccMd, typename Memory>
+struct HostMemoryAccess<AccMd, Memory, memory_type::Pitched2D> {
+  using Accessor = PitchedAccessor<HostTileAccessor<
+      typename Memory::ElementType, Memory::Dim, Memory::scope>>;
+  static Accessor get(Memory &mem) {
+    return Accessor(
+        HostMemoryAccess<AccMd, Memory, memory_type::Buffer1D>::get(mem),
+        mem.pitch);
+  }
+};
+/// \brief specialisation of the HostMemoryAccess when the memory_type is
+/// Image. The texels are accessed through a host image accessor.
+template <cl::sycl::access::mode AccMd, typename Memory>
+struct HostMemoryAccess<AccMd, Memory, memory_type::Image> {
+  using HostAcc = typename Memory::template HostAccessor<AccMd>;
+  using Accessor = ImageAccessor<HostAcc, typename Memory::ElementType>;
+  static Accessor get(Memory &mem) {
+    return Accessor(HostAcc(*mem.syclData), mem.pitch);
+  }
+};
+
+/// \brief specialisation of the HostMemoryAccess when the memory_type is
+/// Planar2D. The channels are accessed in their planes.
+template <cl::sycl::access::mode AccMd, typename Memory>
+struct HostMemoryAccess<AccMd, Memory, memory_type::Planar2D> {
+  using Accessor =
+      PlanarAccessor<HostTileAccessor<typename Memory::Scalar, Memory::Dim,
+                                      Memory::scope>,
+                     typename Memory::ElementType>;
+  static Accessor get(Memory &mem) {
+    using HostAcc = typename Memory::template HostAccessor<AccMd>;
+    return Accessor(
+        HostTileAccessor<typename Memory::Scalar, Memory::Dim, Memory::scope>(
+            std::make_shared<HostAcc>(*mem.syclData)),
+        mem.syclData->get_count() / Memory::Channels);
+  }
+};
+
+/// \brief The ExtractHostAccessor struct is used to extract the host accessor
+/// from the leafnodes and pack them in a tuple by using the same in-order
+/// traverse algorithm used by the ExtractAccessor of the sycl backend.
+/// Therefore, the placeholder numbers given to the leaf nodes by
+/// MakePlaceHolderExprHelper are valid for this tuple as well.
+template <size_t Category, typename Expr>
+struct ExtractHostAccessor;
+
+/// \brief Specialisation of ExtractHostAccessor class where the expression
+/// node is LeafNode.
+template <typename RHS, size_t LVL>
+struct ExtractHostAccessor<expr_category::Unary, LeafNode<RHS, LVL>> {
+  /// getting read access when the leaf node is accessed by traversing the
+  /// right-hand side of an Assign or ParallelCopy (partial Assign) expression
+  static tools::tuple::Tuple<
+      typename HostMemoryAccess<cl::sycl::access::mode::read, RHS>::Accessor>
+  getTuple(TileHandler &, LeafNode<RHS, LVL> &expr) {
+    return HostMemoryAccess<cl::sycl::access::mode::read, RHS>::get(
+        expr.vilibMemory);
+  }
+  /// getting write access when the leaf node is accessed by traversing the
+  /// left-hand side of ParallelCopy(partial assign) expression
+  static tools::tuple::Tuple<
+      typename HostMemoryAccess<cl::sycl::access::mode::write, RHS>::Accessor>
+  getWriteTuple(TileHandler &, LeafNode<RHS, LVL> &expr) {
+    return HostMemoryAccess<cl::sycl::access::mode::write, RHS>::get(
+        expr.vilibMemory);
+  }
+  /// getting discard_write access when the leaf node is accessed by traversing
+  /// the left-hand side of an Assign expression
+  static tools::tuple::Tuple<typename HostMemoryAccess<
+      cl::sycl::access::mode::discard_write, RHS>::Accessor>
+  getDiscardWriteTuple(TileHandler &, LeafNode<RHS, LVL> &expr) {
+    return HostMemoryAccess<cl::sycl::access::mode::discard_write, RHS>::get(
+        expr.vilibMemory);
+  }
+};
+
+/// \brief Specialisation of ExtractHostAccessor class where the expression
+/// node has one child
+template <typename Expr>
+struct ExtractHostAccessor<expr_category::Unary, Expr> {
+  static auto getTuple(TileHandler &cgh, Expr &expr)
+      -> decltype(ExtractHostAccessor<Expr::RHSExpr::ND_Category,
+                                      typename Expr::RHSExpr>::getTuple(cgh,
+                                                                        expr.rhs)) {
+    return ExtractHostAccessor<Expr::RHSExpr::ND_Category,
+                               typename Expr::RHSExpr>::getTuple(cgh, expr.rhs);
+  }
+};
+
+/// \brief Specialisation of ExtractHostAccessor class where the expression
+/// node has two children
+template <typename Expr>
+struct ExtractHostAccessor<expr_category::Binary, Expr> {
+  static auto getTuple(TileHandler &cgh, Expr &expr)
+      -> decltype(tools::tuple::append(
+          ExtractHostAccessor<Expr::LHSExpr::ND_Category,
+                              typename Expr::LHSExpr>::getTuple(cgh, expr.lhs),
+          ExtractHostAccessor<Expr::RHSExpr::ND_Category,
+                              typename Expr::RHSExpr>::getTuple(cgh,
+                                                                expr.rhs))) {
+    auto LHSTuple =
+        ExtractHostAccessor<Expr::LHSExpr::ND_Category,
+                            typename Expr::LHSExpr>::getTuple(cgh, expr.lhs);
+    auto RHSTuple =
+        ExtractHostAccessor<Expr::RHSExpr::ND_Category,
+                            typename Expr::RHSExpr>::getTuple(cgh, expr.rhs);
+    return tools::tuple::append(LHSTuple, RHSTuple);
+  }
+};
+
+/// \brief Specialisation of ExtractHostAccessor class where the expression
+/// node is Assign
+template <typename LHSExpr, typename RHSExpr, size_t Cols, size_t Rows,
+          size_t LeafType, size_t LVL>
+struct ExtractHostAccessor<
+    expr_category::Binary, Assign<LHSExpr, RHSExpr, Cols, Rows, LeafType, LVL>> {
+  static auto getTuple(
+      TileHandler &cgh,
+      Assign<LHSExpr, RHSExpr, Cols, Rows, LeafType, LVL> &expr)
+      -> decltype(tools::tuple::append(
+          ExtractHostAccessor<LHSExpr::ND_Category,
+                              LHSExpr>::getDiscardWriteTuple(cgh, expr.lhs),
+          ExtractHostAccessor<RHSExpr::ND_Category, RHSExpr>::getTuple(
+              cgh, expr.rhs))) {
+    auto LHSTuple = ExtractHostAccessor<
+        LHSExpr::ND_Category, LHSExpr>::getDiscardWriteTuple(cgh, expr.lhs);
+    auto RHSTuple =
+        ExtractHostAccessor<RHSExpr::ND_Category, RHSExpr>::getTuple(cgh,
+                                                                     expr.rhs);
+    return tools::tuple::append(LHSTuple, RHSTuple);
+  }
+};
+
+/// \brief Specialisation of ExtractHostAccessor class where the expression
+/// node is a ParallelCopy (partial assign)
+template <typename LHSExpr, typename RHSExpr, size_t Cols, size_t Rows,
+          size_t OffsetColIn, size_t OffsetRowIn, size_t OffsetColOut,
+          size_t OffsetRowOut, size_t LeafType, size_t LVL>
+struct ExtractHostAccessor<
+    expr_category::Binary,
+    ParallelCopy<LHSExpr, RHSExpr, Cols, Rows, OffsetColIn, OffsetRowIn,
+                 OffsetColOut, OffsetRowOut, LeafType, LVL>> {
+  static auto getTuple(
+      TileHandler &cgh,
+      ParallelCopy<LHSExpr, RHSExpr, Cols, Rows, OffsetColIn, OffsetRowIn,
+                   OffsetColOut, OffsetRowOut, LeafType, LVL> &expr)
+      -> decltype(tools::tuple::append(
+          ExtractHostAccessor<LHSExpr::ND_Category, LHSExpr>::getWriteTuple(
+              cgh, expr.lhs),
+          ExtractHostAccessor<RHSExpr::ND_Category, RHSExpr>::getTuple(
+              cgh, expr.rhs))) {
+    auto LHSTuple =
+        ExtractHostAccessor<LHSExpr::ND_Category, LHSExpr>::getWriteTuple(
+            cgh, expr.lhs);
+    auto RHSTuple =
+        ExtractHostAccessor<RHSExpr::ND_Category, RHSExpr>::getTuple(cgh,
+                                                                     expr.rhs);
+    return tools::tuple::append(LHSTuple, RHSTuple);
+  }
+};
+
+/// \brief template deduction function for ExtractHostAccessor
+/// \param cgh: the threads backend handler
+/// \param e: the expression
+/// \return Tuple
+template <typename Expr>
+auto extract_host_accessors(TileHandler &cgh, Expr &e) -> decltype(
+    ExtractHostAccessor<Expr::ND_Category, Expr>::getTuple(cgh, e)) {
+  return ExtractHostAccessor<Expr::ND_Category, Expr>::getTuple(cgh, e);
+}
+}  // threads
+}  // internal
+}  // visioncpp
+#endif  // VISIONCPP_INCLUDE_FRAMEWORK_DEVICE_THREADS_EXTRACT_HOST_ACCESSORS_HPP_
@@ -0,0 +1,131 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file host_accessor.hpp
+/// \brief This file contains the host side accessors, pointers and work-item
+/// used to run the evaluators on the threads backend.
+
+#ifndef VISIONCPP_INCLUDE_FRAMEWORK_DEVICE_THREADS_HOST_ACCESSOR_HPP_
+#define VISIONCPP_INCLUDE_FRAMEWORK_DEVICE_THREADS_HOST_ACCESSOR_HPP_
+
+namespace visioncpp {
+namespace internal {
+namespace threads {
+/// \struct TileHandler
+/// \brief TileHandler plays the role of the sycl command group handler for the
+/// threads backend. It is used to select the host version of the accessors when
+/// the accessor tuple of an expression is built.
+struct TileHandler {};
+
+/// \struct TilePointer
+/// \brief TilePointer is used to determine the pointer type returned by a
+/// HostTileAccessor. The pointer types match the ones returned by the sycl
+/// accessors so that the LocalNeighbour, GlobalNeighbour and ConstNeighbour
+/// can be constructed in the same way for both backends.
+/// template parameters:
+/// \tparam T: the element type
+/// \tparam Sc: the visioncpp scope of the memory
+template <typename T, size_t Sc>
+struct TilePointer {
+  using Type = cl::sycl::global_ptr<T>;
+};
+/// \brief specialisation of the TilePointer when the memory is local
+template <typename T>
+struct TilePointer<T, scope::Local> {
+  using Type = cl::sycl::local_ptr<T>;
+};
+/// \brief specialisation of the TilePointer when the memory is constant
+template <typename T>
+struct TilePointer<T, scope::Constant> {
+  using Type = cl::sycl::constant_ptr<T>;
+};
+
+/// \struct HostTileAccessor
+/// \brief HostTileAccessor gives the evaluators access to a memory on the host.
+/// For an input/output memory it holds a sycl host accessor on the buffer for
+/// the lifetime of the kernel. For a local memory it owns a scratch memory
+/// private to the worker thread running the tile.
+/// template parameters:
+/// \tparam ElementType: the type of each element of the memory
+/// \tparam Dim: the dimension of the memory
+/// \tparam Sc: the visioncpp scope of the memory
+template <typename ElementType, int Dim, size_t Sc>
+struct HostTileAccessor {
+  using value_type = ElementType;
+  using PointerType = typename TilePointer<ElementType, Sc>::Type;
+  /// \brief constructs the accessor on top of a sycl host accessor
+  /// \param hostAcc: the host accessor of the buffer
+  template <typename HostAcc>
+  explicit HostTileAccessor(std::shared_ptr<HostAcc> hostAcc)
+      : storage(hostAcc), ptr(hostAcc->get_pointer()) {}
+  /// \brief constructs the per-thread scratch memory used as a local memory
+  /// \param rng: the range of the local memory
+  HostTileAccessor(cl::sycl::range<Dim> rng, TileHandler &)
+      : storage(new ElementType[rng.size()],
+                std::default_delete<ElementType[]>()),
+        ptr(static_cast<ElementType *>(storage.get())) {}
+  /// \brief returns the pointer used by the evaluators to access the memory
+  /// \return PointerType
+  PointerType get_pointer() const { return PointerType(ptr); }
+
+ private:
+  std::shared_ptr<void> storage;
+  ElementType *ptr;
+};
+
+/// \struct TileItem
+/// \brief TileItem plays the role of the sycl nd_item for the threads backend.
+/// Each tile of LC x LR elements is computed by a single worker thread, so the
+/// work-group is made of one work-item and the barriers have nothing to wait
+/// for.
+struct TileItem {
+  /// \param groupC: the column index of the tile
+  /// \param groupR: the row index of the tile
+  /// \param frame: the frame of the tile when a batch of frames is executed
+  TileItem(size_t groupC, size_t groupR, size_t frame = 0)
+      : group{groupC, groupR, frame} {}
+  cl::sycl::range<2> get_local_range() const {
+    return cl::sycl::range<2>(1, 1);
+  }
+  size_t get_local(int) const { return 0; }
+  size_t get_group(int dim) const { return group[dim]; }
+  void barrier(cl::sycl::access::fence_space) const {}
+
+ private:
+  size_t group[3];
+};
+}  // threads
+
+/// \brief specialisation of the LocalAccessor when the kernel is built for the
+/// threads backend. The local memory is a scratch memory of the worker thread.
+template <typename ElementType, size_t Dim>
+struct LocalAccessor<threads::TileHandler, ElementType, Dim> {
+  using Type = threads::HostTileAccessor<ElementType, Dim, scope::Local>;
+};
+
+/// specialisation of the Trait class when the accessor is a HostTileAccessor
+template <typename ElementType, int dimensions, size_t Sc>
+struct Trait<threads::HostTileAccessor<ElementType, dimensions, Sc>> {
+  using Type = ElementType;
+  static constexpr int Dim = dimensions;
+  static constexpr size_t scope = Sc;
+};
+}  // internal
+}  // visioncpp
+#endif  // VISIONCPP_INCLUDE_FRAMEWORK_DEVICE_THREADS_HOST_ACCESSOR_HPP_
@@ -0,0 +1,142 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file serial_queue.hpp
+/// \brief This file contains the in-order queue used by the threads backend to
+/// run the expressions submitted by execute_async.
+
+#ifndef VISIONCPP_INCLUDE_FRAMEWORK_DEVICE_THREADS_SERIAL_QUEUE_HPP_
+#define VISIONCPP_INCLUDE_FRAMEWORK_DEVICE_THREADS_SERIAL_QUEUE_HPP_
+
+namespace visioncpp {
+namespace internal {
+namespace threads {
+/// \class SerialQueue
+/// \brief SerialQueue runs the submitted jobs one after the other on a single
+/// std::thread, in submission order. This gives the threads backend the same
+/// ordering guarantee as an in-order sycl queue: an expression submitted after
+/// another one sees all of its results. The thread is only created when the
+/// first job is submitted, and it finishes the pending jobs before the queue is
+/// destroyed.
+class SerialQueue {
+ public:
+  SerialQueue() : busy(false), stop(false) {}
+
+  SerialQueue(const SerialQueue &) = delete;
+  SerialQueue &operator=(const SerialQueue &) = delete;
+
+  ~SerialQueue() {
+    {
+      std::lock_guard<std::mutex> lock(mtx);
+      stop = true;
+    }
+    wake.notify_all();
+    if (worker.joinable()) {
+      worker.join();
+    }
+  }
+
+  /// function enqueue
+  /// \brief adds the job at the end of the queue without waiting for it
+  /// \param job: the job to be run
+  /// \return std::shared_future which becomes ready once the job has run. It
+  /// holds the exception thrown by the job, if any.
+  std::shared_future<void> enqueue(std::function<void()> job) {
+    auto done = std::make_shared<std::promise<void>>();
+    std::shared_future<void> result = done->get_future().share();
+    {
+      std::lock_guard<std::mutex> lock(mtx);
+      if (!worker.joinable()) {
+        worker = std::thread([this]() { worker_loop(); });
+      }
+      /// the job is released before the future becomes ready, so that the
+      /// memories it holds have written their result back to the host when
+      /// the caller stops waiting
+      jobs.push_back([job, done]() mutable {
+        std::exception_ptr error;
+        try {
+          job();
+        } catch (...) {
+          error = std::current_exception();
+        }
+        job = nullptr;
+        if (error) {
+          done->set_exception(error);
+        } else {
+          done->set_value();
+        }
+      });
+    }
+    wake.notify_one();
+    return result;
+  }
+
+  /// \brief blocks until all the submitted jobs have run
+  /// \return void
+  void wait_idle() {
+    std::unique_lock<std::mutex> lock(mtx);
+    idle.wait(lock, [this]() { return jobs.empty() && !busy; });
+  }
+
+  /// \brief returns true when called from a job of the queue
+  /// \return bool
+  bool on_queue_thread() const {
+    return worker.get_id() == std::this_thread::get_id();
+  }
+
+ private:
+  /// \brief the loop executed by the thread of the queue
+  void worker_loop() {
+    for (;;) {
+      std::function<void()> job;
+      {
+        std::unique_lock<std::mutex> lock(mtx);
+        wake.wait(lock, [this]() { return stop || !jobs.empty(); });
+        if (jobs.empty()) {
+          return;
+        }
+        job = std::move(jobs.front());
+        jobs.pop_front();
+        busy = true;
+      }
+      /// the exception thrown by the job is stored in its future
+      job();
+      job = nullptr;
+      {
+        std::lock_guard<std::mutex> lock(mtx);
+        busy = false;
+        if (jobs.empty()) {
+          idle.notify_all();
+        }
+      }
+    }
+  }
+
+  std::thread worker;
+  std::deque<std::function<void()>> jobs;
+  std::mutex mtx;
+  std::condition_variable wake;
+  std::condition_variable idle;
+  bool busy;
+  bool stop;
+};
+}  // threads
+}  // internal
+}  // visioncpp
+#endif  // VISIONCPP_INCLUDE_FRAMEWORK_DEVICE_THREADS_SERIAL_QUEUE_HPP_
@@ -0,0 +1,136 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file thread_pool.hpp
+/// \brief This file contains the persistent pool of worker threads used by the
+/// threads backend to run the tiles of a kernel.
+
+#ifndef VISIONCPP_INCLUDE_FRAMEWORK_DEVICE_THREADS_THREAD_POOL_HPP_
+#define VISIONCPP_INCLUDE_FRAMEWORK_DEVICE_THREADS_THREAD_POOL_HPP_
+
+namespace visioncpp {
+namespace internal {
+/// \brief Internal scope of the native multithreaded cpu backend.
+namespace threads {
+/// \class ThreadPool
+/// \brief ThreadPool is a set of std::thread workers created once, when the
+/// device is created, and kept alive until the device is destroyed. Each
+/// kernel is submitted to all the workers at once; the workers then share the
+/// tiles of the kernel between themselves. This way no thread is created per
+/// kernel launch.
+class ThreadPool {
+ public:
+  /// \param workerCount: the number of worker threads in the pool
+  explicit ThreadPool(size_t workerCount)
+      : task(nullptr), generation(0), pending(0), stop(false) {
+    for (size_t i = 0; i < workerCount; i++) {
+      workers.emplace_back([this, i]() { worker_loop(i); });
+    }
+  }
+
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+
+  ~ThreadPool() {
+    {
+      std::lock_guard<std::mutex> lock(mtx);
+      stop = true;
+    }
+    wake.notify_all();
+    for (auto &worker : workers) {
+      worker.join();
+    }
+  }
+
+  /// \brief returns the number of worker threads in the pool
+  /// \return size_t
+  size_t size() const { return workers.size(); }
+
+  /// function run
+  /// \brief runs the job once on every worker and blocks until all of them
+  /// have finished. The job receives the index of the worker running it. The
+  /// first exception thrown by the job is rethrown on the calling thread.
+  /// \param job: the job to be run by each worker
+  /// \return void
+  void run(const std::function<void(size_t)> &job) {
+    std::lock_guard<std::mutex> submitLock(submitMtx);
+    std::unique_lock<std::mutex> lock(mtx);
+    task = &job;
+    pending = workers.size();
+    error = nullptr;
+    ++generation;
+    wake.notify_all();
+    done.wait(lock, [this]() { return pending == 0; });
+    task = nullptr;
+    if (error) {
+      std::exception_ptr e = error;
+      error = nullptr;
+      std::rethrow_exception(e);
+    }
+  }
+
+ private:
+  /// \brief the loop executed by each worker. A worker sleeps until a new job
+  /// is submitted or the pool is destroyed.
+  /// \param id: the index of the worker
+  void worker_loop(size_t id) {
+    size_t seen = 0;
+    for (;;) {
+      const std::function<void(size_t)> *job;
+      {
+        std::unique_lock<std::mutex> lock(mtx);
+        wake.wait(lock, [this, &seen]() { return stop || generation != seen; });
+        if (stop) {
+          return;
+        }
+        seen = generation;
+        job = task;
+      }
+      try {
+        (*job)(id);
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(mtx);
+        if (!error) {
+          error = std::current_exception();
+        }
+      }
+      {
+        std::lock_guard<std::mutex> lock(mtx);
+        if (--pending == 0) {
+          done.notify_one();
+        }
+      }
+    }
+  }
+
+  std::vector<std::thread> workers;
+  std::mutex submitMtx;
+  std::mutex mtx;
+  std::condition_variable wake;
+  std::condition_variable done;
+  const std::function<void(size_t)> *task;
+  size_t generation;
+  size_t pending;
+  bool stop;
+  std::exception_ptr error;
+};
+}  // threads
+}  // internal
+}  // visioncpp
+#endif  // VISIONCPP_INCLUDE_FRAMEWORK_DEVICE_THREADS_THREAD_POOL_HPP_
@@ -0,0 +1,190 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file threads_device.hpp
+/// \brief This file contains the native multithreaded cpu device. It runs the
+/// expression tree on a persistent pool of std::thread workers without going
+/// through an OpenCL queue or driver. The memories of the expression are still
+/// cl::sycl::buffers read through host accessors, so the SYCL runtime is still
+/// linked and initialised.
+
+#ifndef VISIONCPP_INCLUDE_FRAMEWORK_DEVICE_THREADS_THREADS_DEVICE_HPP_
+#define VISIONCPP_INCLUDE_FRAMEWORK_DEVICE_THREADS_THREADS_DEVICE_HPP_
+
+namespace visioncpp {
+namespace internal {
+
+/// \brief specialisation Device_ for the threads backend. The kernel is split
+/// into the same LC x LR tiles as the sycl work-groups. Each tile is computed
+/// by a single worker thread using the evaluators of the sycl backend, and the
+/// local memory of the tile is mapped to a scratch memory of the worker.
+/// The global memories are the cl::sycl::buffers of the terminals, which are
+/// accessed on the host, so a program using only this backend still needs the
+/// SYCL runtime, although it never creates a cl::sycl::queue.
+/// \tparam dv: the device type. Only cpu and host are supported.
+template <device dv>
+class Device_<backend::threads, dv> {
+  static_assert(dv != device::gpu,
+                "The threads backend can only run on the cpu or the host");
+
+ private:
+  std::shared_ptr<threads::ThreadPool> pool;
+  /// the in-order queue running the expressions of execute_async. It is null
+  /// for the copy of the device used inside the queue itself.
+  std::shared_ptr<threads::SerialQueue> stream;
+  /// the memories of the intermediate results, shared by the copies of the
+  /// device
+  std::shared_ptr<BufferPool> buffers;
+  /// the timings of the kernels, shared by the copies of the device
+  std::shared_ptr<Profiler> prof;
+
+  Device_(std::shared_ptr<threads::ThreadPool> p,
+          std::shared_ptr<threads::SerialQueue> s,
+          std::shared_ptr<BufferPool> b, std::shared_ptr<Profiler> f)
+      : pool(std::move(p)),
+        stream(std::move(s)),
+        buffers(std::move(b)),
+        prof(std::move(f)) {}
+
+  /// returns the current time of the device in nanoseconds
+  static uint64_t now() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+  }
+
+ public:
+  /// the handle returned by execute_async
+  using Event = Event_<backend::threads>;
+
+  /// \brief creates the device with one worker per hardware thread
+  Device_() : Device_(std::thread::hardware_concurrency()) {}
+  /// \brief creates the device with the given number of workers
+  /// \param workers: the number of worker threads
+  explicit Device_(size_t workers)
+      : Device_(
+            std::make_shared<threads::ThreadPool>(workers > 0 ? workers : 1),
+            std::make_shared<threads::SerialQueue>(),
+            std::make_shared<BufferPool>(), std::make_shared<Profiler>()) {}
+
+  /// \brief returns the pool of the memories used for the intermediate
+  /// results. They are kept between executions and can be released with
+  /// buffer_pool().clear().
+  BufferPool &buffer_pool() const { return *buffers; }
+
+  /// \brief returns the profiler recording the kernels of the device
+  Profiler &profiler() const { return *prof; }
+
+  /// \brief returns the number of frames of each execution on the device
+  static constexpr size_t frames() { return 1; }
+
+  /// \brief returns the local memory available to a workgroup, in bytes. The
+  /// local memories of the tiles are allocated on the host, so it has no
+  /// limit.
+  static constexpr size_t local_mem_size() {
+    return std::numeric_limits<size_t>::max();
+  }
+
+  /// \brief returns the name of the device, including its number of workers.
+  /// It is used to tell the devices apart in the autotuning cache.
+  std::string name() const {
+    return "threads:" + std::to_string(pool->size());
+  }
+
+  /// \brief runs the kernel of the expression on the thread pool.
+  /// \param expr: the expression to be executed
+  /// \param extArg: the size of the images. By default the compile-time size of
+  /// the nodes is used; otherwise the number of tiles is deduced from the
+  /// runtime size of the expression. For a batch of frames, each frame has
+  /// its own tiles, and for a region of interest only the tiles covering it
+  /// are computed.
+  template <size_t LC, size_t LR, size_t CGT, size_t RGT, size_t CLT,
+            size_t RLT, typename Expr, typename Extent = StaticExtent>
+  void execute(Expr &expr, Extent extArg = Extent()) const {
+    constexpr size_t TotalLeaves = LeafCount<Expr::ND_Category, Expr>::Count;
+    /// replacing the the leaf node in the expression tree with a placeholder
+    /// number
+    using placeHolderExprType =
+        typename MakePlaceHolderExprHelper<Expr::ND_Category, Expr,
+                                           TotalLeaves - 1>::Type;
+    const Extent ext =
+        kernel_extent<LC, LR, Expr::CThread, Expr::RThread>(extArg);
+    /// the number of tiles is the number of sycl work-groups
+    const size_t CGroups =
+        get_global_threads<LC, CLT>(kernel_cols<Expr::CThread>(ext)) / CLT;
+    const size_t RGroups =
+        get_global_threads<LR, RLT>(kernel_rows<Expr::RThread>(ext)) / RLT;
+    const size_t Tiles = CGroups * RGroups * ext.frames();
+
+    /// a synchronous execute must see the results of the expressions
+    /// submitted before it by execute_async
+    if (stream) {
+      TraceScope scope("wait", "wait_idle");
+      stream->wait_idle();
+    }
+    /// the label is only built when the kernel is traced
+    const bool traced = trace::enabled();
+    TraceScope scope("kernel", traced ? KernelLabel<Expr>::get() : "",
+                     traced ? "\"tiles\":" + std::to_string(Tiles) : "");
+    threads::TileHandler cgh;
+    /// creating host accessors on all input output buffers
+    auto global_accessor_tuple = threads::extract_host_accessors(cgh, expr);
+    /// starting point of local tuples
+    constexpr size_t Output_offset = tools::tuple::size(global_accessor_tuple);
+
+    std::atomic<size_t> nextTile(0);
+    const uint64_t start = now();
+    pool->run([&](size_t) {
+      if (nextTile.load() >= Tiles) {
+        return;
+      }
+      /// create the scratch memories of this worker used as local memory
+      threads::TileHandler scratch;
+      auto device_tuple = tools::tuple::append(
+          global_accessor_tuple, create_local_accessors<LC, LR, Expr>(scratch));
+      for (size_t tile = nextTile++; tile < Tiles; tile = nextTile++) {
+        auto cOffset = visioncpp::internal::memLocation<LC, LR>(
+            threads::TileItem(tile % CGroups, (tile / CGroups) % RGroups,
+                              tile / (CGroups * RGroups)),
+            ext);
+        eval_tile<Output_offset, LC, LR, placeHolderExprType>(
+            cOffset, device_tuple);
+      }
+    });
+    if (prof->enabled()) {
+      auto stamps = std::make_pair(start, now());
+      prof->add(KernelLabel<Expr>::get(), [stamps]() { return stamps; });
+    }
+  }
+
+  /// \brief submits the launch function to the serial queue of the device and
+  /// returns without waiting for it. The launch function receives a device
+  /// sharing the thread pool of this one.
+  /// \param launch: a function running the kernels of an expression on the
+  /// device passed to it
+  /// \return Event
+  template <typename Launch>
+  Event launch_async(Launch launch) const {
+    Device_ inner(pool, nullptr, buffers, prof);
+    return Event(stream->enqueue([inner, launch]() mutable { launch(inner); }));
+  }
+};
+}  // namespace internal
+}  // namespace visioncpp
+#endif  // VISIONCPP_INCLUDE_FRAMEWORK_DEVICE_THREADS_THREADS_DEVICE_HPP_
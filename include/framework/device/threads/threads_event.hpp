@@ -0,0 +1,74 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file threads_event.hpp
+/// \brief This file contains the handle returned by execute_async when the
+/// expression is run on the threads backend.
+
+#ifndef VISIONCPP_INCLUDE_FRAMEWORK_DEVICE_THREADS_THREADS_EVENT_HPP_
+#define VISIONCPP_INCLUDE_FRAMEWORK_DEVICE_THREADS_THREADS_EVENT_HPP_
+
+namespace visioncpp {
+namespace internal {
+
+/// \brief specialisation of Event_ for the threads backend. It holds the
+/// future of the expression job in the serial queue of the device.
+template <>
+class Event_<backend::threads> {
+ private:
+  std::shared_future<void> result;
+
+ public:
+  Event_() = default;
+  explicit Event_(std::shared_future<void> res) : result(std::move(res)) {}
+
+  /// \brief blocks until the expression has finished. The exception thrown
+  /// while running the expression is rethrown from here.
+  /// \return void
+  void wait() {
+    TraceScope scope("wait", "wait");
+    if (result.valid()) {
+      result.get();
+    }
+  }
+
+  /// \brief polls the expression without blocking
+  /// \return bool: true when the expression has finished
+  bool is_complete() const {
+    return !result.valid() ||
+           result.wait_for(std::chrono::seconds(0)) ==
+               std::future_status::ready;
+  }
+
+  /// \brief chains a host function to the expression. The function is run on
+  /// a separate thread once the expression has finished.
+  /// \param f: the host function to be run
+  /// \return std::future holding the result of f
+  template <typename F>
+  auto then(F f) -> std::future<decltype(f())> {
+    Event_ self = *this;
+    return std::async(std::launch::async, [self, f]() mutable {
+      self.wait();
+      return f();
+    });
+  }
+};
+}  // namespace internal
+}  // namespace visioncpp
+#endif  // VISIONCPP_INCLUDE_FRAMEWORK_DEVICE_THREADS_THREADS_EVENT_HPP_
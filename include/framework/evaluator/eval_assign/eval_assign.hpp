@@ -53,12 +53,17 @@ struct Evaluator<internal::ops_category::NeighbourOP, OutputIndex, Offset, LC,
   static inline void eval(Loc &cOffset,
                           const tools::tuple::Tuple<Params...> &t) {
     EvalExpr<RHS, Loc, Params...>::template eval_neighbour<
-        true, 0, 0, 0, 0, Offset, OutputIndex, LC, LR>(cOffset, t);
+        true, 0, 0, 0, 0, border_type::Replicate, ZeroBorder, Offset,
+        OutputIndex, LC, LR>(cOffset, t);
   }
 };
 
 /// \brief Partial specialisation of the Evaluator when the expression is an
 /// internal::Assign expression and the internal::ops_category is PointOP.
+/// When a functor of the expression provides a packet member and a work-item
+/// computes contiguous columns (e.g. on the threads backend), each row of its
+/// tile is evaluated a packet of pixels at a time, and the pixels left at the
+/// end of the row one at a time.
 template <size_t Output_Index, size_t Offset, size_t LC, size_t LR,
           typename LHS, typename RHS, size_t Cols, size_t Rows, size_t LfType,
           size_t LVL, typename Loc, typename... Params>
@@ -74,15 +79,49 @@ struct Evaluator<internal::ops_category::PointOP, Output_Index, Offset, LC, LR,
     using ElementType =
         typename MemoryTrait<Expr::LeafType,
                              decltype(tools::tuple::get<0>(t))>::Type;
+    const size_t cols = extent_cols<Expr::Type::Cols>(cOffset);
+    const size_t rows = extent_rows<Expr::Type::Rows>(cOffset);
+    const size_t pitch = row_pitch(LHS_Eval_Expr::get_accessor(t), cols);
+    constexpr size_t W = PacketSize<ElementType>::Value;
+    if (PacketExpr<W, RHS>::Value && cOffset.cLRng == 1) {
+      auto out = LHS_Eval_Expr::get_accessor(t).get_pointer();
+      const size_t end =
+          cOffset.g_c < cols
+              ? (cols - cOffset.g_c < LC ? cols - cOffset.g_c : LC)
+              : 0;
+      for (size_t j = 0; j < LR; j += cOffset.rLRng) {
+        if (cOffset.g_r + j < rows) {
+          const size_t row = ((cOffset.g_r + j) * pitch) +
+                             frame_offset<false>(cOffset, pitch, rows);
+          cOffset.pointOp_gr = cOffset.g_r + j;
+          size_t i = 0;
+          for (; i + W <= end; i += W) {
+            cOffset.pointOp_gc = cOffset.g_c + i;
+            pixel::Packet<ElementType, W> packet;
+            RHS_Eval_Expr::eval_packet(cOffset, t, packet);
+            for (size_t k = 0; k < W; k++) {
+              out[row + cOffset.g_c + i + k] = packet[k];
+            }
+          }
+          for (; i < end; i++) {
+            cOffset.pointOp_gc = cOffset.g_c + i;
+            out[row + cOffset.g_c + i] = tools::convert<ElementType>(
+                RHS_Eval_Expr::eval_point(cOffset, t));
+          }
+        }
+      }
+      return;
+    }
     for (int i = 0; i < LC; i += cOffset.cLRng)
-      if (cOffset.g_c + i < Expr::Type::Cols)
+      if (cOffset.g_c + i < cols)
         for (int j = 0; j < LR; j += cOffset.rLRng)
-          if (cOffset.g_r + j < Expr::Type::Rows) {
+          if (cOffset.g_r + j < rows) {
             cOffset.pointOp_gc = cOffset.g_c + i;
             cOffset.pointOp_gr = cOffset.g_r + j;
-            LHS_Eval_Expr::get_accessor(t).get_pointer()[calculate_index(
-                cOffset.g_c + i, cOffset.g_r + j, Expr::Type::Cols,
-                Expr::Type::Rows)] =
+            LHS_Eval_Expr::get_accessor(t).get_pointer()
+                [calculate_index(cOffset.g_c + i, cOffset.g_r + j, cols,
+                                 rows, pitch) +
+                 frame_offset<false>(cOffset, pitch, rows)] =
                 tools::convert<ElementType>(
                     RHS_Eval_Expr::eval_point(cOffset, t));
           }
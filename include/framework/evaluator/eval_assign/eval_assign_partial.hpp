@@ -46,6 +46,8 @@ struct Evaluator<ops_category::PointOP, OutputIndex, Offset, LC, LR,
     using ElementType =
         typename MemoryTrait<Expr::LeafType,
                              decltype(tools::tuple::get<0>(t))>::Type;
+    const size_t pitch =
+        row_pitch(LHS_Eval_Expr::get_accessor(t), LHS::Type::Cols);
 
     for (int i = 0; i < LC; i += cOffset.cLRng) {
       if (((cOffset.g_c + OffsetColIn + i) < RHS::Type::Cols) &&
@@ -58,7 +60,8 @@ struct Evaluator<ops_category::PointOP, OutputIndex, Offset, LC, LR,
 
             LHS_Eval_Expr::get_accessor(t).get_pointer()[calculate_index(
                 cOffset.g_c + i + OffsetColOut, cOffset.g_r + j + OffsetRowOut,
-                LHS::Type::Cols, LHS::Type::Rows)] =
+                LHS::Type::Cols, LHS::Type::Rows, pitch) +
+                frame_offset<false>(cOffset, pitch, LHS::Type::Rows)] =
                 tools::convert<ElementType>(
                     RHS_Eval_Expr::eval_point(cOffset, t));
           }
@@ -90,7 +93,8 @@ struct Evaluator<ops_category::NeighbourOP, OutputIndex, Offset, LC, LR,
     constexpr size_t RHS_LC_Ratio = RHS::CThread / RHS::Type::Cols;
     constexpr size_t RHS_LR_Ratio = RHS::RThread / RHS::Type::Rows;
     auto rhs_acc2 = EvalExpr<RHS, Loc, Params...>::template eval_neighbour<
-        false, 0, 0, 0, 0, Offset, OutputIndex, LC, LR>(cOffset, t);
+        false, 0, 0, 0, 0, border_type::Replicate, ZeroBorder, Offset,
+        OutputIndex, LC, LR>(cOffset, t);
     constexpr bool isLocal =
         Trait<typename tools::RemoveAll<decltype(rhs_acc2)>::Type>::scope ==
         scope::Local;
@@ -99,26 +103,29 @@ struct Evaluator<ops_category::NeighbourOP, OutputIndex, Offset, LC, LR,
     auto lhs_acc1 = LHS_Eval_Expr::get_accessor(t);
     auto rhs_acc = rhs_acc2.get_pointer();
     auto lhs_acc = LHS_Eval_Expr::get_accessor(t).get_pointer();
+    const size_t pitch = row_pitch(lhs_acc1, LHS::Type::Cols);
     static_assert(RHS_LR_Ratio == LR_Ratio && RHS_LC_Ratio == LC_Ratio,
                   "You made a programing mistake. The kernel must break when "
                   "the two are not equal");
-    if ((cOffset.l_c < (cOffset.cLRng / LC_Ratio)) &&
-        (cOffset.l_r < (cOffset.rLRng / LR_Ratio))) {
+    if ((cOffset.l_c < get_ratio_range<LC_Ratio>(cOffset.cLRng)) &&
+        (cOffset.l_r < get_ratio_range<LR_Ratio>(cOffset.rLRng))) {
       size_t g_c = ((cOffset.g_c - cOffset.l_c) / LC_Ratio) + cOffset.l_c;
       size_t g_r = ((cOffset.g_r - cOffset.l_r) / LR_Ratio) + cOffset.l_r;
 
-      for (int i = 0; i < LC / LC_Ratio; i += (cOffset.cLRng / LC_Ratio)) {
-        if (get_compare<isLocal, LC / RHS_LC_Ratio, RHS::Type::Cols>(
-                cOffset.l_c, i, g_c) &&
+      for (int i = 0; i < LC / LC_Ratio;
+           i += get_ratio_range<LC_Ratio>(cOffset.cLRng)) {
+        if (get_compare<isLocal, LC / RHS_LC_Ratio>(cOffset.l_c, i, g_c,
+                                                    RHS::Type::Cols) &&
             (g_c + i + OffsetColOut < LHS::Type::Cols)) {
           for (size_t j = 0; j < LR / LR_Ratio;
-               j += (cOffset.rLRng / LR_Ratio)) {
-            if (get_compare<isLocal, LR / LR_Ratio, RHS::Type::Rows>(
-                    cOffset.l_r, j, g_r) &&
+               j += get_ratio_range<LR_Ratio>(cOffset.rLRng)) {
+            if (get_compare<isLocal, LR / LR_Ratio>(cOffset.l_r, j, g_r,
+                                                    RHS::Type::Rows) &&
                 (g_r + j + OffsetRowOut < LHS::Type::Rows)) {
               lhs_acc[calculate_index(g_c + i + OffsetColOut,
                                       g_r + j + OffsetRowOut, LHS::Type::Cols,
-                                      LHS::Type::Rows)] =
+                                      LHS::Type::Rows, pitch) +
+                      frame_offset<false>(cOffset, pitch, LHS::Type::Rows)] =
                   rhs_acc[calculate_index(cOffset.l_c + i, cOffset.l_r + j,
                                           LC / LC_Ratio, LR / LR_Ratio)];
             }
@@ -153,6 +160,10 @@ struct Evaluator<ops_category::GlobalNeighbourOP, OutputIndex, Offset, LC, LR,
         true, Offset, OutputIndex, LC, LR>(cOffset, t);
     auto rhs_acc = RHS_Eval_Expr::get_accessor(t).get_pointer();
     auto lhs_acc = LHS_Eval_Expr::get_accessor(t).get_pointer();
+    const size_t rhsPitch =
+        row_pitch(RHS_Eval_Expr::get_accessor(t), RHS::Type::Cols);
+    const size_t lhsPitch =
+        row_pitch(LHS_Eval_Expr::get_accessor(t), LHS::Type::Cols);
 
     for (int i = 0; i < LC; i += cOffset.cLRng) {
       if (((cOffset.g_c + OffsetColIn + i) < RHS::Type::Cols) &&
@@ -163,9 +174,12 @@ struct Evaluator<ops_category::GlobalNeighbourOP, OutputIndex, Offset, LC, LR,
             cOffset.pointOp_gc = cOffset.g_c + i + OffsetColIn;
             cOffset.pointOp_gr = cOffset.g_r + j + OffsetRowIn;
             lhs_acc[(cOffset.g_c + i + OffsetColOut) +
-                    (LHS::Type::Cols * (cOffset.g_r + j + OffsetRowOut))] =
+                    (lhsPitch * (cOffset.g_r + j + OffsetRowOut)) +
+                    frame_offset<false>(cOffset, lhsPitch, LHS::Type::Rows)] =
                 rhs_acc[(cOffset.g_c + i + OffsetColIn) +
-                        (RHS::Type::Cols * (cOffset.g_r + j + OffsetRowIn))];
+                        (rhsPitch * (cOffset.g_r + j + OffsetRowIn)) +
+                        frame_offset<false>(cOffset, rhsPitch,
+                                            RHS::Type::Rows)];
           }
         }
       }
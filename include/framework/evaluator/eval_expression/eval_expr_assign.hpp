@@ -45,10 +45,29 @@ struct EvalExpr<Assign<LHS, RHS, Cols, Rows, LfType, LVL>, Loc, Params...> {
     LHS_Eval_Expr::eval_point(cOffset, t) = x;
     return x;
   }
+  /// \brief evaluate function when the internal::ops_category is PointOP and
+  /// W pixels are written to the packet at a time.
+  template <size_t W, typename T>
+  static inline void eval_packet(Loc &cOffset,
+                                 const tools::tuple::Tuple<Params...> &t,
+                                 pixel::Packet<T, W> &packet) {
+    pixel::Packet<typename MemoryTrait<LfType, decltype(
+                      LHS_Eval_Expr::get_accessor(t))>::Type,
+                  W>
+        x;
+    RHS_Eval_Expr::eval_packet(cOffset, t, x);
+    const size_t gc = cOffset.pointOp_gc;
+    for (size_t k = 0; k < W; k++) {
+      cOffset.pointOp_gc = gc + k;
+      LHS_Eval_Expr::eval_point(cOffset, t) = x[k];
+      packet[k] = tools::convert<T>(x[k]);
+    }
+    cOffset.pointOp_gc = gc;
+  }
   /// \brief evaluate function when the internal::ops_category is NeighbourOP.
   template <bool IsRoot, size_t Halo_Top, size_t Halo_Left, size_t Halo_Butt,
-            size_t Halo_Right, size_t Offset, size_t Index, size_t LC,
-            size_t LR>
+            size_t Halo_Right, size_t Border, typename BorderValue,
+            size_t Offset, size_t Index, size_t LC, size_t LR>
   static auto eval_neighbour(Loc &cOffset,
                              const tools::tuple::Tuple<Params...> &t)
       -> decltype(
@@ -57,39 +76,54 @@ struct EvalExpr<Assign<LHS, RHS, Cols, Rows, LfType, LVL>, Loc, Params...> {
     constexpr bool isLocal =
         Trait<typename tools::RemoveAll<decltype(
             LHS_Eval_Expr::get_accessor(t))>::Type>::scope == scope::Local;
+    // the output of an interior tile lies inside the image
+    constexpr bool inRange = isLocal || Loc::Interior;
     constexpr size_t LC_Ratio = RHS::CThread / Cols;
     constexpr size_t LR_Ratio = RHS::RThread / Rows;
     // lhs expression shared mem
     auto nested_accessor =
         RHS_Eval_Expr::template eval_neighbour<IsRoot, Halo_Top, Halo_Left,
-                                               Halo_Butt, Halo_Right, Offset,
-                                               Index, LC, LR>(cOffset, t);
+                                               Halo_Butt, Halo_Right, Border,
+                                               BorderValue, Offset, Index, LC,
+                                               LR>(cOffset, t);
     constexpr bool isLocal_nested =
         Trait<typename tools::RemoveAll<decltype(
             nested_accessor)>::Type>::scope == scope::Local;
     auto rhs_acc = nested_accessor.get_pointer();
     auto lhs_acc = LHS_Eval_Expr::get_accessor(t).get_pointer();
-    if ((cOffset.l_c < (cOffset.cLRng / LC_Ratio)) &&
-        (cOffset.l_r < (cOffset.rLRng / LR_Ratio))) {
+    if ((cOffset.l_c < get_ratio_range<LC_Ratio>(cOffset.cLRng)) &&
+        (cOffset.l_r < get_ratio_range<LR_Ratio>(cOffset.rLRng))) {
+      const size_t cols = extent_cols<Cols>(cOffset);
+      const size_t rows = extent_rows<Rows>(cOffset);
       size_t g_c = ((cOffset.g_c - cOffset.l_c) / LC_Ratio) + cOffset.l_c;
       size_t g_r = ((cOffset.g_r - cOffset.l_r) / LR_Ratio) + cOffset.l_r;
-      for (int i = 0; i < LC / LC_Ratio; i += (cOffset.cLRng / LC_Ratio)) {
-        if (get_compare<isLocal, LC / LC_Ratio, Cols>(cOffset.l_c, i, g_c)) {
+      const size_t lhsPitch = row_pitch(LHS_Eval_Expr::get_accessor(t),
+                                        id_val<isLocal>(LC / LC_Ratio, cols));
+      const size_t rhsPitch = row_pitch(
+          nested_accessor, id_val<isLocal_nested>(LC / LC_Ratio, cols));
+      for (int i = 0; i < LC / LC_Ratio;
+           i += get_ratio_range<LC_Ratio>(cOffset.cLRng)) {
+        if (get_compare<inRange, LC / LC_Ratio>(cOffset.l_c, i, g_c, cols)) {
           for (size_t j = 0; j < LR / LR_Ratio;
-               j += (cOffset.rLRng / LR_Ratio)) {
-            if (get_compare<isLocal, LR / LR_Ratio, Rows>(cOffset.l_r, j,
-                                                          g_r)) {
-              lhs_acc[calculate_index(id_val<isLocal>(cOffset.l_c, g_c) + i,
-                                      id_val<isLocal>(cOffset.l_r, g_r) + j,
-                                      id_val<isLocal>(LC / LC_Ratio, Cols),
-                                      id_val<isLocal>(LR / LR_Ratio, Rows))] =
+               j += get_ratio_range<LR_Ratio>(cOffset.rLRng)) {
+            if (get_compare<inRange, LR / LR_Ratio>(cOffset.l_r, j, g_r,
+                                                    rows)) {
+              lhs_acc[calculate_index<Loc::Interior>(
+                          id_val<isLocal>(cOffset.l_c, g_c) + i,
+                          id_val<isLocal>(cOffset.l_r, g_r) + j,
+                          id_val<isLocal>(LC / LC_Ratio, cols),
+                          id_val<isLocal>(LR / LR_Ratio, rows), lhsPitch) +
+                      frame_offset<isLocal>(cOffset, lhsPitch, rows)] =
                   tools::convert<typename MemoryTrait<
                       LfType, decltype(nested_accessor)>::Type>(
-                      rhs_acc[calculate_index(
+                      rhs_acc[calculate_index<Loc::Interior>(
                           id_val<isLocal_nested>(cOffset.l_c, g_c) + i,
                           id_val<isLocal_nested>(cOffset.l_r, g_r) + j,
-                          id_val<isLocal_nested>(LC / LC_Ratio, Cols),
-                          id_val<isLocal_nested>(LR / LR_Ratio, Rows))]);
+                          id_val<isLocal_nested>(LC / LC_Ratio, cols),
+                          id_val<isLocal_nested>(LR / LR_Ratio, rows),
+                          rhsPitch) +
+                          frame_offset<isLocal_nested>(cOffset, rhsPitch,
+                                                       rows)]);
             }
           }
         }
@@ -109,19 +143,26 @@ struct EvalExpr<Assign<LHS, RHS, Cols, Rows, LfType, LVL>, Loc, Params...> {
           tools::tuple::get<OutputLocation<IsRoot, Offset + Index - 1>::ID>(
               t)) {
     // lhs expression shared mem
-    auto rhs_acc = RHS_Eval_Expr::template eval_global_neighbour<IsRoot, Offset,
-                                                                 Index, LC, LR>(
-                       cOffset, t).get_pointer();
+    auto nested_accessor =
+        RHS_Eval_Expr::template eval_global_neighbour<IsRoot, Offset, Index, LC,
+                                                      LR>(cOffset, t);
+    auto rhs_acc = nested_accessor.get_pointer();
     auto lhs_acc = LHS_Eval_Expr::get_accessor(t).get_pointer();
     // here the neighbour is the entire output
-    size_t index = 0;
+    const size_t cols = extent_cols<Cols>(cOffset);
+    const size_t rows = extent_rows<Rows>(cOffset);
+    const size_t lhsPitch = row_pitch(LHS_Eval_Expr::get_accessor(t), cols);
+    const size_t rhsPitch = row_pitch(nested_accessor, cols);
     for (int i = 0; i < LC; i += cOffset.cLRng) {
-      if (get_compare<false, LC, Cols>(cOffset.l_c, i, cOffset.g_c)) {
+      if (get_compare<false, LC>(cOffset.l_c, i, cOffset.g_c, cols)) {
         for (int j = 0; j < LR; j += cOffset.rLRng) {
-          if (get_compare<false, LR, Rows>(cOffset.l_r, j, cOffset.g_r)) {
-            index =
-                calculate_index(cOffset.g_c + i, cOffset.g_r + j, Cols, Rows);
-            lhs_acc[index] = rhs_acc[index];
+          if (get_compare<false, LR>(cOffset.l_r, j, cOffset.g_r, rows)) {
+            lhs_acc[calculate_index(cOffset.g_c + i, cOffset.g_r + j, cols,
+                                    rows, lhsPitch) +
+                    frame_offset<false>(cOffset, lhsPitch, rows)] =
+                rhs_acc[calculate_index(cOffset.g_c + i, cOffset.g_r + j, cols,
+                                        rows, rhsPitch) +
+                        frame_offset<false>(cOffset, rhsPitch, rows)];
           }
         }
       }
@@ -33,6 +33,11 @@ template <size_t Memory_Type, size_t N, size_t Cols, size_t Rows, size_t LVL,
 struct EvalExpr<LeafNode<PlaceHolder<Memory_Type, N, Cols, Rows, Sc>, LVL>, Loc,
                 Params...> {
   using Expr = LeafNode<PlaceHolder<Memory_Type, N, Cols, Rows, Sc>, LVL>;
+  /// the constant variables keep their compile-time size
+  static constexpr bool Fixed = Memory_Type == memory_type::Const;
+  /// the memories shared by all the frames of a batch
+  static constexpr bool Shared =
+      Memory_Type == memory_type::Const || Sc == scope::Constant;
 
   static auto get_accessor(const tools::tuple::Tuple<Params...> &t)
       -> decltype(tools::tuple::get<N>(t)) {
@@ -44,13 +49,43 @@ struct EvalExpr<LeafNode<PlaceHolder<Memory_Type, N, Cols, Rows, Sc>, LVL>, Loc,
       -> decltype(tools::tuple::get<N>(t)
                       .get_pointer()[cOffset.pointOp_gc +
                                      (Cols * cOffset.pointOp_gr)]) {
-    return tools::tuple::get<N>(t).get_pointer()[calculate_index(
-        cOffset.pointOp_gc, cOffset.pointOp_gr, Cols, Rows)];
+    const size_t cols = extent_cols<Cols, Fixed>(cOffset);
+    const size_t rows = extent_rows<Rows, Fixed>(cOffset);
+    const size_t pitch = row_pitch(tools::tuple::get<N>(t), cols);
+    return tools::tuple::get<N>(t).get_pointer()
+        [calculate_index(cOffset.pointOp_gc, cOffset.pointOp_gr, cols, rows,
+                         pitch) +
+         frame_offset<Shared>(cOffset, pitch, rows)];
+  }
+  /// \brief evaluate function when the internal::ops_category is PointOP and
+  /// the W pixels from (pointOp_gc, pointOp_gr) are written to the packet.
+  template <size_t W, typename T>
+  static inline void eval_packet(Loc &cOffset,
+                                 const tools::tuple::Tuple<Params...> &t,
+                                 pixel::Packet<T, W> &packet) {
+    const size_t cols = extent_cols<Cols, Fixed>(cOffset);
+    const size_t rows = extent_rows<Rows, Fixed>(cOffset);
+    const size_t pitch = row_pitch(tools::tuple::get<N>(t), cols);
+    // the index of the last element, to which calculate_index clamps
+    const size_t last = (pitch * (rows - 1)) + cols - 1;
+    const size_t index = (cOffset.pointOp_gr * pitch) + cOffset.pointOp_gc;
+    const size_t offset = frame_offset<Shared>(cOffset, pitch, rows);
+    auto ptr = tools::tuple::get<N>(t).get_pointer();
+    if (index + W - 1 <= last) {
+      for (size_t k = 0; k < W; k++) {
+        packet[k] = tools::convert<T>(ptr[index + k + offset]);
+      }
+    } else {
+      for (size_t k = 0; k < W; k++) {
+        packet[k] = tools::convert<T>(
+            ptr[(index + k < last ? index + k : last) + offset]);
+      }
+    }
   }
   /// \brief evaluate function when the internal::ops_category is NeighbourOP.
   template <bool IsRoot, size_t Halo_Top, size_t Halo_Left, size_t Halo_Butt,
-            size_t Halo_Right, size_t Offset, size_t Index, size_t LC,
-            size_t LR>
+            size_t Halo_Right, size_t Border, typename BorderValue,
+            size_t Offset, size_t Index, size_t LC, size_t LR>
   static inline auto eval_neighbour(Loc &cOffset,
                                     const tools::tuple::Tuple<Params...> &t)
       -> decltype(tools::tuple::get<Index_Finder<
@@ -58,7 +93,7 @@ struct EvalExpr<LeafNode<PlaceHolder<Memory_Type, N, Cols, Rows, Sc>, LVL>, Loc,
           Trait<typename tools::RemoveAll<
               decltype(tools::tuple::get<N>(t))>::Type>::scope>::Index>(t)) {
     fill_local_neighbour<
-        Halo_Top, Halo_Left, Halo_Butt, Halo_Right,
+        Halo_Top, Halo_Left, Halo_Butt, Halo_Right, Border, BorderValue,
         Index_Finder<N, OutputLocation<IsRoot, Offset + Index - 1>::ID,
                      Memory_Type, Sc>::Index,
         LC, LR, Expr>(cOffset, t);
@@ -38,10 +38,20 @@ struct EvalExpr<RUnOP<UN_OP, Nested, Cols, Rows, LfType, LVL>, Loc, Params...> {
     return typename UN_OP::OP()(
         tools::convert<typename UN_OP::InType>(nested_acc));
   }
+  /// \brief evaluate function when the internal::ops_category is PointOP and
+  /// W pixels are written to the packet at a time.
+  template <size_t W, typename T>
+  static inline void eval_packet(Loc &cOffset,
+                                 const tools::tuple::Tuple<Params...> &t,
+                                 pixel::Packet<T, W> &packet) {
+    pixel::Packet<typename UN_OP::InType, W> nested_acc;
+    EvalExpr<Nested, Loc, Params...>::eval_packet(cOffset, t, nested_acc);
+    apply_packet<typename UN_OP::OP>(packet, nested_acc);
+  }
   /// \brief evaluate function when the internal::ops_category is NeighbourOP.
   template <bool IsRoot, size_t Halo_Top, size_t Halo_Left, size_t Halo_Butt,
-            size_t Halo_Right, size_t Offset, size_t Index, size_t LC,
-            size_t LR>
+            size_t Halo_Right, size_t Border, typename BorderValue,
+            size_t Offset, size_t Index, size_t LC, size_t LR>
   static auto eval_neighbour(Loc &cOffset,
                              const tools::tuple::Tuple<Params...> &t)
       -> decltype(
@@ -51,21 +61,33 @@ struct EvalExpr<RUnOP<UN_OP, Nested, Cols, Rows, LfType, LVL>, Loc, Params...> {
     constexpr bool isLocal =
         Trait<typename tools::RemoveAll<decltype(
             tools::tuple::get<OutOffset>(t))>::Type>::scope == scope::Local;
+    // the output of an interior tile lies inside the image
+    constexpr bool inRange = isLocal || Loc::Interior;
     auto nested_acc = EvalExpr<Nested, Loc, Params...>::template eval_neighbour<
                           false, Halo_Top, Halo_Left, Halo_Butt, Halo_Right,
-                          Offset, Index - 1, LC, LR>(cOffset, t).get_pointer();
+                          Border, BorderValue, Offset, Index - 1, LC, LR>(
+                          cOffset, t)
+                          .get_pointer();
+    const size_t cols = extent_cols<Cols>(cOffset);
+    const size_t rows = extent_rows<Rows>(cOffset);
+    const size_t pitch =
+        row_pitch(tools::tuple::get<OutOffset>(t), id_val<isLocal>(LC, cols));
     for (int i = 0; i < LC; i += cOffset.cLRng) {
-      if (get_compare<isLocal, LC, Cols>(cOffset.l_c, i, cOffset.g_c)) {
+      if (get_compare<inRange, LC>(cOffset.l_c, i, cOffset.g_c, cols)) {
         for (int j = 0; j < LR; j += cOffset.rLRng) {
-          if (get_compare<isLocal, LR, Rows>(cOffset.l_r, j, cOffset.g_r)) {
-            tools::tuple::get<OutOffset>(t).get_pointer()[calculate_index(
-                id_val<isLocal>(cOffset.l_c, cOffset.g_c) + i,
-                id_val<isLocal>(cOffset.l_r, cOffset.g_r) + j,
-                id_val<isLocal>(LC, Cols), id_val<isLocal>(LR, Rows))] =
+          if (get_compare<inRange, LR>(cOffset.l_r, j, cOffset.g_r, rows)) {
+            tools::tuple::get<OutOffset>(t).get_pointer()
+                [calculate_index<Loc::Interior>(
+                     id_val<isLocal>(cOffset.l_c, cOffset.g_c) + i,
+                     id_val<isLocal>(cOffset.l_r, cOffset.g_r) + j,
+                     id_val<isLocal>(LC, cols), id_val<isLocal>(LR, rows),
+                     pitch) +
+                 frame_offset<isLocal>(cOffset, pitch, rows)] =
                 tools::convert<typename MemoryTrait<
                     LfType, decltype(tools::tuple::get<OutOffset>(t))>::Type>(
-                    typename UN_OP::OP()(nested_acc[calculate_index(
-                        cOffset.l_c + i, cOffset.l_r + j, LC, LR)]));
+                    typename UN_OP::OP()(
+                        nested_acc[calculate_index<Loc::Interior>(
+                            cOffset.l_c + i, cOffset.l_r + j, LC, LR)]));
           }
         }
       }
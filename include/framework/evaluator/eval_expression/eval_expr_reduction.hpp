@@ -35,8 +35,8 @@ struct EvalExpr<RDCN<C_OP, RHS, Cols, Rows, LfType, LVL>, Loc, Params...> {
   //-- -
   /// \brief evaluate function when the internal::ops_category is NeighbourOP.
   template <bool IsRoot, size_t Halo_Top, size_t Halo_Left, size_t Halo_Butt,
-            size_t Halo_Right, size_t Offset, size_t Index, size_t LC,
-            size_t LR>
+            size_t Halo_Right, size_t Border, typename BorderValue,
+            size_t Offset, size_t Index, size_t LC, size_t LR>
   static auto eval_neighbour(Loc &cOffset,
                              const tools::tuple::Tuple<Params...> &t)
       -> decltype(
@@ -46,36 +46,47 @@ struct EvalExpr<RDCN<C_OP, RHS, Cols, Rows, LfType, LVL>, Loc, Params...> {
     constexpr bool isLocal =
         Trait<typename tools::RemoveAll<decltype(
             tools::tuple::get<OutOffset>(t))>::Type>::scope == scope::Local;
+    // the output of an interior tile lies inside the image
+    constexpr bool inRange = isLocal || Loc::Interior;
     constexpr size_t LC_Ratio = RHS::CThread / Cols;
     constexpr size_t LR_Ratio = RHS::RThread / Rows;
     // lhs expression shared mem
     auto nested_acc = EvalExpr<RHS, Loc, Params...>::template eval_neighbour<
                           false, Halo_Top, Halo_Left, Halo_Butt, Halo_Right,
-                          Offset, Index - 1, LC, LR>(cOffset, t).get_pointer();
+                          Border, BorderValue, Offset, Index - 1, LC, LR>(
+                          cOffset, t)
+                          .get_pointer();
 
-    if ((cOffset.l_c < (cOffset.cLRng / LC_Ratio)) &&
-        (cOffset.l_r < (cOffset.rLRng / LR_Ratio))) {
+    if ((cOffset.l_c < get_ratio_range<LC_Ratio>(cOffset.cLRng)) &&
+        (cOffset.l_r < get_ratio_range<LR_Ratio>(cOffset.rLRng))) {
       static constexpr size_t Neighbour_LC_Ratio =
           LC_Ratio / (RHS::Type::Cols / Cols);
       static constexpr size_t Neighbour_LR_Ratio =
           LR_Ratio / (RHS::Type::Rows / Rows);
       auto neighbour = LocalNeighbour<typename C_OP::InType>(
           nested_acc, LC / Neighbour_LC_Ratio, LR / Neighbour_LR_Ratio);
+      const size_t cols = extent_cols<Cols>(cOffset);
+      const size_t rows = extent_rows<Rows>(cOffset);
       size_t g_c = ((cOffset.g_c - cOffset.l_c) / LC_Ratio) + cOffset.l_c;
       size_t g_r = ((cOffset.g_r - cOffset.l_r) / LR_Ratio) + cOffset.l_r;
+      const size_t pitch = row_pitch(tools::tuple::get<OutOffset>(t),
+                                     id_val<isLocal>(LC / LC_Ratio, cols));
 
-      for (int i = 0; i < LC / LC_Ratio; i += (cOffset.cLRng / LC_Ratio)) {
-        if (get_compare<isLocal, LC / LC_Ratio, Cols>(cOffset.l_c, i, g_c)) {
+      for (int i = 0; i < LC / LC_Ratio;
+           i += get_ratio_range<LC_Ratio>(cOffset.cLRng)) {
+        if (get_compare<inRange, LC / LC_Ratio>(cOffset.l_c, i, g_c, cols)) {
           for (size_t j = 0; j < LR / LR_Ratio;
-               j += (cOffset.rLRng / LR_Ratio)) {
-            if (get_compare<isLocal, LR / LR_Ratio, Rows>(cOffset.l_r, j,
-                                                          g_r)) {
+               j += get_ratio_range<LR_Ratio>(cOffset.rLRng)) {
+            if (get_compare<inRange, LR / LR_Ratio>(cOffset.l_r, j, g_r,
+                                                    rows)) {
               neighbour.set_offset((cOffset.l_c + i), (cOffset.l_r + j));
-              tools::tuple::get<OutOffset>(t).get_pointer()[calculate_index(
-                  id_val<isLocal>(cOffset.l_c, g_c) + i,
-                  id_val<isLocal>(cOffset.l_r, g_r) + j,
-                  id_val<isLocal>(LC / LC_Ratio, Cols),
-                  id_val<isLocal>(LR / LR_Ratio, Rows))] =
+              tools::tuple::get<OutOffset>(t).get_pointer()
+                  [calculate_index<Loc::Interior>(
+                       id_val<isLocal>(cOffset.l_c, g_c) + i,
+                       id_val<isLocal>(cOffset.l_r, g_r) + j,
+                       id_val<isLocal>(LC / LC_Ratio, cols),
+                       id_val<isLocal>(LR / LR_Ratio, rows), pitch) +
+                   frame_offset<isLocal>(cOffset, pitch, rows)] =
                   tools::convert<typename MemoryTrait<
                       LfType, decltype(tools::tuple::get<OutOffset>(t))>::Type>(
                       typename C_OP::OP()(neighbour));
@@ -101,21 +112,31 @@ struct EvalExpr<RDCN<C_OP, RHS, Cols, Rows, LfType, LVL>, Loc, Params...> {
         Trait<typename tools::RemoveAll<decltype(
             tools::tuple::get<OutOffset>(t))>::Type>::scope == scope::Local;
     // lhs expression shared mem
-    auto nested_acc =
+    auto nested_accessor =
         EvalExpr<RHS, Loc, Params...>::template eval_global_neighbour<
-            false, Offset, Index - 1, LC, LR>(cOffset, t).get_pointer();
+            false, Offset, Index - 1, LC, LR>(cOffset, t);
+    auto nested_acc = nested_accessor.get_pointer();
     // here the neighbour is the entire output
+    const size_t nested_cols = extent_cols<RHS::Type::Cols>(cOffset);
+    const size_t nested_rows = extent_rows<RHS::Type::Rows>(cOffset);
+    const size_t nested_pitch = row_pitch(nested_accessor, nested_cols);
     auto reduction = GlobalNeighbour<typename C_OP::InType>(
-        nested_acc, RHS::Type::Cols, RHS::Type::Rows);
+        nested_acc, nested_cols, nested_rows,
+        frame_offset<false>(cOffset, nested_pitch, nested_rows), nested_pitch);
+    const size_t cols = extent_cols<Cols>(cOffset);
+    const size_t rows = extent_rows<Rows>(cOffset);
+    const size_t pitch =
+        row_pitch(tools::tuple::get<OutOffset>(t), id_val<isLocal>(LC, cols));
     for (int i = 0; i < LC; i += cOffset.cLRng) {
-      if (get_compare<isLocal, LC, Cols>(cOffset.l_c, i, cOffset.g_c)) {
+      if (get_compare<isLocal, LC>(cOffset.l_c, i, cOffset.g_c, cols)) {
         for (int j = 0; j < LR; j += cOffset.rLRng) {
-          if (get_compare<isLocal, LR, Rows>(cOffset.l_r, j, cOffset.g_r)) {
+          if (get_compare<isLocal, LR>(cOffset.l_r, j, cOffset.g_r, rows)) {
             reduction.set_offset(cOffset.g_c + i, cOffset.g_r + j);
             tools::tuple::get<OutOffset>(t).get_pointer()[calculate_index(
                 id_val<isLocal>(cOffset.l_c, cOffset.g_c) + i,
                 id_val<isLocal>(cOffset.l_r, cOffset.g_r) + j,
-                id_val<isLocal>(LC, Cols), id_val<isLocal>(LR, Rows))] =
+                id_val<isLocal>(LC, cols), id_val<isLocal>(LR, rows), pitch) +
+                frame_offset<isLocal>(cOffset, pitch, rows)] =
                 ((tools::convert<typename MemoryTrait<
                     LfType, decltype(tools::tuple::get<OutOffset>(t))>::Type>(
                     typename C_OP::OP()(reduction))));
@@ -36,8 +36,8 @@ struct EvalExpr<StnFilt<C_OP, Halo_T, Halo_L, Halo_B, Halo_R, LHS, RHS, Cols,
                 Loc, Params...> {
   /// \brief evaluate function when the internal::ops_category is NeighbourOP.
   template <bool IsRoot, size_t Halo_Top, size_t Halo_Left, size_t Halo_Butt,
-            size_t Halo_Right, size_t Offset, size_t Index, size_t LC,
-            size_t LR>
+            size_t Halo_Right, size_t Border, typename BorderValue,
+            size_t Offset, size_t Index, size_t LC, size_t LR>
   static auto eval_neighbour(Loc &cOffset,
                              const tools::tuple::Tuple<Params...> &t)
       -> decltype(
@@ -47,35 +47,51 @@ struct EvalExpr<StnFilt<C_OP, Halo_T, Halo_L, Halo_B, Halo_R, LHS, RHS, Cols,
     constexpr bool isLocal =
         Trait<typename tools::RemoveAll<decltype(
             tools::tuple::get<OutOffset>(t))>::Type>::scope == scope::Local;
+    // the output of an interior tile lies inside the image
+    constexpr bool inRange = isLocal || Loc::Interior;
     // lhs expression shared mem
     static constexpr size_t RHSCount =
         LocalMemCount<RHS::ND_Category, RHS>::Count;
     auto lhs_acc =
         EvalExpr<LHS, Loc, Params...>::template eval_neighbour<
             false, Halo_Top + Halo_T, Halo_Left + Halo_L, Halo_Butt + Halo_B,
-            Halo_Right + Halo_R, Offset, Index - 1 - RHSCount,
+            Halo_Right + Halo_R, C_OP::Border, typename C_OP::BorderValue,
+            Offset, Index - 1 - RHSCount,
             LC + Halo_L + Halo_R, LR + Halo_T + Halo_B>(cOffset, t)
             .get_pointer();
-    // rhs expression shared mem
-    auto rhs_acc = EvalExpr<RHS, Loc, Params...>::template eval_neighbour<
+    // rhs expression shared mem. The filter keeps its compile-time size.
+    auto fixedOffset = fixed_location(cOffset);
+    using FixedLoc = decltype(fixedOffset);
+    auto rhs_acc = EvalExpr<RHS, FixedLoc, Params...>::template eval_neighbour<
                        false, Halo_Top, Halo_Left, Halo_Butt, Halo_Right,
-                       Offset, Index - 1, LC, LR>(cOffset, t).get_pointer();
+                       Border, BorderValue, Offset, Index - 1, LC, LR>(
+                       fixedOffset, t)
+                       .get_pointer();
 
-    auto neighbour = LocalNeighbour<typename C_OP::InType1>(
+    // the halo is loaded with the border type, so the taps are not clamped
+    auto neighbour = LocalNeighbour<typename C_OP::InType1, true>(
         lhs_acc, LC + Halo_L + Halo_R, LR + Halo_T + Halo_B);
     // filter for StnFilt
-    auto filter = ConstNeighbour<typename C_OP::InType2>(
-        rhs_acc, RHS::Type::Cols, RHS::Type::Rows);
+    auto filter = ConstNeighbour<typename C_OP::InType2, RHS::Type::Cols,
+                                 RHS::Type::Rows>(rhs_acc, RHS::Type::Cols,
+                                                  RHS::Type::Rows);
+    const size_t cols = extent_cols<Cols>(cOffset);
+    const size_t rows = extent_rows<Rows>(cOffset);
+    const size_t pitch =
+        row_pitch(tools::tuple::get<OutOffset>(t), id_val<isLocal>(LC, cols));
     for (int i = 0; i < LC; i += cOffset.cLRng) {
-      if (get_compare<isLocal, LC, Cols>(cOffset.l_c, i, cOffset.g_c)) {
+      if (get_compare<inRange, LC>(cOffset.l_c, i, cOffset.g_c, cols)) {
         for (int j = 0; j < LR; j += cOffset.rLRng) {
-          if (get_compare<isLocal, LR, Rows>(cOffset.l_r, j, cOffset.g_r)) {
+          if (get_compare<inRange, LR>(cOffset.l_r, j, cOffset.g_r, rows)) {
             neighbour.set_offset(cOffset.l_c + Halo_L + i,
                                  cOffset.l_r + Halo_T + j);
-            tools::tuple::get<OutOffset>(t).get_pointer()[calculate_index(
-                id_val<isLocal>(cOffset.l_c, cOffset.g_c) + i,
-                id_val<isLocal>(cOffset.l_r, cOffset.g_r) + j,
-                id_val<isLocal>(LC, Cols), id_val<isLocal>(LR, Rows))] =
+            tools::tuple::get<OutOffset>(t).get_pointer()
+                [calculate_index<Loc::Interior>(
+                     id_val<isLocal>(cOffset.l_c, cOffset.g_c) + i,
+                     id_val<isLocal>(cOffset.l_r, cOffset.g_r) + j,
+                     id_val<isLocal>(LC, cols), id_val<isLocal>(LR, rows),
+                     pitch) +
+                 frame_offset<isLocal>(cOffset, pitch, rows)] =
                 tools::convert<typename MemoryTrait<
                     LfType, decltype(tools::tuple::get<OutOffset>(t))>::Type>(
                     typename C_OP::OP()(neighbour, filter));
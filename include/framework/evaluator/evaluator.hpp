@@ -24,53 +24,79 @@
 #ifndef VISIONCPP_INCLUDE_FRAMEWORK_EVALUATOR_EVALUATOR_HPP_
 #define VISIONCPP_INCLUDE_FRAMEWORK_EVALUATOR_EVALUATOR_HPP_
 
+#include <type_traits>
+#include <utility>
+
 namespace visioncpp {
 namespace internal {
 /// \struct GetGlobalRange
-/// \brief GetGlobalRange is used to check the range when the halo is applied
+/// \brief GetGlobalRange is used to map the index of an element of a tile,
+/// including its halo, on to the image according to the border type. By
+/// default, i.e. for border_type::Replicate and border_type::ReplicateFused,
+/// the first and last pixels of the image are replicated.
 ///  template parameters
 /// \tparam Halo is the halo used around the image
-/// \tparam DimSize is the size of the dimension we want to check
-template <size_t Halo, size_t DimSize>
+/// \tparam Border is the visioncpp::border_type used outside of the image
+template <size_t Halo, size_t Border>
 struct GetGlobalRange {
   /// function get_global_range checks the range and pass the correct value as
   /// an index
   /// parameters:
   /// \param index is the passed index to be checked and corrected if needed
+  /// \param dimSize is the size of the dimension we want to check
   /// \return size_t
-  static size_t inline get_global_range(size_t index) {
-    size_t val = index;
-    if (val < Halo)
-      val = 0;
-    else if (val >= DimSize)
-      val = DimSize - 1;
-    else
-      val -= Halo;
-    return val;
+  static size_t inline get_global_range(size_t index, size_t dimSize) {
+    return (index < Halo) ? 0 : ((index - Halo < dimSize) ? index - Halo
+                                                          : dimSize - 1);
   }
 };
-/// \brief specialisation of GetGlobalRange when the Halo is 0
-template <size_t DimSize>
-struct GetGlobalRange<0, DimSize> {
-  /// function get_global_range checks the range and pass the correct value as
-  /// an index
-  /// parameters:
-  /// \param index is the passed index to be checked and corrected if needed
-  /// \return size_t
-  static size_t inline get_global_range(size_t index) {
-    return ((index < DimSize) ? index : DimSize - 1);
+/// \brief specialisation of GetGlobalRange when the image is reflected around
+/// its first and last pixels
+template <size_t Halo>
+struct GetGlobalRange<Halo, border_type::Reflect101> {
+  static size_t inline get_global_range(size_t index, size_t dimSize) {
+    if (dimSize == 1) return 0;
+    // the reflected image repeats every 2 * (dimSize - 1) pixels
+    const long period = 2 * static_cast<long>(dimSize) - 2;
+    long val = static_cast<long>(index) - static_cast<long>(Halo);
+    val = (val < 0 ? -val : val) % period;
+    return static_cast<size_t>(val < static_cast<long>(dimSize) ? val
+                                                                : period - val);
+  }
+};
+/// \brief specialisation of GetGlobalRange when the image is repeated
+template <size_t Halo>
+struct GetGlobalRange<Halo, border_type::Wrap> {
+  static size_t inline get_global_range(size_t index, size_t dimSize) {
+    const long size = static_cast<long>(dimSize);
+    const long val =
+        (static_cast<long>(index) - static_cast<long>(Halo)) % size;
+    return static_cast<size_t>(val < 0 ? val + size : val);
+  }
+};
+/// \brief specialisation of GetGlobalRange when a constant is read outside of
+/// the image. The index is then dimSize, which the Fill checks for.
+template <size_t Halo>
+struct GetGlobalRange<Halo, border_type::Constant> {
+  static size_t inline get_global_range(size_t index, size_t dimSize) {
+    return (index < Halo || index - Halo >= dimSize) ? dimSize : index - Halo;
   }
 };
 /// \brief template deduction function for get_global_range
 ///  template parameters:
 /// \tparam Halo is the halo used around the image
-/// \tparam DimSize is the size of the dimension we want to check
+/// \tparam Border is the visioncpp::border_type used outside of the image
+/// \tparam Interior whether or not the tile is an interior tile, whose halo
+/// lies inside the image. The index is then not checked.
 /// function parameters:
 /// \param index is the passed index to be checked and corrected if needed
+/// \param dimSize is the size of the dimension we want to check
 /// \return size_t
-template <size_t Halo, size_t DimSize>
-static size_t inline get_global_range(size_t index) {
-  return GetGlobalRange<Halo, DimSize>::get_global_range(index);
+template <size_t Halo, size_t Border, bool Interior = false>
+static size_t inline get_global_range(size_t index, size_t dimSize) {
+  return Interior
+             ? index - Halo
+             : GetGlobalRange<Halo, Border>::get_global_range(index, dimSize);
 }
 /// \struct Fill
 /// \brief The Fill is used to load a rectangle neighbour area from
@@ -107,6 +133,118 @@ struct Trait<visioncpp::internal::ConstMemory<T>> {
   using Type = T;
   static constexpr size_t scope = scope::Global;
 };
+/// specialisation of the Trait class when the accessor is on a Pitched2D
+/// memory
+template <typename Acc>
+struct Trait<visioncpp::internal::PitchedAccessor<Acc>> : Trait<Acc> {};
+/// specialisation of the Trait class when the accessor is on an Image memory.
+/// The evaluators see the pixels of the image rather than its texels.
+template <typename Acc, typename T>
+struct Trait<visioncpp::internal::ImageAccessor<Acc, T>> {
+  using Type = T;
+  static constexpr int Dim = Trait<Acc>::Dim;
+  static constexpr size_t scope = scope::Global;
+};
+
+/// specialisation of the Trait class when the accessor is on a Planar2D
+/// memory. The evaluators see the pixels rather than their channels.
+template <typename Acc, typename T>
+struct Trait<visioncpp::internal::PlanarAccessor<Acc, T>> : Trait<Acc> {
+  using Type = T;
+};
+
+/// \struct PacketSize
+/// \brief PacketSize gives the number of pixels evaluated at a time by a point
+/// operation kernel writing pixels of type T. It is the number of channels of
+/// T fitting in 32 bytes, from 4 to 16 pixels.
+template <typename T>
+struct PacketSize {
+  static constexpr size_t Channels =
+      32 / sizeof(typename MemoryProperties<T>::ChannelType);
+  static constexpr size_t Value =
+      Channels < 4 ? 4 : (Channels > 16 ? 16 : Channels);
+};
+
+/// \struct PacketOp
+/// \brief PacketOp checks whether the functor OP provides a packet member
+/// writing the packet Out from the packets In.
+template <typename OP, typename Out, typename... In>
+struct PacketOp {
+  template <typename F>
+  static auto test(int) -> decltype(
+      std::declval<F &>().packet(std::declval<const In &>()...,
+                                 std::declval<Out &>()),
+      std::true_type());
+  template <typename F>
+  static std::false_type test(...);
+  static constexpr bool Provided = decltype(test<OP>(0))::value;
+};
+
+/// function apply_packet
+/// \brief applies the functor OP to packets of pixels through its packet
+/// member.
+/// template parameters:
+/// \tparam OP: the functor
+/// function parameters:
+/// \param out: the packet of the results of the functor
+/// \param in: the packets of the operands of the functor
+template <typename OP, typename Out, size_t W, typename... In>
+static inline typename std::enable_if<PacketOp<
+    OP, pixel::Packet<Out, W>, pixel::Packet<In, W>...>::Provided>::type
+apply_packet(pixel::Packet<Out, W> &out, const pixel::Packet<In, W> &... in) {
+  OP().packet(in..., out);
+}
+/// \brief applies the functor OP to each pixel of the packets when it has no
+/// packet member writing pixels of type Out
+template <typename OP, typename Out, size_t W, typename... In>
+static inline typename std::enable_if<!PacketOp<
+    OP, pixel::Packet<Out, W>, pixel::Packet<In, W>...>::Provided>::type
+apply_packet(pixel::Packet<Out, W> &out, const pixel::Packet<In, W> &... in) {
+  for (size_t k = 0; k < W; k++) {
+    out[k] = tools::convert<Out>(OP()(in[k]...));
+  }
+}
+
+/// \struct PacketExpr
+/// \brief PacketExpr checks whether a point operation expression is worth
+/// evaluating W pixels at a time, which is when at least one of its functors
+/// provides a packet member. The other expressions are evaluated a pixel at a
+/// time.
+/// template parameters:
+/// \tparam W: the number of pixels of the packets
+/// \tparam Expr: the expression
+template <size_t W, typename Expr>
+struct PacketExpr {
+  static constexpr bool Value = false;
+};
+/// \brief specialisation of the PacketExpr when the expression is an
+/// internal::RUnOP
+template <size_t W, typename UN_OP, typename Nested, size_t Cols, size_t Rows,
+          size_t LfType, size_t LVL>
+struct PacketExpr<W, RUnOP<UN_OP, Nested, Cols, Rows, LfType, LVL>> {
+  static constexpr bool Value =
+      PacketOp<typename UN_OP::OP, pixel::Packet<typename UN_OP::OutType, W>,
+               pixel::Packet<typename UN_OP::InType, W>>::Provided ||
+      PacketExpr<W, Nested>::Value;
+};
+/// \brief specialisation of the PacketExpr when the expression is an
+/// internal::RBiOP
+template <size_t W, typename BI_OP, typename LHS, typename RHS, size_t Cols,
+          size_t Rows, size_t LfType, size_t LVL>
+struct PacketExpr<W, RBiOP<BI_OP, LHS, RHS, Cols, Rows, LfType, LVL>> {
+  static constexpr bool Value =
+      PacketOp<typename BI_OP::OP, pixel::Packet<typename BI_OP::OutType, W>,
+               pixel::Packet<typename BI_OP::InType1, W>,
+               pixel::Packet<typename BI_OP::InType2, W>>::Provided ||
+      PacketExpr<W, LHS>::Value || PacketExpr<W, RHS>::Value;
+};
+/// \brief specialisation of the PacketExpr when the expression is an
+/// internal::Assign
+template <size_t W, typename LHS, typename RHS, size_t Cols, size_t Rows,
+          size_t LfType, size_t LVL>
+struct PacketExpr<W, Assign<LHS, RHS, Cols, Rows, LfType, LVL>> {
+  static constexpr bool Value = PacketExpr<W, RHS>::Value;
+};
 
 /// \struct Index_Finder This struct is used to find the index required to
 /// access the accessor inside the buffer.
@@ -228,6 +366,8 @@ struct Evaluator;
 /// memory
 /// \param Halo_Right: pass the right side value of halo for column of the local
 /// memory
+/// \param Border: the visioncpp::border_type of the nearest neighbour operation
+/// above the node, used by the leaves to load the halo outside of the image
 /// \param Offset: determines the starting location of the local output memory
 /// in the input tuple.
 /// \param Index: represent the distance of the local memory in the tuple for
@@ -273,8 +413,8 @@ struct OutputLocation<true, OutOffset> {
 };
 /// \brief template deduction for Fill struct.
 template <size_t Halo_Top, size_t Halo_Left, size_t Halo_Butt,
-          size_t Halo_Right, size_t Offset, size_t LC, size_t LR, size_t Sc,
-          typename Expr, typename Loc, typename... Params>
+          size_t Halo_Right, size_t Border, size_t Offset, size_t LC, size_t LR,
+          size_t Sc, typename Expr, typename Loc, typename... Params>
 static void fill_local_neighbour(
     Loc &cOffset, const internal::tools::tuple::Tuple<Params...> &t);
 
@@ -289,6 +429,67 @@ inline void eval(Loc &cOffset, const tools::tuple::Tuple<Params...> &t) {
   Evaluator<Expr::Operation_type, Index, Offset, LC, LR, Expr, Loc,
             Params...>::eval(cOffset, t);
 }
+
+/// \struct InteriorSplit
+/// \brief InteriorSplit checks whether the tiles of a kernel are evaluated
+/// without the border checks when they lie inside the images with their halo.
+/// This is the case of the neighbour operation kernels writing to an Assign
+/// whose leaves all have the size of the threads, so that the memories read by
+/// an interior tile are the ones it was checked against. The other kernels are
+/// always evaluated with the border checks.
+template <typename Expr>
+struct InteriorSplit {
+  static constexpr bool Value = false;
+};
+/// \brief specialisation of the InteriorSplit when the expression is an
+/// internal::Assign
+template <typename LHS, typename RHS, size_t Cols, size_t Rows, size_t LfType,
+          size_t LVL>
+struct InteriorSplit<Assign<LHS, RHS, Cols, Rows, LfType, LVL>> {
+  using Expr = Assign<LHS, RHS, Cols, Rows, LfType, LVL>;
+  static constexpr bool Value =
+      Expr::Operation_type == ops_category::NeighbourOP &&
+      InteriorLeaves<RHS::ND_Category, RHS, Expr::CThread,
+                     Expr::RThread>::Value;
+};
+
+/// \brief evaluates the tile of the work-group with the border checks when the
+/// kernel is not split in interior and border tiles
+template <size_t Offset, size_t LC, size_t LR, typename Expr, typename Loc,
+          typename... Params>
+inline void eval_tile(Loc &cOffset, const tools::tuple::Tuple<Params...> &t,
+                      std::false_type) {
+  eval<Offset, LC, LR, Expr>(cOffset, t);
+}
+/// \brief evaluates the tile of the work-group without the border checks when
+/// the tile and its halo lie inside the image, and with them otherwise. The
+/// branch is the same for all the work-items of a work-group.
+template <size_t Offset, size_t LC, size_t LR, typename Expr, typename Loc,
+          typename... Params>
+inline void eval_tile(Loc &cOffset, const tools::tuple::Tuple<Params...> &t,
+                      std::true_type) {
+  constexpr size_t Margin = HaloMargin<Expr::ND_Category, Expr>::Value;
+  const size_t c = cOffset.g_c - cOffset.l_c;
+  const size_t r = cOffset.g_r - cOffset.l_r;
+  if (c >= Margin && r >= Margin &&
+      c + LC + Margin <= extent_cols<Expr::CThread>(cOffset) &&
+      r + LR + Margin <= extent_rows<Expr::RThread>(cOffset)) {
+    auto interior = Coordinate<LC, LR, decltype(cOffset.itemID),
+                               decltype(cOffset.ext), true>(cOffset);
+    eval<Offset, LC, LR, Expr>(interior, t);
+  } else {
+    eval<Offset, LC, LR, Expr>(cOffset, t);
+  }
+}
+/// \brief deduction function evaluating the tile of the work-group. The tiles
+/// of a neighbour operation kernel whose halo lies inside the images are
+/// evaluated without the border checks, and the ones of the rim with them.
+template <size_t Offset, size_t LC, size_t LR, typename Expr, typename Loc,
+          typename... Params>
+inline void eval_tile(Loc &cOffset, const tools::tuple::Tuple<Params...> &t) {
+  eval_tile<Offset, LC, LR, Expr>(
+      cOffset, t, std::integral_constant<bool, InteriorSplit<Expr>::Value>());
+}
 }  // internal
 }  // visioncpp
 
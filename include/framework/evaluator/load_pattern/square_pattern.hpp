@@ -26,6 +26,23 @@
 
 namespace visioncpp {
 namespace internal {
+/// \struct ConstantBorder
+/// \brief ConstantBorder is used to get the pixel read outside of the image for
+/// border_type::Constant, i.e. the value returned by the BorderValue functor
+/// of the neighbour operation.
+/// template parameters
+/// \tparam BorderValue is the functor returning the border value
+/// \tparam T is the pixel type of the local memory
+template <typename BorderValue, typename T>
+struct ConstantBorder {
+  static inline T get() { return tools::convert<T>(BorderValue()()); }
+};
+/// \brief specialisation of the ConstantBorder when no value is given. The
+/// pixel read outside of the image has all of its channels zero.
+template <typename T>
+struct ConstantBorder<ZeroBorder, T> {
+  static inline T get() { return T(); }
+};
 /// \brief Partial specialisation of the Fill when the LeafNode contains the
 /// const variable. In this case we load nothing in to the shared memory as
 /// there is no shared memory for const variable and the const variable directly
@@ -35,7 +52,8 @@ template <size_t N, size_t Rows, size_t Cols, size_t Sc, size_t LVL,
 struct Fill<LeafNode<PlaceHolder<memory_type::Const, N, Cols, Rows, Sc>, LVL>,
             Loc, Params...> {
   template <size_t Halo_Top, size_t Halo_Left, size_t Halo_Butt,
-            size_t Halo_Right, size_t Offset, size_t LC, size_t LR>
+            size_t Halo_Right, size_t Border, typename BorderValue,
+            size_t Offset, size_t LC, size_t LR>
   static void fill_neighbour(Loc &cOffset,
                              const tools::tuple::Tuple<Params...> &t) {
     // no need to do anything the memory is read only
@@ -52,7 +70,8 @@ struct Fill<
     LeafNode<PlaceHolder<Memory_Type, N, Cols, Rows, scope::Constant>, LVL>,
     Loc, Params...> {
   template <size_t Halo_Top, size_t Halo_Left, size_t Halo_Butt,
-            size_t Halo_Right, size_t Offset, size_t LC, size_t LR>
+            size_t Halo_Right, size_t Border, typename BorderValue,
+            size_t Offset, size_t LC, size_t LR>
   static void fill_neighbour(Loc &cOffset,
                              const tools::tuple::Tuple<Params...> &t) {}
 };
@@ -64,25 +83,38 @@ template <size_t Memory_Type, size_t N, size_t Rows, size_t Cols, size_t LVL,
 struct Fill<LeafNode<PlaceHolder<Memory_Type, N, Cols, Rows, Sc>, LVL>, Loc,
             Params...> {
   template <size_t Halo_Top, size_t Halo_Left, size_t Halo_Butt,
-            size_t Halo_Right, size_t Index, size_t LC, size_t LR>
+            size_t Halo_Right, size_t Border, typename BorderValue,
+            size_t Index, size_t LC, size_t LR>
   static void fill_neighbour(Loc &cOffset,
                              const tools::tuple::Tuple<Params...> &t) {
     static_assert(Cols > 0 && LC > 0, "Cols must be greater than 0");
     static_assert(Rows > 0 && LR > 0, "Rows must be greater than 0");
-    // calculation begins from here for unary op
+    const size_t cols = extent_cols<Cols>(cOffset);
+    const size_t rows = extent_rows<Rows>(cOffset);
+    const size_t pitch = row_pitch(tools::tuple::get<N>(t), cols);
+    using LocalType = typename MemoryTrait<
+        Memory_Type, decltype(tools::tuple::get<Index>(t))>::Type;
+    // the halo outside of the image is loaded here once, so the neighbour
+    // operations read the whole tile without checking their coordinates
+    constexpr bool isConstant =
+        !Loc::Interior && Border == border_type::Constant;
     for (int i = 0; i < LC; i += cOffset.cLRng) {
       if ((cOffset.l_c + i < LC)) {
-        size_t val_c = get_global_range<Halo_Left, Cols>(cOffset.g_c + i);
+        size_t val_c = get_global_range<Halo_Left, Border, Loc::Interior>(
+            cOffset.g_c + i, cols);
         for (size_t j = 0; j < LR; j += cOffset.rLRng) {
-          size_t val_r = get_global_range<Halo_Top, Rows>(cOffset.g_r + j);
+          size_t val_r = get_global_range<Halo_Top, Border, Loc::Interior>(
+              cOffset.g_r + j, rows);
           if ((cOffset.l_r + j < LR)) {
             tools::tuple::get<Index>(t)
                 .get_pointer()[(cOffset.l_c + i) + (LC * (cOffset.l_r + j))] =
-                tools::convert<typename MemoryTrait<
-                    Memory_Type, decltype(tools::tuple::get<Index>(t))>::Type>(
-                    tools::tuple::get<N>(t).get_pointer()[calculate_index(
-                        val_c, val_r, Cols, Rows)]);
-            /// FIXME: image cannot be accessed by pointer
+                (isConstant && (val_c == cols || val_r == rows))
+                    ? ConstantBorder<BorderValue, LocalType>::get()
+                    : tools::convert<LocalType>(
+                          tools::tuple::get<N>(t).get_pointer()
+                              [calculate_index<Loc::Interior>(
+                                   val_c, val_r, cols, rows, pitch) +
+                               frame_offset<false>(cOffset, pitch, rows)]);
           }
         }
       }
@@ -94,12 +126,14 @@ struct Fill<LeafNode<PlaceHolder<Memory_Type, N, Cols, Rows, Sc>, LVL>, Loc,
 
 // template deduction for Fill struct.
 template <size_t Halo_Top, size_t Halo_Left, size_t Halo_Butt,
-          size_t Halo_Right, size_t Offset, size_t LC, size_t LR, typename Expr,
-          typename Loc, typename... Params>
+          size_t Halo_Right, size_t Border, typename BorderValue, size_t Offset,
+          size_t LC, size_t LR, typename Expr, typename Loc,
+          typename... Params>
 static void fill_local_neighbour(Loc &cOffset,
                                  const tools::tuple::Tuple<Params...> &t) {
   Fill<Expr, Loc, Params...>::template fill_neighbour<
-      Halo_Top, Halo_Left, Halo_Butt, Halo_Right, Offset, LC, LR>(cOffset, t);
+      Halo_Top, Halo_Left, Halo_Butt, Halo_Right, Border, BorderValue, Offset,
+      LC, LR>(cOffset, t);
 }
 }  // internal
 }  // visioncpp
@@ -0,0 +1,455 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file common_subexpr.hpp
+/// \brief This file contains the common subexpression elimination applied by
+/// the execute function. The expression tree is copied by value, so a node
+/// used by more than one parent is duplicated in the tree and, without manual
+/// schedule, evaluated once per parent.
+
+#ifndef VISIONCPP_INCLUDE_FRAMEWORK_EXECUTOR_COMMON_SUBEXPR_HPP_
+#define VISIONCPP_INCLUDE_FRAMEWORK_EXECUTOR_COMMON_SUBEXPR_HPP_
+
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace visioncpp {
+namespace internal {
+/// \brief the shapes of the nodes visited by the common subexpression
+/// elimination
+namespace cse_shape {
+/// terminal nodes and nodes which are not visited (e.g. pyramids)
+static constexpr size_t Opaque = 0;
+/// nodes with one child stored in rhs
+static constexpr size_t Unary = 1;
+/// nodes with two children stored in lhs and rhs
+static constexpr size_t Binary = 2;
+}
+
+/// \struct CseShape
+/// \brief CseShape gives the shape of a node. This is the generic case used
+/// for the terminal nodes and the nodes which are not visited.
+template <typename Node>
+struct CseShape {
+  static constexpr size_t Value = cse_shape::Opaque;
+};
+
+/// \brief specialisation of CseShape for the unary point operation
+template <typename OP, typename RHS, size_t Cols, size_t Rows, size_t LfType,
+          size_t LVL>
+struct CseShape<RUnOP<OP, RHS, Cols, Rows, LfType, LVL>> {
+  static constexpr size_t Value = cse_shape::Unary;
+};
+
+/// \brief specialisation of CseShape for the neighbour operation without
+/// filter
+template <typename OP, size_t Halo_T, size_t Halo_L, size_t Halo_B,
+          size_t Halo_R, typename RHS, size_t Cols, size_t Rows, size_t LfType,
+          size_t LVL>
+struct CseShape<StnNoFilt<OP, Halo_T, Halo_L, Halo_B, Halo_R, RHS, Cols, Rows,
+                          LfType, LVL>> {
+  static constexpr size_t Value = cse_shape::Unary;
+};
+
+/// \brief specialisation of CseShape for the reduction
+template <typename OP, typename RHS, size_t Cols, size_t Rows, size_t LfType,
+          size_t LVL>
+struct CseShape<RDCN<OP, RHS, Cols, Rows, LfType, LVL>> {
+  static constexpr size_t Value = cse_shape::Unary;
+};
+
+/// \brief specialisation of CseShape for the binary point operation
+template <typename OP, typename LHS, typename RHS, size_t Cols, size_t Rows,
+          size_t LfType, size_t LVL>
+struct CseShape<RBiOP<OP, LHS, RHS, Cols, Rows, LfType, LVL>> {
+  static constexpr size_t Value = cse_shape::Binary;
+};
+
+/// \brief specialisation of CseShape for the neighbour operation with filter
+template <typename OP, size_t Halo_T, size_t Halo_L, size_t Halo_B,
+          size_t Halo_R, typename LHS, typename RHS, size_t Cols, size_t Rows,
+          size_t LfType, size_t LVL>
+struct CseShape<StnFilt<OP, Halo_T, Halo_L, Halo_B, Halo_R, LHS, RHS, Cols,
+                        Rows, LfType, LVL>> {
+  static constexpr size_t Value = cse_shape::Binary;
+};
+
+/// \brief specialisation of CseShape for the assign
+template <typename LHS, typename RHS, size_t Cols, size_t Rows, size_t LfType,
+          size_t LVL>
+struct CseShape<Assign<LHS, RHS, Cols, Rows, LfType, LVL>> {
+  static constexpr size_t Value = cse_shape::Binary;
+};
+
+/// \struct CseCount
+/// \brief CseCount counts the occurrences of the node type T in the tree of
+/// Node. This is the case of the nodes which are not visited.
+template <typename T, typename Node, size_t Shape = CseShape<Node>::Value>
+struct CseCount {
+  static constexpr size_t Value = std::is_same<T, Node>::value ? 1 : 0;
+};
+
+/// \brief specialisation of CseCount for the nodes with one child
+template <typename T, typename Node>
+struct CseCount<T, Node, cse_shape::Unary> {
+  static constexpr size_t Value = (std::is_same<T, Node>::value ? 1 : 0) +
+                                  CseCount<T, typename Node::RHSExpr>::Value;
+};
+
+/// \brief specialisation of CseCount for the nodes with two children
+template <typename T, typename Node>
+struct CseCount<T, Node, cse_shape::Binary> {
+  static constexpr size_t Value = (std::is_same<T, Node>::value ? 1 : 0) +
+                                  CseCount<T, typename Node::LHSExpr>::Value +
+                                  CseCount<T, typename Node::RHSExpr>::Value;
+};
+
+/// \struct CseSameMemory
+/// \brief CseSameMemory checks whether two terminal memories of the same type
+/// are the same memory. A memory is only the same as itself and its copies.
+template <typename Memory>
+struct CseSameMemory {
+  static inline bool equal(const Memory &, const Memory &) { return false; }
+};
+
+/// \brief specialisation of CseSameMemory for VisionMemory. Copies of a
+/// VisionMemory share its sycl buffer.
+template <bool MapAllocator, size_t ScalarType, size_t MemoryType,
+          typename Sclr, size_t Col, size_t Row, typename ElementTp,
+          size_t Elements, size_t Sc, size_t LVL>
+struct CseSameMemory<VisionMemory<MapAllocator, ScalarType, MemoryType, Sclr,
+                                  Col, Row, ElementTp, Elements, Sc, LVL>> {
+  using Memory = VisionMemory<MapAllocator, ScalarType, MemoryType, Sclr, Col,
+                              Row, ElementTp, Elements, Sc, LVL>;
+  static inline bool equal(const Memory &a, const Memory &b) {
+    return a.syclData.get() == b.syclData.get();
+  }
+};
+
+/// \brief specialisation of CseSameMemory for VirtualMemory. Copies of a
+/// VirtualMemory share its evaluation state.
+template <policy::PolicyType PlcType, typename Node, size_t LC, size_t LR,
+          size_t LCT, size_t LRT>
+struct CseSameMemory<VirtualMemory<PlcType, Node, LC, LR, LCT, LRT>> {
+  using Memory = VirtualMemory<PlcType, Node, LC, LR, LCT, LRT>;
+  static inline bool equal(const Memory &a, const Memory &b) {
+    return a.result.get() == b.result.get();
+  }
+};
+
+/// \struct CseSame
+/// \brief CseSame checks at runtime whether two subtrees of the same type read
+/// the same terminal memories, in which case they compute the same result.
+/// This is the case of the nodes which are not visited, which are never
+/// considered the same.
+template <typename Node, size_t Shape = CseShape<Node>::Value>
+struct CseSame {
+  static inline bool equal(const Node &, const Node &) { return false; }
+};
+
+/// \brief specialisation of CseSame for the terminal nodes
+template <typename RHS, size_t LVL>
+struct CseSame<LeafNode<RHS, LVL>, cse_shape::Opaque> {
+  static inline bool equal(const LeafNode<RHS, LVL> &a,
+                           const LeafNode<RHS, LVL> &b) {
+    return CseSameMemory<RHS>::equal(a.vilibMemory, b.vilibMemory);
+  }
+};
+
+/// \brief specialisation of CseSame for the pyramid outputs. They are the same
+/// when they come from the same pyramid.
+template <typename PyramidT, size_t N>
+struct CseSame<PyramidLeafNode<PyramidT, N>, cse_shape::Opaque> {
+  static inline bool equal(const PyramidLeafNode<PyramidT, N> &a,
+                           const PyramidLeafNode<PyramidT, N> &b) {
+    return &a.rhs == &b.rhs;
+  }
+};
+
+/// \brief specialisation of CseSame for the nodes with one child
+template <typename Node>
+struct CseSame<Node, cse_shape::Unary> {
+  static inline bool equal(const Node &a, const Node &b) {
+    return CseSame<typename Node::RHSExpr>::equal(a.rhs, b.rhs);
+  }
+};
+
+/// \brief specialisation of CseSame for the nodes with two children
+template <typename Node>
+struct CseSame<Node, cse_shape::Binary> {
+  static inline bool equal(const Node &a, const Node &b) {
+    return CseSame<typename Node::LHSExpr>::equal(a.lhs, b.lhs) &&
+           CseSame<typename Node::RHSExpr>::equal(a.rhs, b.rhs);
+  }
+};
+
+/// \class CseRegistry
+/// \brief CseRegistry keeps the shared subtrees found while the expression is
+/// rewritten, so the identical ones are replaced by the same scheduled node.
+class CseRegistry {
+  struct Entry {
+    const void *tag;
+    const void *node;
+    std::shared_ptr<void> leaf;
+  };
+  std::vector<Entry> entries;
+
+  template <typename Node>
+  static const void *tag() {
+    static const char id = 0;
+    return &id;
+  }
+
+ public:
+  /// true when at least two subtrees were found to be the same
+  bool shared = false;
+
+  /// \brief returns the entry of a subtree which is the same as node, or null
+  template <typename Node>
+  Entry *find(const Node &node) {
+    for (auto &e : entries) {
+      if (e.tag == tag<Node>() &&
+          CseSame<Node>::equal(*static_cast<const Node *>(e.node), node)) {
+        shared = true;
+        return &e;
+      }
+    }
+    return nullptr;
+  }
+
+  /// \brief registers the subtree node and the scheduled node replacing it
+  template <typename Node, typename Leaf>
+  void add(const Node &node, std::shared_ptr<Leaf> leaf) {
+    entries.push_back(Entry{tag<Node>(), &node, leaf});
+  }
+};
+
+/// \struct CseWorth
+/// \brief CseWorth decides whether a subtree used Count times is computed once
+/// in a separate kernel or recomputed by each of its parents. The costs are
+/// the ones of the auto scheduler. Sharing a subtree costs a kernel launch, the
+/// write of its output and Count reads of it. Cheap point operations are
+/// usually recomputed in the kernel of each parent, while neighbour operations
+/// are usually shared.
+template <size_t LC, size_t LR, size_t LCT, size_t LRT, typename Node,
+          size_t Count>
+struct CseWorth {
+  using CM = AutoCostModel;
+  using Plan = AutoPlan<LC, LR, LCT, LRT, 0, 0, CM, Node>;
+  static constexpr size_t Tiles =
+      ((Node::Type::Cols + LC - 1) / LC) * ((Node::Type::Rows + LR - 1) / LR);
+  static constexpr size_t Recompute = Count * Plan::Cost;
+  static constexpr size_t Share =
+      Plan::Cost + CM::LaunchCost / Tiles +
+      (1 + Count) * LC * LR * sizeof(typename Node::OutType) * CM::ByteCost;
+  static constexpr bool Value = Count > 1 && Recompute > Share;
+};
+
+/// \struct CseRewrite
+/// \brief CseRewrite replaces the subtrees which are worth sharing by a
+/// scheduled node (VirtualMemory). The subtrees found to be the same at
+/// runtime get the same scheduled node, which is evaluated once per execution.
+/// template parameters:
+/// \tparam ExecPolicy: the policy used for the shared subtrees
+/// \tparam LC: is the column size of local memory
+/// \tparam LR: is the row size of local memory
+/// \tparam LCT: is the column size of workgroup
+/// \tparam LRT: is the row size of workgroup
+/// \tparam Root: the type of the whole expression
+/// \tparam Outer: the nearest shared ancestor of the node, or the root. The
+/// nodes inside a shared subtree are counted once for all its copies.
+/// \tparam Node: the type of the node
+/// \tparam Top: true when the node is the top of a shared subtree
+template <policy::PolicyType ExecPolicy, size_t LC, size_t LR, size_t LCT,
+          size_t LRT, typename Root, typename Outer, typename Node,
+          bool Top = false, size_t Shape = CseShape<Node>::Value>
+struct CseRewrite;
+
+/// \struct CseBody
+/// \brief CseBody rewrites the children of a node.
+template <policy::PolicyType ExecPolicy, size_t LC, size_t LR, size_t LCT,
+          size_t LRT, typename Root, typename Outer, typename Node,
+          size_t Shape>
+struct CseBody {
+  using Type = Node;
+  static constexpr size_t Shared = 0;
+  static inline Type get(Node &node, CseRegistry &) { return node; }
+  static inline void scan(const Node &, CseRegistry &) {}
+};
+
+/// \brief specialisation of CseBody for the nodes with one child
+template <policy::PolicyType ExecPolicy, size_t LC, size_t LR, size_t LCT,
+          size_t LRT, typename Root, typename Outer, typename Node>
+struct CseBody<ExecPolicy, LC, LR, LCT, LRT, Root, Outer, Node,
+               cse_shape::Unary> {
+  using Child = CseRewrite<ExecPolicy, LC, LR, LCT, LRT, Root, Outer,
+                           typename Node::RHSExpr>;
+  using Type = typename Node::template ExprExchange<typename Child::Type>;
+  static constexpr size_t Shared = Child::Shared;
+  static inline Type get(Node &node, CseRegistry &reg) {
+    return Type(Child::get(node.rhs, reg));
+  }
+  static inline void scan(const Node &node, CseRegistry &reg) {
+    Child::scan(node.rhs, reg);
+  }
+};
+
+/// \brief specialisation of CseBody for the nodes with two children
+template <policy::PolicyType ExecPolicy, size_t LC, size_t LR, size_t LCT,
+          size_t LRT, typename Root, typename Outer, typename Node>
+struct CseBody<ExecPolicy, LC, LR, LCT, LRT, Root, Outer, Node,
+               cse_shape::Binary> {
+  using LHSChild = CseRewrite<ExecPolicy, LC, LR, LCT, LRT, Root, Outer,
+                              typename Node::LHSExpr>;
+  using RHSChild = CseRewrite<ExecPolicy, LC, LR, LCT, LRT, Root, Outer,
+                              typename Node::RHSExpr>;
+  using Type = typename Node::template ExprExchange<typename LHSChild::Type,
+                                                    typename RHSChild::Type>;
+  static constexpr size_t Shared = LHSChild::Shared + RHSChild::Shared;
+  static inline Type get(Node &node, CseRegistry &reg) {
+    return Type(LHSChild::get(node.lhs, reg), RHSChild::get(node.rhs, reg));
+  }
+  static inline void scan(const Node &node, CseRegistry &reg) {
+    LHSChild::scan(node.lhs, reg);
+    RHSChild::scan(node.rhs, reg);
+  }
+};
+
+/// \brief the rewrite of a node which is not shared
+template <policy::PolicyType ExecPolicy, size_t LC, size_t LR, size_t LCT,
+          size_t LRT, typename Root, typename Outer, typename Node, bool Top,
+          size_t Shape, bool Share>
+struct CseNode
+    : CseBody<ExecPolicy, LC, LR, LCT, LRT, Root, Outer, Node, Shape> {};
+
+/// \brief the rewrite of a shared node. The node is replaced by a scheduled
+/// node whose subtree is rewritten with the node as the outer shared node.
+template <policy::PolicyType ExecPolicy, size_t LC, size_t LR, size_t LCT,
+          size_t LRT, typename Root, typename Outer, typename Node,
+          size_t Shape>
+struct CseNode<ExecPolicy, LC, LR, LCT, LRT, Root, Outer, Node, false, Shape,
+               true> {
+  using Inner =
+      CseRewrite<ExecPolicy, LC, LR, LCT, LRT, Root, Node, Node, true>;
+  using Memory = VirtualMemory<ExecPolicy, typename Inner::Type, LC, LR, LCT,
+                               LRT>;
+  using Type = LeafNode<Memory, Node::Level>;
+  static constexpr size_t Shared = 1 + Inner::Shared;
+  static inline Type get(Node &node, CseRegistry &reg) {
+    if (auto e = reg.find(node)) {
+      return *std::static_pointer_cast<Type>(e->leaf);
+    }
+    auto leaf = std::make_shared<Type>(Memory(Inner::get(node, reg)));
+    reg.add(node, leaf);
+    return *leaf;
+  }
+  static inline void scan(const Node &node, CseRegistry &reg) {
+    if (!reg.find(node)) {
+      reg.add(node, std::shared_ptr<Type>());
+      Inner::scan(node, reg);
+    }
+  }
+};
+
+template <policy::PolicyType ExecPolicy, size_t LC, size_t LR, size_t LCT,
+          size_t LRT, typename Root, typename Outer, typename Node, bool Top,
+          size_t Shape>
+struct CseRewrite
+    : CseNode<ExecPolicy, LC, LR, LCT, LRT, Root, Outer, Node, Top, Shape,
+              (!Top && Shape != cse_shape::Opaque &&
+               !std::is_same<Root, Node>::value &&
+               CseWorth<LC, LR, LCT, LRT, Node,
+                        CseCount<Node, Root>::Value -
+                            (CseCount<Outer, Root>::Value - 1) *
+                                CseCount<Node, Outer>::Value>::Value)> {};
+
+/// \struct CommonSubExpr
+/// \brief CommonSubExpr applies the common subexpression elimination to an
+/// expression. The subtrees of the same type which are worth sharing are found
+/// at compile time, and whether they read the same memories is checked at
+/// runtime. When some of them are the same, the rewritten expression is
+/// executed, where each shared subtree is computed once in a separate kernel
+/// and read by all its parents. Otherwise the expression is executed as it
+/// is. The shared subtrees are executed with the policy of the expression.
+/// The rewritten expression is built again by each execute, which only
+/// copies its nodes: the outputs of the shared subtrees are taken from the
+/// buffer pool of the device (see VirtualMemory), so a repeated execute
+/// allocates no device memory. A Pipeline also keeps the rewritten expression.
+/// template parameters:
+/// \tparam ExecPolicy: the policy used to execute the expression
+/// \tparam LC: is the column size of local memory
+/// \tparam LR: is the row size of local memory
+/// \tparam LCT: is the column size of workgroup
+/// \tparam LRT: is the row size of workgroup
+/// \tparam Expr: the expression type to be executed
+template <policy::PolicyType ExecPolicy, size_t LC, size_t LR, size_t LCT,
+          size_t LRT, typename Expr>
+struct CommonSubExpr {
+  using Rewrite = CseRewrite<ExecPolicy, LC, LR, LCT, LRT, Expr, Expr, Expr>;
+  using Type = typename Rewrite::Type;
+  /// the number of subtrees which may be shared
+  static constexpr size_t Candidates = Rewrite::Shared;
+
+  /// \brief returns the rewritten expression. reg.shared tells whether the
+  /// rewritten expression has shared subtrees.
+  static inline Type get(Expr &expr, CseRegistry &reg) {
+    return Rewrite::get(expr, reg);
+  }
+
+  /// \brief checks whether the expression has shared subtrees without
+  /// rewriting it
+  static inline bool has_shared(const Expr &expr) {
+    CseRegistry reg;
+    Rewrite::scan(expr, reg);
+    return reg.shared;
+  }
+
+  template <bool HasCandidates, typename Dummy = void>
+  struct Run {
+    template <typename DeviceT>
+    static inline void execute(Expr &expr, const DeviceT &dev) {
+      execute_planned<ExecPolicy, LC, LR, LCT, LRT>(expr, dev);
+    }
+  };
+  template <typename Dummy>
+  struct Run<true, Dummy> {
+    template <typename DeviceT>
+    static inline void execute(Expr &expr, const DeviceT &dev) {
+      if (has_shared(expr)) {
+        CseRegistry reg;
+        auto shared = get(expr, reg);
+        execute_planned<ExecPolicy, LC, LR, LCT, LRT>(shared, dev);
+      } else {
+        execute_planned<ExecPolicy, LC, LR, LCT, LRT>(expr, dev);
+      }
+    }
+  };
+
+  /// \brief executes the expression, or its rewritten form when it has shared
+  /// subtrees
+  template <typename DeviceT>
+  static inline void execute(Expr &expr, const DeviceT &dev) {
+    Run<(Candidates > 0)>::execute(expr, dev);
+  }
+};
+}  // internal
+}  // visioncpp
+#endif  // VISIONCPP_INCLUDE_FRAMEWORK_EXECUTOR_COMMON_SUBEXPR_HPP_
@@ -24,6 +24,8 @@
 #ifndef VISIONCPP_INCLUDE_FRAMEWORK_EXECUTOR_EXECUTOR_HPP_
 #define VISIONCPP_INCLUDE_FRAMEWORK_EXECUTOR_EXECUTOR_HPP_
 
+#include <stdexcept>
+
 namespace visioncpp {
 namespace internal {
 
@@ -73,11 +75,15 @@ struct NoFuseExpr;
 template <bool Conds, bool ParentConds, size_t Category, typename Expr, typename DeviceT>
 struct IfExprExecNeeded;
 
+/// \brief the definition is in \ref KernelLabel
+template <typename Node>
+struct KernelLabel;
+
 /// \struct Executor
 /// \brief The Executor struct is used to specialise the execute function for
 /// different avaiable policies at compile time.
-template <bool ExecPolicy, size_t LC, size_t LR, size_t LCT, size_t LRT,
-          typename Expr, typename DeviceT>
+template <policy::PolicyType ExecPolicy, size_t LC, size_t LR, size_t LCT,
+          size_t LRT, typename Expr, typename DeviceT>
 struct Executor;
 
 /// \brief specialisaton of Execute function when the policy is fuse.
@@ -105,14 +111,36 @@ struct Executor<policy::NoFuse, LC, LR, LCT, LRT, Expr, DeviceT> {
   }
 };
 
+/// \struct PolicyPlan
+/// \brief PolicyPlan is used to prepare the expression for the policy used to
+/// execute it. The Fuse and NoFuse policies execute the expression as it is.
+/// The Auto policy is specialised in auto.hpp: it returns a copy of the
+/// expression where the auto scheduler has added its kernel breaks, which is
+/// then executed with the Fuse policy.
+/// template parameters:
+/// \tparam ExecPolicy: the policy selected by the user
+/// \tparam LC: is the column size of local memory
+/// \tparam LR: is the row size of local memory
+/// \tparam LCT: is the column size of workgroup
+/// \tparam LRT: is the row size of workgroup
+/// \tparam Expr: the expression type to be executed
+template <policy::PolicyType ExecPolicy, size_t LC, size_t LR, size_t LCT,
+          size_t LRT, typename Expr>
+struct PolicyPlan {
+  /// the policy used to execute the planned expression
+  static constexpr policy::PolicyType Policy = ExecPolicy;
+  using Type = Expr;
+  static inline Type &get(Expr &expr) { return expr; }
+};
+
 /// \struct SubExprExecute
 /// \brief it is used to statically determine whether or not a subexpression
 /// execution is needed. It increases the execution time by avoiding executing
 /// the subexpression when it is not needed. Using this
 /// struct with sub_expression_evaluation parameter in every non-terminal node,
 /// it is possible to determine such condition at compile time.
-template <bool Val, bool ExecPolicy, size_t LC, size_t LR, size_t LCT,
-          size_t LRT, typename Expr, typename DeviceT>
+template <bool Val, policy::PolicyType ExecPolicy, size_t LC, size_t LR,
+          size_t LCT, size_t LRT, typename Expr, typename DeviceT>
 struct SubExprExecute {
   static void inline execute(Expr &expr, const DeviceT &dev) {
     expr.reset(true);
@@ -127,20 +155,114 @@ struct SubExprExecute {
 };
 /// \brief specialisation of the status of when there is no need for
 /// subexpression execution
-template <bool ExecPolicy, size_t LC, size_t LR, size_t LCT, size_t LRT,
-          typename Expr, typename DeviceT>
+template <policy::PolicyType ExecPolicy, size_t LC, size_t LR, size_t LCT,
+          size_t LRT, typename Expr, typename DeviceT>
 struct SubExprExecute<false, ExecPolicy, LC, LR, LCT, LRT, Expr, DeviceT> {
   static void inline execute(Expr &expr, const DeviceT &dev) {
     Executor<ExecPolicy, LC, LR, LCT, LRT, Expr, DeviceT>::execute(expr, dev);
   }
 };
 
+/// function execute_planned
+/// \brief executes the expression with the given policy once the common
+/// subexpressions have been eliminated. The expression is prepared by
+/// PolicyPlan and broken into subexpressions when needed.
+/// template parameters:
+/// \tparam ExecPolicy: the policy selected by the user
+/// \tparam LC: is the column size of local memory
+/// \tparam LR: is the row size of local memory
+/// \tparam LCT: is the column size of workgroup
+/// \tparam LRT: is the row size of workgroup
+/// function parameters:
+/// \param expr: the expression to be executed
+/// \param dev: the selected device for executing the expression
+/// \return void
+template <policy::PolicyType ExecPolicy, size_t LC, size_t LR, size_t LCT,
+          size_t LRT, typename Expr, typename DeviceT>
+void inline execute_planned(Expr &expr, const DeviceT &dev) {
+  using Plan = PolicyPlan<ExecPolicy, LC, LR, LCT, LRT, Expr>;
+  using PlannedExpr = typename Plan::Type;
+  auto &&planned = Plan::get(expr);
+  SubExprExecute<PlannedExpr::SubExpressionEvaluationNeeded, Plan::Policy, LC,
+                 LR, LCT, LRT, PlannedExpr, DeviceT>::execute(planned, dev);
+}
+
+/// \brief the definition is in \ref CommonSubExpr
+template <policy::PolicyType ExecPolicy, size_t LC, size_t LR, size_t LCT,
+          size_t LRT, typename Expr>
+struct CommonSubExpr;
+
+/// function make_extent
+/// \brief creates the runtime size of an expression. The Cols and Rows of the
+/// root of the expression are its capacity, so the runtime size must not be
+/// bigger.
+/// template parameters:
+/// \tparam Expr: the expression type to be executed
+/// function parameters:
+/// \param cols: the runtime column size of the root of the expression
+/// \param rows: the runtime row size of the root of the expression
+/// \return DynamicExtent
+template <typename Expr>
+inline DynamicExtent<Expr::Type::Cols, Expr::Type::Rows> make_extent(
+    size_t cols, size_t rows) {
+  if (cols == 0 || rows == 0 || cols > Expr::Type::Cols ||
+      rows > Expr::Type::Rows) {
+    throw std::invalid_argument(
+        "The runtime image size must be in (0, 0) .. (Cols, Rows) of the "
+        "expression");
+  }
+  return DynamicExtent<Expr::Type::Cols, Expr::Type::Rows>(cols, rows);
+}
+
+/// function make_roi_extent
+/// \brief creates the extent of a region of interest of the root of an
+/// expression. The region is widened by the halo margin of the expression, so
+/// that the intermediate results read by a neighbour operation of a later
+/// kernel are computed around the region as well.
+/// template parameters:
+/// \tparam Expr: the expression type to be executed
+/// function parameters:
+/// \param col: the first column of the region
+/// \param row: the first row of the region
+/// \param cols: the column size of the region
+/// \param rows: the row size of the region
+/// \return RoiExtent
+template <typename Expr>
+inline RoiExtent<Expr::Type::Cols, Expr::Type::Rows> make_roi_extent(
+    size_t col, size_t row, size_t cols, size_t rows) {
+  if (cols == 0 || rows == 0 || col + cols > Expr::Type::Cols ||
+      row + rows > Expr::Type::Rows) {
+    throw std::invalid_argument(
+        "The region of interest must be a non-empty part of the expression");
+  }
+  constexpr size_t Margin = HaloMargin<Expr::ND_Category, Expr>::Value;
+  const size_t endCol = col + cols + Margin;
+  const size_t endRow = row + rows + Margin;
+  return RoiExtent<Expr::Type::Cols, Expr::Type::Rows>(
+      col > Margin ? col - Margin : 0, row > Margin ? row - Margin : 0,
+      endCol < Expr::Type::Cols ? endCol : Expr::Type::Cols,
+      endRow < Expr::Type::Rows ? endRow : Expr::Type::Rows);
+}
+
+/// function make_batch_extent
+/// \brief creates the size of a batch of frames
+/// \param frames: the number of frames of the batch
+/// \return BatchExtent
+inline BatchExtent make_batch_extent(size_t frames) {
+  if (frames == 0) {
+    throw std::invalid_argument("A batch must have at least one frame");
+  }
+  return BatchExtent(frames);
+}
 }  // internal
 
 /// \brief execute function is called by user in order to execute an expression
+/// Subtrees used by more than one node, e.g. a filtered image feeding both
+/// derivatives, are computed once when they read the same memories and
+/// recomputing them would cost more than storing them (see CommonSubExpr).
 /// template parameters:
 /// \tparam ExecPolicy: determining which policy to be used for executing an
-/// expression. this can be Fuse or NoFuse
+/// expression. this can be Fuse, NoFuse or Auto
 /// \tparam LC the column size for local memory when needed
 /// \tparam LR the row size for column memory when needed
 /// \tparam LCT the size of the workgroup column.
@@ -150,30 +272,255 @@ struct SubExprExecute<false, ExecPolicy, LC, LR, LCT, LRT, Expr, DeviceT> {
 /// \param expr the expression to be executed
 /// \param dev the selected device for executing the expression
 /// \return void
-template <bool ExecPolicy, size_t LC, size_t LR, size_t LCT, size_t LRT,
-          typename Expr, typename DeviceT>
+template <policy::PolicyType ExecPolicy, size_t LC, size_t LR, size_t LCT,
+          size_t LRT, typename Expr, typename DeviceT>
 void inline execute(Expr &expr, const DeviceT &dev) {
-  internal::SubExprExecute<Expr::SubExpressionEvaluationNeeded, ExecPolicy, LC,
-                           LR, LCT, LRT, Expr, DeviceT>::execute(expr, dev);
+  internal::TraceScope scope("host", "execute");
+  internal::CommonSubExpr<ExecPolicy, LC, LR, LCT, LRT, Expr>::execute(expr,
+                                                                       dev);
 }
 
 /// \brief special case of the execute function with default value for local
 /// memory and workgroup size
 /// template parameters:
 /// \tparam ExecPolicy: determining which policy to be used for executing an
-/// expression. this can be Fuse or NoFuse
+/// expression. this can be Fuse, NoFuse or Auto
 /// \tparam Expr: the expression type to be executed.
 /// function parameters:
 /// \param expr: the expression to be executed
 /// \param dev : the selected device for executing the expression
 /// \return void
-template <bool ExecPolicy, typename Expr, typename DeviceT>
+template <policy::PolicyType ExecPolicy, typename Expr, typename DeviceT>
 void inline execute(Expr &expr, const DeviceT &dev) {
-  internal::SubExprExecute<Expr::SubExpressionEvaluationNeeded, ExecPolicy, 8,
-                           8, 8, 8, Expr, DeviceT>::execute(expr, dev);
+  execute<ExecPolicy, 8, 8, 8, 8>(expr, dev);
+}
+
+/// \brief execute function for images whose size is only known at runtime.
+/// The Cols and Rows template parameters of the terminal nodes are used as the
+/// capacity of their memories, and only the top-left cols x rows part of the
+/// root of the expression is computed. The size of the other nodes is deduced
+/// from their size ratio with the root, e.g. a down-sampled node is half of the
+/// runtime size. The offsets of the pyramid remain the compile-time ones.
+/// template parameters:
+/// \tparam ExecPolicy: determining which policy to be used for executing an
+/// expression. this can be Fuse, NoFuse or Auto
+/// \tparam LC the column size for local memory when needed
+/// \tparam LR the row size for column memory when needed
+/// \tparam LCT the size of the workgroup column.
+/// \tparam LRT the size of the workgroup row.
+/// \tparam Expr the expression type to be executed.
+/// function parameters:
+/// \param expr the expression to be executed
+/// \param dev the selected device for executing the expression
+/// \param cols the runtime column size of the root of the expression
+/// \param rows the runtime row size of the root of the expression
+/// \return void
+template <policy::PolicyType ExecPolicy, size_t LC, size_t LR, size_t LCT,
+          size_t LRT, typename Expr, typename DeviceT>
+void inline execute(Expr &expr, const DeviceT &dev, size_t cols, size_t rows) {
+  auto ext = internal::make_extent<Expr>(cols, rows);
+  execute<ExecPolicy, LC, LR, LCT, LRT>(
+      expr, internal::ExtentDevice<DeviceT, decltype(ext)>(dev, ext));
+}
+
+/// \brief special case of the runtime-sized execute function with default
+/// value for local memory and workgroup size
+/// \param expr: the expression to be executed
+/// \param dev : the selected device for executing the expression
+/// \param cols the runtime column size of the root of the expression
+/// \param rows the runtime row size of the root of the expression
+/// \return void
+template <policy::PolicyType ExecPolicy, typename Expr, typename DeviceT>
+void inline execute(Expr &expr, const DeviceT &dev, size_t cols, size_t rows) {
+  execute<ExecPolicy, 8, 8, 8, 8>(expr, dev, cols, rows);
+}
+
+/// \brief execute_async function is called by user in order to execute an
+/// expression without blocking the host. The kernels of the expression are
+/// submitted to the device in the same order as execute, and a handle is
+/// returned right away. The handle can be waited on with wait(), polled with
+/// is_complete() or chained to a host function with then(). The result can be
+/// read on the host, e.g. with the lock function of the output terminal, once
+/// the handle is complete.
+/// template parameters:
+/// \tparam ExecPolicy: determining which policy to be used for executing an
+/// expression. this can be Fuse, NoFuse or Auto
+/// \tparam LC the column size for local memory when needed
+/// \tparam LR the row size for column memory when needed
+/// \tparam LCT the size of the workgroup column.
+/// \tparam LRT the size of the workgroup row.
+/// \tparam Expr the expression type to be executed.
+/// function parameters:
+/// \param expr the expression to be executed
+/// \param dev the selected device for executing the expression
+/// \return DeviceT::Event
+template <policy::PolicyType ExecPolicy, size_t LC, size_t LR, size_t LCT,
+          size_t LRT, typename Expr, typename DeviceT>
+typename DeviceT::Event inline execute_async(Expr &expr, const DeviceT &dev) {
+  return dev.launch_async([expr](const DeviceT &d) mutable {
+    execute<ExecPolicy, LC, LR, LCT, LRT>(expr, d);
+  });
+}
+
+/// \brief special case of the execute_async function with default value for
+/// local memory and workgroup size
+/// template parameters:
+/// \tparam ExecPolicy: determining which policy to be used for executing an
+/// expression. this can be Fuse, NoFuse or Auto
+/// \tparam Expr: the expression type to be executed.
+/// function parameters:
+/// \param expr: the expression to be executed
+/// \param dev : the selected device for executing the expression
+/// \return DeviceT::Event
+template <policy::PolicyType ExecPolicy, typename Expr, typename DeviceT>
+typename DeviceT::Event inline execute_async(Expr &expr, const DeviceT &dev) {
+  return execute_async<ExecPolicy, 8, 8, 8, 8>(expr, dev);
+}
+
+/// \brief execute_async function for images whose size is only known at
+/// runtime. See the runtime-sized execute function.
+/// \param expr the expression to be executed
+/// \param dev the selected device for executing the expression
+/// \param cols the runtime column size of the root of the expression
+/// \param rows the runtime row size of the root of the expression
+/// \return DeviceT::Event
+template <policy::PolicyType ExecPolicy, size_t LC, size_t LR, size_t LCT,
+          size_t LRT, typename Expr, typename DeviceT>
+typename DeviceT::Event inline execute_async(Expr &expr, const DeviceT &dev,
+                                             size_t cols, size_t rows) {
+  auto ext = internal::make_extent<Expr>(cols, rows);
+  return execute_async<ExecPolicy, LC, LR, LCT, LRT>(
+      expr, internal::ExtentDevice<DeviceT, decltype(ext)>(dev, ext));
+}
+
+/// \brief execute_roi function computes an expression only inside a region of
+/// interest of its root, e.g. the bounding box of a tracked object. Only the
+/// work-groups covering the region are launched, so the cost follows the area
+/// of the region rather than the one of the image. The neighbour operations
+/// read their halos outside of the region, and the pixels inside it are the
+/// same as with the execute function. The pixels of the root outside of the
+/// region are left unchanged, apart from the ones in the work-groups covering
+/// its borders. Pyramid nodes are not supported.
+/// template parameters:
+/// \tparam ExecPolicy: determining which policy to be used for executing an
+/// expression. this can be Fuse, NoFuse or Auto
+/// \tparam LC the column size for local memory when needed
+/// \tparam LR the row size for column memory when needed
+/// \tparam LCT the size of the workgroup column.
+/// \tparam LRT the size of the workgroup row.
+/// \tparam Expr the expression type to be executed.
+/// function parameters:
+/// \param expr the expression to be executed
+/// \param dev the selected device for executing the expression
+/// \param col the first column of the region in the root of the expression
+/// \param row the first row of the region in the root of the expression
+/// \param cols the column size of the region
+/// \param rows the row size of the region
+/// \return void
+template <policy::PolicyType ExecPolicy, size_t LC, size_t LR, size_t LCT,
+          size_t LRT, typename Expr, typename DeviceT>
+void inline execute_roi(Expr &expr, const DeviceT &dev, size_t col,
+                        size_t row, size_t cols, size_t rows) {
+  auto ext = internal::make_roi_extent<Expr>(col, row, cols, rows);
+  execute<ExecPolicy, LC, LR, LCT, LRT>(
+      expr, internal::ExtentDevice<DeviceT, decltype(ext)>(dev, ext));
+}
+
+/// \brief special case of the execute_roi function with default value for
+/// local memory and workgroup size
+/// \param expr: the expression to be executed
+/// \param dev : the selected device for executing the expression
+/// \param col the first column of the region in the root of the expression
+/// \param row the first row of the region in the root of the expression
+/// \param cols the column size of the region
+/// \param rows the row size of the region
+/// \return void
+template <policy::PolicyType ExecPolicy, typename Expr, typename DeviceT>
+void inline execute_roi(Expr &expr, const DeviceT &dev, size_t col,
+                        size_t row, size_t cols, size_t rows) {
+  execute_roi<ExecPolicy, 8, 8, 8, 8>(expr, dev, col, row, cols, rows);
+}
+
+/// \brief execute_async function for a region of interest. See the
+/// execute_roi function.
+/// \param expr the expression to be executed
+/// \param dev the selected device for executing the expression
+/// \param col the first column of the region in the root of the expression
+/// \param row the first row of the region in the root of the expression
+/// \param cols the column size of the region
+/// \param rows the row size of the region
+/// \return DeviceT::Event
+template <policy::PolicyType ExecPolicy, size_t LC, size_t LR, size_t LCT,
+          size_t LRT, typename Expr, typename DeviceT>
+typename DeviceT::Event inline execute_roi_async(Expr &expr,
+                                                 const DeviceT &dev,
+                                                 size_t col, size_t row,
+                                                 size_t cols, size_t rows) {
+  auto ext = internal::make_roi_extent<Expr>(col, row, cols, rows);
+  return execute_async<ExecPolicy, LC, LR, LCT, LRT>(
+      expr, internal::ExtentDevice<DeviceT, decltype(ext)>(dev, ext));
+}
+
+/// \brief execute_batch function executes an expression on a batch of frames
+/// of the same size in one kernel launch per kernel of the expression, instead
+/// of one launch per frame. Every terminal read or written by the expression,
+/// except the filters and the constant variables shared by all the frames,
+/// must hold the frames one after the other, e.g. a terminal created with the
+/// number of frames. The intermediate memories are created for the batch.
+/// template parameters:
+/// \tparam ExecPolicy: determining which policy to be used for executing an
+/// expression. this can be Fuse, NoFuse or Auto
+/// \tparam LC the column size for local memory when needed
+/// \tparam LR the row size for column memory when needed
+/// \tparam LCT the size of the workgroup column.
+/// \tparam LRT the size of the workgroup row.
+/// \tparam Expr the expression type to be executed.
+/// function parameters:
+/// \param expr the expression to be executed
+/// \param dev the selected device for executing the expression
+/// \param frames the number of frames of the batch
+/// \return void
+template <policy::PolicyType ExecPolicy, size_t LC, size_t LR, size_t LCT,
+          size_t LRT, typename Expr, typename DeviceT>
+void inline execute_batch(Expr &expr, const DeviceT &dev, size_t frames) {
+  auto ext = internal::make_batch_extent(frames);
+  execute<ExecPolicy, LC, LR, LCT, LRT>(
+      expr, internal::ExtentDevice<DeviceT, decltype(ext)>(dev, ext));
+}
+
+/// \brief special case of the execute_batch function with default value for
+/// local memory and workgroup size
+/// \param expr: the expression to be executed
+/// \param dev : the selected device for executing the expression
+/// \param frames the number of frames of the batch
+/// \return void
+template <policy::PolicyType ExecPolicy, typename Expr, typename DeviceT>
+void inline execute_batch(Expr &expr, const DeviceT &dev, size_t frames) {
+  execute_batch<ExecPolicy, 8, 8, 8, 8>(expr, dev, frames);
+}
+
+/// \brief execute_async function for a batch of frames. See the
+/// execute_batch function.
+/// \param expr the expression to be executed
+/// \param dev the selected device for executing the expression
+/// \param frames the number of frames of the batch
+/// \return DeviceT::Event
+template <policy::PolicyType ExecPolicy, size_t LC, size_t LR, size_t LCT,
+          size_t LRT, typename Expr, typename DeviceT>
+typename DeviceT::Event inline execute_batch_async(Expr &expr,
+                                                   const DeviceT &dev,
+                                                   size_t frames) {
+  auto ext = internal::make_batch_extent(frames);
+  return execute_async<ExecPolicy, LC, LR, LCT, LRT>(
+      expr, internal::ExtentDevice<DeviceT, decltype(ext)>(dev, ext));
 }
 }  // visioncpp
 #include "executor_subexpr_if_needed.hpp"
 #include "policy/fuse.hpp"
 #include "policy/nofuse.hpp"
+#include "policy/auto.hpp"
+#include "common_subexpr.hpp"
+#include "pipeline.hpp"
+#include "tuner.hpp"
+#include "footprint.hpp"
 #endif  // VISIONCPP_INCLUDE_FRAMEWORK_EXECUTOR_EXECUTOR_HPP_
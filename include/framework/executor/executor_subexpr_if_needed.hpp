@@ -44,7 +44,7 @@ struct SubExprRes {
   /// subexpression execution.
   static Type get(Expr &eval_sub, const DeviceT &dev) {
     using Intermediate_Output = internal::LeafNode<typename Expr::Type, LVL>;
-    auto intermediate_output = Intermediate_Output();
+    auto intermediate_output = pooled_leaf<Intermediate_Output>(dev);
     internal::fuse<LC, LR, LCT, LRT>(
         internal::Assign<Intermediate_Output, Expr,
                          Intermediate_Output::Type::Cols,
@@ -125,7 +125,7 @@ struct ParentForcedExecute<true, Expr, DeviceT> {
   /// \return LeafNode
   template <size_t LC, size_t LR, size_t LCT, size_t LRT>
   static inline Type forced_exec(Expr &expr, const DeviceT &dev) {
-    auto lhs = Type();
+    auto lhs = pooled_leaf<Type>(dev);
     internal::fuse<LC, LR, LCT, LRT>(
         internal::Assign<
             Type, Expr, Type::Type::Cols, Type::Type::Rows,
@@ -0,0 +1,207 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file footprint.hpp
+/// \brief This file contains the footprint function reporting the kernels of
+/// an expression with the local memory of each of them and the global memory
+/// of the intermediate results.
+
+#ifndef VISIONCPP_INCLUDE_FRAMEWORK_EXECUTOR_FOOTPRINT_HPP_
+#define VISIONCPP_INCLUDE_FRAMEWORK_EXECUTOR_FOOTPRINT_HPP_
+
+#include <iomanip>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace visioncpp {
+/// \struct KernelFootprint
+/// \brief KernelFootprint holds the memory needed by one kernel of an
+/// expression.
+struct KernelFootprint {
+  /// the operations computed by the kernel (see internal::KernelLabel)
+  std::string label;
+  /// the column size of the local memory of the kernel
+  size_t lc;
+  /// the row size of the local memory of the kernel
+  size_t lr;
+  /// the column size of the workgroup of the kernel
+  size_t lct;
+  /// the row size of the workgroup of the kernel
+  size_t lrt;
+  /// the local memory of a workgroup, in bytes
+  size_t local_bytes;
+  /// the global memory written by the kernel, in bytes
+  size_t output_bytes;
+};
+
+/// \struct Footprint
+/// \brief Footprint is returned by the footprint function. It lists the
+/// kernels of an expression in submission order.
+struct Footprint {
+  std::vector<KernelFootprint> kernels;
+  /// the global memory of the intermediate results, in bytes. It counts each
+  /// memory written by a kernel other than the output of the expression once,
+  /// so the memories of the BufferPool reused by several results are counted
+  /// once.
+  size_t global_bytes = 0;
+
+  /// \brief returns the number of kernels launched by the expression
+  size_t kernel_count() const { return kernels.size(); }
+
+  /// \brief returns the largest local memory of a kernel, in bytes
+  size_t local_bytes() const {
+    size_t bytes = 0;
+    for (const auto &k : kernels) {
+      bytes = k.local_bytes > bytes ? k.local_bytes : bytes;
+    }
+    return bytes;
+  }
+
+  /// \brief prints the kernels and the memory they need
+  /// \param os: the output stream
+  /// \return void
+  void report(std::ostream &os) const {
+    os << "kernels " << kernel_count() << ", local memory " << local_bytes()
+       << " bytes, intermediate global memory " << global_bytes << " bytes\n";
+    os << "  local  (LC x LR)  (LCT x LRT)      output  kernel\n";
+    for (const auto &k : kernels) {
+      os << std::setw(7) << k.local_bytes << std::setw(5) << k.lc << " x "
+         << std::setw(3) << k.lr << std::setw(6) << k.lct << " x "
+         << std::setw(3) << k.lrt << std::setw(13) << k.output_bytes << "  "
+         << k.label << "\n";
+    }
+  }
+};
+
+namespace internal {
+/// \class FootprintDevice
+/// \brief FootprintDevice wraps a device and records the kernels submitted to
+/// it instead of running them. The intermediate memories are taken from its
+/// own BufferPool, so the pool of the wrapped device is left unchanged, and
+/// the local memory limit of the wrapped device is applied as on an
+/// execution.
+/// template parameters:
+/// \tparam DeviceT: the wrapped device type
+template <typename DeviceT>
+class FootprintDevice {
+ private:
+  const DeviceT &dev;
+  std::shared_ptr<BufferPool> buffers;
+  /// the global memories written by the recorded kernels
+  std::shared_ptr<std::vector<std::weak_ptr<void>>> outputs;
+  std::shared_ptr<Footprint> result;
+
+ public:
+  explicit FootprintDevice(const DeviceT &devArg)
+      : dev(devArg),
+        buffers(std::make_shared<BufferPool>()),
+        outputs(std::make_shared<std::vector<std::weak_ptr<void>>>()),
+        result(std::make_shared<Footprint>()) {}
+
+  /// \brief returns the pool of the intermediate memories of the dry run
+  BufferPool &buffer_pool() const { return *buffers; }
+
+  /// \brief returns the local memory of the wrapped device
+  size_t local_mem_size() const { return dev.local_mem_size(); }
+
+  /// \brief returns the number of frames of each execution
+  size_t frames() const { return dev.frames(); }
+
+  /// \brief records the kernel of the expression without running it
+  template <size_t LC, size_t LR, size_t CGT, size_t RGT, size_t CLT,
+            size_t RLT, typename Expr>
+  void execute(Expr &expr) const {
+    const auto &out = expr.lhs.vilibMemory;
+    result->kernels.push_back(KernelFootprint{
+        KernelLabel<Expr>::get(), LC, LR, CLT, RLT,
+        local_memory_bytes<LC, LR, Expr>(), out.used_memory() * out.frames});
+    outputs->push_back(out.syclData);
+  }
+
+  /// \brief returns the footprint of the kernels recorded so far. The output
+  /// of the last kernel is the output of the expression.
+  Footprint footprint() const {
+    Footprint f = *result;
+    f.global_bytes = 0;
+    const std::weak_ptr<void> last =
+        outputs->empty() ? std::weak_ptr<void>() : outputs->back();
+    for (size_t i = 0; i < outputs->size(); i++) {
+      const auto &o = (*outputs)[i];
+      bool counted = same_owner(o, last);
+      for (size_t j = 0; j < i && !counted; j++) {
+        counted = same_owner(o, (*outputs)[j]);
+      }
+      if (!counted) {
+        f.global_bytes += f.kernels[i].output_bytes;
+      }
+    }
+    return f;
+  }
+
+ private:
+  /// the memories are compared by owner, since the address of a destroyed
+  /// memory may be given to a new one
+  static bool same_owner(const std::weak_ptr<void> &a,
+                         const std::weak_ptr<void> &b) {
+    return !a.owner_before(b) && !b.owner_before(a);
+  }
+};
+}  // internal
+
+/// \brief footprint function returns the kernels launched by an expression,
+/// the local memory each of them needs and the global memory of the
+/// intermediate results, e.g. to check an expression against the limits of a
+/// device before running it. The expression is planned and broken into
+/// kernels as by the execute function, but no kernel is run. The local memory
+/// of a kernel only depends on the types, and is also given at compile time by
+/// internal::local_memory_bytes.
+/// template parameters:
+/// \tparam ExecPolicy: determining which policy to be used for executing an
+/// expression. this can be Fuse, NoFuse or Auto
+/// \tparam LC the column size for local memory when needed
+/// \tparam LR the row size for column memory when needed
+/// \tparam LCT the size of the workgroup column.
+/// \tparam LRT the size of the workgroup row.
+/// \tparam Expr the expression type to be executed.
+/// function parameters:
+/// \param expr the expression to be executed
+/// \param dev the selected device for executing the expression
+/// \return Footprint
+template <policy::PolicyType ExecPolicy, size_t LC, size_t LR, size_t LCT,
+          size_t LRT, typename Expr, typename DeviceT>
+Footprint inline footprint(Expr expr, const DeviceT &dev) {
+  internal::FootprintDevice<DeviceT> recorder(dev);
+  internal::CommonSubExpr<ExecPolicy, LC, LR, LCT, LRT, Expr>::execute(
+      expr, recorder);
+  return recorder.footprint();
+}
+
+/// \brief special case of the footprint function with default value for local
+/// memory and workgroup size
+/// \param expr: the expression to be executed
+/// \param dev : the selected device for executing the expression
+/// \return Footprint
+template <policy::PolicyType ExecPolicy, typename Expr, typename DeviceT>
+Footprint inline footprint(Expr expr, const DeviceT &dev) {
+  return footprint<ExecPolicy, 8, 8, 8, 8>(expr, dev);
+}
+}  // visioncpp
+#endif  // VISIONCPP_INCLUDE_FRAMEWORK_EXECUTOR_FOOTPRINT_HPP_
@@ -0,0 +1,255 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file pipeline.hpp
+/// \brief This file contains the Pipeline class. A pipeline keeps an expression
+/// tree and all of its memories alive between executions, so the same tree can
+/// be run on every frame of a video without recreating its buffers.
+
+#ifndef VISIONCPP_INCLUDE_FRAMEWORK_EXECUTOR_PIPELINE_HPP_
+#define VISIONCPP_INCLUDE_FRAMEWORK_EXECUTOR_PIPELINE_HPP_
+
+namespace visioncpp {
+namespace internal {
+/// \struct InputLeaf
+/// \brief InputLeaf is used to find the input terminal node of an expression.
+/// The input is the first terminal node reached by the in-order traverse of the
+/// right-hand side of the expression. Neighbour operations keep their image on
+/// the left-hand side and their filter on the right-hand side, so the filters
+/// are never picked as the input.
+/// template parameters:
+/// \tparam Category: the Category type of the node (Unary, Binary)
+/// \tparam Expr: the type of the node
+template <size_t Category, typename Expr>
+struct InputLeaf;
+
+/// \brief specialisation of InputLeaf where the node has one child
+template <typename Expr>
+struct InputLeaf<expr_category::Unary, Expr> {
+  using Next = InputLeaf<Expr::RHSExpr::ND_Category, typename Expr::RHSExpr>;
+  using Type = typename Next::Type;
+  static Type &get(Expr &expr) { return Next::get(expr.rhs); }
+};
+
+/// \brief specialisation of InputLeaf where the node has two children
+template <typename Expr>
+struct InputLeaf<expr_category::Binary, Expr> {
+  using Next = InputLeaf<Expr::LHSExpr::ND_Category, typename Expr::LHSExpr>;
+  using Type = typename Next::Type;
+  static Type &get(Expr &expr) { return Next::get(expr.lhs); }
+};
+
+/// \brief specialisation of InputLeaf where the node is a terminal node
+template <typename RHS, size_t LVL>
+struct InputLeaf<expr_category::Unary, LeafNode<RHS, LVL>> {
+  static_assert(RHS::LeafType != memory_type::Const,
+                "The input of a pipeline cannot be a constant variable");
+  using Type = LeafNode<RHS, LVL>;
+  static Type &get(Type &expr) { return expr; }
+};
+
+/// \brief specialisation of InputLeaf where the node is a scheduled
+/// subexpression. The input is searched in the subexpression.
+template <policy::PolicyType PlcType, typename Node, size_t LC, size_t LR,
+          size_t LCT, size_t LRT, size_t LVL>
+struct InputLeaf<expr_category::Unary,
+                 LeafNode<VirtualMemory<PlcType, Node, LC, LR, LCT, LRT>, LVL>> {
+  using Next = InputLeaf<Node::ND_Category, Node>;
+  using Type = typename Next::Type;
+  static Type &get(
+      LeafNode<VirtualMemory<PlcType, Node, LC, LR, LCT, LRT>, LVL> &expr) {
+    return Next::get(expr.vilibMemory.subTree);
+  }
+};
+}  // internal
+
+/// \class Pipeline
+/// \brief Pipeline owns an expression tree whose root is an assign and the
+/// device executing it. The memories of the tree, including the constant
+/// filters, are created once with the pipeline and reused by every run; the
+/// outputs of the scheduled subexpressions are taken from the buffer pool of
+/// the device, so each run reuses the buffers of the previous one. This is
+/// used when the same
+/// expression is applied to each frame of a video: the input and output
+/// terminals are usually created as device only memories and run(in, out)
+/// copies the frame in and the result out. With the Auto policy the kernel
+/// breaks are planned once, when the pipeline is created. The shared subtrees
+/// of the expression (see CommonSubExpr) are also found once.
+/// template parameters:
+/// \tparam ExecPolicy: the policy used to execute the expression
+/// \tparam LC: the column size for local memory when needed
+/// \tparam LR: the row size for local memory when needed
+/// \tparam LCT: the size of the workgroup column
+/// \tparam LRT: the size of the workgroup row
+/// \tparam Expr: the expression type
+/// \tparam DeviceT: the device type
+template <policy::PolicyType ExecPolicy, size_t LC, size_t LR, size_t LCT,
+          size_t LRT, typename Expr, typename DeviceT>
+class Pipeline {
+  static_assert(Expr::has_out,
+                "The root of a pipeline must be an assign expression");
+  using Plan = internal::PolicyPlan<ExecPolicy, LC, LR, LCT, LRT, Expr>;
+  using PlannedExpr = typename Plan::Type;
+  using Cse = internal::CommonSubExpr<ExecPolicy, LC, LR, LCT, LRT, Expr>;
+  using SharedPlan =
+      internal::PolicyPlan<ExecPolicy, LC, LR, LCT, LRT, typename Cse::Type>;
+  using SharedExpr = typename SharedPlan::Type;
+
+ public:
+  using InputType =
+      typename internal::InputLeaf<PlannedExpr::RHSExpr::ND_Category,
+                                   typename PlannedExpr::RHSExpr>::Type;
+  using OutputType = typename PlannedExpr::LHSExpr;
+
+ private:
+  PlannedExpr expr;
+  /// the expression where the common subexpressions are computed once. It is
+  /// only created when the expression has shared subtrees.
+  std::shared_ptr<SharedExpr> shared;
+  DeviceT dev;
+
+  /// \brief launches the kernels of the planned expression. It skips the
+  /// search of the shared subtrees done by visioncpp::execute, as it was done
+  /// when the pipeline was created.
+  template <typename D>
+  void launch(const D &d) {
+    if (shared) {
+      internal::execute_planned<Plan::Policy, LC, LR, LCT, LRT>(*shared, d);
+    } else {
+      internal::execute_planned<Plan::Policy, LC, LR, LCT, LRT>(expr, d);
+    }
+  }
+
+ public:
+  Pipeline(Expr e, const DeviceT &d) : expr(Plan::get(e)), dev(d) {
+    internal::CseRegistry reg;
+    auto s = Cse::get(e, reg);
+    if (reg.shared) {
+      shared = std::make_shared<SharedExpr>(SharedPlan::get(s));
+    }
+  }
+
+  /// \brief returns the input terminal node of the expression
+  /// \return InputType
+  InputType &input() {
+    return internal::InputLeaf<PlannedExpr::RHSExpr::ND_Category,
+                               typename PlannedExpr::RHSExpr>::get(expr.rhs);
+  }
+
+  /// \brief returns the output terminal node of the expression
+  /// \return OutputType
+  OutputType &output() { return expr.lhs; }
+
+  /// \brief executes the expression on the current content of its terminals
+  /// \return void
+  void run() {
+    internal::TraceScope scope("host", "pipeline_run");
+    launch(dev);
+  }
+
+  /// \brief copies a new frame to the input terminal, executes the expression
+  /// and copies the result to the out pointer
+  /// \param in: the host pointer of the new frame
+  /// \param out: the host pointer receiving the result
+  /// \return void
+  void run(typename InputType::Scalar *in, typename OutputType::Scalar *out) {
+    input().reset_input(in);
+    run();
+    output().read_output(out);
+  }
+
+  /// \brief run function for frames whose size is only known at runtime. The
+  /// Cols and Rows of the expression are its capacity; the input and output
+  /// sizes are deduced from cols x rows, the size of the root of the
+  /// expression.
+  /// \param in: the host pointer of the new frame
+  /// \param out: the host pointer receiving the result
+  /// \param cols: the runtime column size of the root of the expression
+  /// \param rows: the runtime row size of the root of the expression
+  /// \return void
+  void run(typename InputType::Scalar *in, typename OutputType::Scalar *out,
+           size_t cols, size_t rows) {
+    auto ext = internal::make_extent<Expr>(cols, rows);
+    input().reset_input(in, ext.template cols<InputType::Type::Cols>(),
+                        ext.template rows<InputType::Type::Rows>());
+    {
+      internal::TraceScope scope("host", "pipeline_run");
+      launch(internal::ExtentDevice<DeviceT, decltype(ext)>(dev, ext));
+    }
+    output().read_output(out, ext.template cols<OutputType::Type::Cols>(),
+                         ext.template rows<OutputType::Type::Rows>());
+  }
+
+  /// \brief copies a new frame to the input terminal and executes the
+  /// expression without blocking the host. The result can be read with
+  /// read_output once the returned handle is complete.
+  /// \param in: the host pointer of the new frame
+  /// \return DeviceT::Event
+  typename DeviceT::Event run_async(typename InputType::Scalar *in) {
+    input().reset_input(in);
+    if (shared) {
+      SharedExpr e = *shared;
+      return dev.launch_async([e](const DeviceT &d) mutable {
+        internal::execute_planned<Plan::Policy, LC, LR, LCT, LRT>(e, d);
+      });
+    }
+    PlannedExpr e = expr;
+    return dev.launch_async([e](const DeviceT &d) mutable {
+      internal::execute_planned<Plan::Policy, LC, LR, LCT, LRT>(e, d);
+    });
+  }
+
+  /// \brief copies the result of the last run to the out pointer
+  /// \param out: the host pointer receiving the result
+  /// \return void
+  void read_output(typename OutputType::Scalar *out) {
+    output().read_output(out);
+  }
+};
+
+/// \brief template deduction function for Pipeline
+/// template parameters:
+/// \tparam ExecPolicy: the policy used to execute the expression
+/// \tparam LC: the column size for local memory when needed
+/// \tparam LR: the row size for local memory when needed
+/// \tparam LCT: the size of the workgroup column
+/// \tparam LRT: the size of the workgroup row
+/// function parameters:
+/// \param expr: the expression executed by the pipeline
+/// \param dev: the selected device for executing the expression
+/// \return Pipeline
+template <policy::PolicyType ExecPolicy, size_t LC, size_t LR, size_t LCT,
+          size_t LRT, typename Expr, typename DeviceT>
+Pipeline<ExecPolicy, LC, LR, LCT, LRT, Expr, DeviceT> make_pipeline(
+    Expr expr, const DeviceT &dev) {
+  return Pipeline<ExecPolicy, LC, LR, LCT, LRT, Expr, DeviceT>(expr, dev);
+}
+
+/// \brief special case of the make_pipeline function with default value for
+/// local memory and workgroup size
+/// \param expr: the expression executed by the pipeline
+/// \param dev: the selected device for executing the expression
+/// \return Pipeline
+template <policy::PolicyType ExecPolicy, typename Expr, typename DeviceT>
+Pipeline<ExecPolicy, 8, 8, 8, 8, Expr, DeviceT> make_pipeline(
+    Expr expr, const DeviceT &dev) {
+  return Pipeline<ExecPolicy, 8, 8, 8, 8, Expr, DeviceT>(expr, dev);
+}
+}  // visioncpp
+#endif  // VISIONCPP_INCLUDE_FRAMEWORK_EXECUTOR_PIPELINE_HPP_
@@ -0,0 +1,462 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file auto.hpp
+/// \brief This file contains the auto scheduler used by the Auto policy. The
+/// auto scheduler decides at compile time where the expression tree is broken
+/// into separate kernels, which otherwise has to be done by hand with the
+/// schedule function.
+
+#ifndef VISIONCPP_INCLUDE_FRAMEWORK_EXECUTOR_POLICY_AUTO_HPP_
+#define VISIONCPP_INCLUDE_FRAMEWORK_EXECUTOR_POLICY_AUTO_HPP_
+
+#include <ostream>
+#include <string>
+
+namespace visioncpp {
+namespace internal {
+/// \struct AutoCostModel
+/// \brief AutoCostModel contains the default weights used by the auto
+/// scheduler. All the costs are counted for one LC x LR tile of the output of a
+/// kernel. A custom model with the same members can be passed to auto_schedule
+/// and print_schedule.
+struct AutoCostModel {
+  /// the cost of computing one element of a node
+  static constexpr size_t OpCost = 1;
+  /// the cost of reading or writing one byte of global memory
+  static constexpr size_t ByteCost = 4;
+  /// the cost of launching one more kernel. It is shared by all the tiles of
+  /// the kernel.
+  static constexpr size_t LaunchCost = 1 << 16;
+  /// the local memory available to one workgroup, in bytes
+  static constexpr size_t LocalMemBytes = 32 * 1024;
+};
+
+/// \brief the decisions the auto scheduler can make for the child of a node
+namespace auto_break {
+/// the child is computed in the kernel of its parent
+static constexpr size_t Fused = 0;
+/// the child is scheduled in a separate kernel by the auto scheduler
+static constexpr size_t Cut = 1;
+/// the child already runs in a separate kernel because its size is different
+/// from the size of its parent
+static constexpr size_t Forced = 2;
+}
+
+/// \struct AutoOnChip
+/// \brief AutoOnChip is used to find the terminal nodes which are not loaded
+/// from global memory to local memory: constant variables and memories created
+/// on constant memory.
+template <typename RHS>
+struct AutoOnChip {
+  static constexpr bool Value = RHS::LeafType == memory_type::Const;
+};
+
+/// \brief specialisation of AutoOnChip for VisionMemory
+template <bool MapAllocator, size_t ScalarType, size_t MemoryType,
+          typename Sclr, size_t Col, size_t Row, typename ElementTp,
+          size_t Elements, size_t Sc, size_t LVL>
+struct AutoOnChip<VisionMemory<MapAllocator, ScalarType, MemoryType, Sclr, Col,
+                               Row, ElementTp, Elements, Sc, LVL>> {
+  static constexpr bool Value =
+      MemoryType == memory_type::Const || Sc == scope::Constant;
+};
+
+/// \struct AutoPlan
+/// \brief AutoPlan walks the expression tree and computes, for each node, the
+/// cost of the kernel part rooted at the node and the expression rewritten
+/// with the kernel breaks chosen by the auto scheduler. In a fused kernel, a
+/// neighbour operation needs its input on a tile enlarged by its halo, so the
+/// halos of nested neighbour operations add up and the nodes below them are
+/// recomputed on larger and larger tiles. For the input of each neighbour
+/// operation the auto scheduler compares this recompute cost, and the local
+/// memory it needs, with the cost of storing the input in global memory in a
+/// separate kernel. This is the generic case, used for the nodes that are not
+/// planned (e.g. pyramids), which are kept as they are.
+/// template parameters:
+/// \tparam LC: is the column size of local memory
+/// \tparam LR: is the row size of local memory
+/// \tparam LCT: is the column size of workgroup
+/// \tparam LRT: is the row size of workgroup
+/// \tparam HC: the column halo added to the tile by the ancestors of the node
+/// in the same kernel
+/// \tparam HR: the row halo added to the tile by the ancestors of the node in
+/// the same kernel
+/// \tparam CM: the cost model
+/// \tparam Expr: the type of the node
+template <size_t LC, size_t LR, size_t LCT, size_t LRT, size_t HC, size_t HR,
+          typename CM, typename Expr>
+struct AutoPlan {
+  using Type = Expr;
+  static constexpr bool IsOp = false;
+  static constexpr size_t Cost = 0;
+  static constexpr size_t LocalMem = 0;
+  static constexpr size_t Cuts = 0;
+  static inline Type get(Expr &expr) { return expr; }
+  static void print(std::ostream &os, size_t indent) {
+    os << std::string(indent, ' ') << "node (not planned)\n";
+  }
+};
+
+/// \struct AutoChild
+/// \brief AutoChild makes the decision for one child of a node and plans the
+/// child accordingly.
+/// template parameters:
+/// \tparam LC: is the column size of local memory
+/// \tparam LR: is the row size of local memory
+/// \tparam LCT: is the column size of workgroup
+/// \tparam LRT: is the row size of workgroup
+/// \tparam HC: the column halo of the tile needed by the parent
+/// \tparam HR: the row halo of the tile needed by the parent
+/// \tparam CM: the cost model
+/// \tparam Child: the type of the child
+/// \tparam Forced: whether or not the child has a different size from its
+/// parent
+/// \tparam CanCut: whether or not the auto scheduler may break the tree here
+template <size_t LC, size_t LR, size_t LCT, size_t LRT, size_t HC, size_t HR,
+          typename CM, typename Child, bool Forced, bool CanCut>
+struct AutoChild {
+  using Fused = AutoPlan<LC, LR, LCT, LRT, HC, HR, CM, Child>;
+  using Root = AutoPlan<LC, LR, LCT, LRT, 0, 0, CM, Child>;
+  static constexpr size_t Area = (LC + HC) * (LR + HR);
+  static constexpr size_t Elem = sizeof(typename Child::OutType);
+  static constexpr size_t Tiles = ((Child::Type::Cols + LC - 1) / LC) *
+                                  ((Child::Type::Rows + LR - 1) / LR);
+  /// a separate kernel computes the child once per tile, writes it to global
+  /// memory and the parent reads it back with its halo
+  static constexpr size_t BreakCost = Root::Cost + CM::LaunchCost / Tiles +
+                                      (LC * LR + Area) * Elem * CM::ByteCost;
+  static constexpr size_t BreakLocal = Area * Elem;
+  static constexpr size_t Decision =
+      Forced ? auto_break::Forced
+             : (CanCut && Fused::IsOp &&
+                (Fused::Cost > BreakCost ||
+                 Fused::LocalMem > CM::LocalMemBytes))
+                   ? auto_break::Cut
+                   : auto_break::Fused;
+  static constexpr bool IsFused = Decision == auto_break::Fused;
+  static constexpr size_t Cost = IsFused ? Fused::Cost : BreakCost;
+  static constexpr size_t LocalMem = IsFused ? Fused::LocalMem : BreakLocal;
+  static constexpr size_t Cuts =
+      IsFused ? Fused::Cuts
+              : Root::Cuts + (Decision == auto_break::Cut ? 1 : 0);
+
+  template <size_t D, typename Dummy = void>
+  struct Select {
+    using Type = typename Fused::Type;
+    static inline Type get(Child &child) { return Fused::get(child); }
+  };
+  template <typename Dummy>
+  struct Select<auto_break::Cut, Dummy> {
+    using Memory =
+        VirtualMemory<policy::Fuse, typename Root::Type, LC, LR, LCT, LRT>;
+    using Type = LeafNode<Memory, Root::Type::Level>;
+    static inline Type get(Child &child) {
+      return Type(Memory(Root::get(child)));
+    }
+  };
+  template <typename Dummy>
+  struct Select<auto_break::Forced, Dummy> {
+    using Type = typename Root::Type;
+    static inline Type get(Child &child) { return Root::get(child); }
+  };
+
+  using Type = typename Select<Decision>::Type;
+  static inline Type get(Child &child) {
+    return Select<Decision>::get(child);
+  }
+
+  static void print(std::ostream &os, size_t indent) {
+    if (CanCut && Fused::IsOp && !Forced) {
+      os << std::string(indent, ' ')
+         << (IsFused ? "[fused: cost " : "[break: cost ") << Fused::Cost
+         << " fused / " << BreakCost << " break, local memory "
+         << Fused::LocalMem << " bytes]\n";
+    } else if (Forced && Root::IsOp) {
+      os << std::string(indent, ' ') << "[break: size change]\n";
+    }
+    if (IsFused) {
+      Fused::print(os, indent);
+    } else {
+      Root::print(os, indent);
+    }
+  }
+};
+
+/// \brief prints the name and size of a node
+template <typename Expr>
+static void auto_print_node(std::ostream &os, size_t indent, const char *name) {
+  os << std::string(indent, ' ') << name << " " << Expr::Type::Cols << "x"
+     << Expr::Type::Rows << "\n";
+}
+
+/// \brief specialisation of AutoPlan for the terminal nodes. The terminal
+/// nodes are loaded with the halo of the tile.
+template <size_t LC, size_t LR, size_t LCT, size_t LRT, size_t HC, size_t HR,
+          typename CM, typename RHS, size_t LVL>
+struct AutoPlan<LC, LR, LCT, LRT, HC, HR, CM, LeafNode<RHS, LVL>> {
+  using Expr = LeafNode<RHS, LVL>;
+  using Type = Expr;
+  static constexpr bool IsOp = false;
+  static constexpr size_t Bytes =
+      AutoOnChip<RHS>::Value
+          ? 0
+          : (LC + HC) * (LR + HR) * sizeof(typename Expr::OutType);
+  static constexpr size_t Cost = Bytes * CM::ByteCost;
+  static constexpr size_t LocalMem = Bytes;
+  static constexpr size_t Cuts = 0;
+  static inline Type get(Expr &expr) { return expr; }
+  static void print(std::ostream &os, size_t indent) {
+    auto_print_node<Expr>(os, indent, "leaf");
+  }
+};
+
+/// \brief specialisation of AutoPlan for the unary point operation
+template <size_t LC, size_t LR, size_t LCT, size_t LRT, size_t HC, size_t HR,
+          typename CM, typename OP, typename RHS, size_t Cols, size_t Rows,
+          size_t LfType, size_t LVL>
+struct AutoPlan<LC, LR, LCT, LRT, HC, HR, CM,
+                RUnOP<OP, RHS, Cols, Rows, LfType, LVL>> {
+  using Expr = RUnOP<OP, RHS, Cols, Rows, LfType, LVL>;
+  static constexpr size_t Area = (LC + HC) * (LR + HR);
+  using Child =
+      AutoChild<LC, LR, LCT, LRT, HC, HR, CM, RHS, Expr::Unary_Conds, false>;
+  using Type = typename Expr::template ExprExchange<typename Child::Type>;
+  static constexpr bool IsOp = true;
+  static constexpr size_t Cost = Area * CM::OpCost + Child::Cost;
+  static constexpr size_t LocalMem =
+      Area * sizeof(typename Expr::OutType) + Child::LocalMem;
+  static constexpr size_t Cuts = Child::Cuts;
+  static inline Type get(Expr &expr) { return Type(Child::get(expr.rhs)); }
+  static void print(std::ostream &os, size_t indent) {
+    auto_print_node<Expr>(os, indent, "point");
+    Child::print(os, indent + 2);
+  }
+};
+
+/// \brief specialisation of AutoPlan for the binary point operation
+template <size_t LC, size_t LR, size_t LCT, size_t LRT, size_t HC, size_t HR,
+          typename CM, typename OP, typename LHS, typename RHS, size_t Cols,
+          size_t Rows, size_t LfType, size_t LVL>
+struct AutoPlan<LC, LR, LCT, LRT, HC, HR, CM,
+                RBiOP<OP, LHS, RHS, Cols, Rows, LfType, LVL>> {
+  using Expr = RBiOP<OP, LHS, RHS, Cols, Rows, LfType, LVL>;
+  static constexpr size_t Area = (LC + HC) * (LR + HR);
+  using LHSChild =
+      AutoChild<LC, LR, LCT, LRT, HC, HR, CM, LHS,
+                (LHS::LeafType != memory_type::Const &&
+                 ((Rows != LHS::RThread) || (Cols != LHS::CThread))),
+                false>;
+  using RHSChild =
+      AutoChild<LC, LR, LCT, LRT, HC, HR, CM, RHS,
+                (RHS::LeafType != memory_type::Const &&
+                 ((Rows != RHS::RThread) || (Cols != RHS::CThread))),
+                false>;
+  using Type = typename Expr::template ExprExchange<typename LHSChild::Type,
+                                                    typename RHSChild::Type>;
+  static constexpr bool IsOp = true;
+  static constexpr size_t Cost =
+      Area * CM::OpCost + LHSChild::Cost + RHSChild::Cost;
+  static constexpr size_t LocalMem = Area * sizeof(typename Expr::OutType) +
+                                     LHSChild::LocalMem + RHSChild::LocalMem;
+  static constexpr size_t Cuts = LHSChild::Cuts + RHSChild::Cuts;
+  static inline Type get(Expr &expr) {
+    return Type(LHSChild::get(expr.lhs), RHSChild::get(expr.rhs));
+  }
+  static void print(std::ostream &os, size_t indent) {
+    auto_print_node<Expr>(os, indent, "point");
+    LHSChild::print(os, indent + 2);
+    RHSChild::print(os, indent + 2);
+  }
+};
+
+/// \brief specialisation of AutoPlan for the neighbour operation without
+/// filter. The input is needed on the tile enlarged by the halo.
+template <size_t LC, size_t LR, size_t LCT, size_t LRT, size_t HC, size_t HR,
+          typename CM, typename OP, size_t Halo_T, size_t Halo_L,
+          size_t Halo_B, size_t Halo_R, typename RHS, size_t Cols, size_t Rows,
+          size_t LfType, size_t LVL>
+struct AutoPlan<LC, LR, LCT, LRT, HC, HR, CM,
+                StnNoFilt<OP, Halo_T, Halo_L, Halo_B, Halo_R, RHS, Cols, Rows,
+                          LfType, LVL>> {
+  using Expr = StnNoFilt<OP, Halo_T, Halo_L, Halo_B, Halo_R, RHS, Cols, Rows,
+                         LfType, LVL>;
+  static constexpr size_t Area = (LC + HC) * (LR + HR);
+  static constexpr size_t Window =
+      (Halo_L + Halo_R + 1) * (Halo_T + Halo_B + 1);
+  using Child = AutoChild<LC, LR, LCT, LRT, HC + Halo_L + Halo_R,
+                          HR + Halo_T + Halo_B, CM, RHS, Expr::Stencil_Conds,
+                          true>;
+  using Type = typename Expr::template ExprExchange<typename Child::Type>;
+  static constexpr bool IsOp = true;
+  static constexpr size_t Cost = Area * Window * CM::OpCost + Child::Cost;
+  static constexpr size_t LocalMem =
+      Area * sizeof(typename Expr::OutType) + Child::LocalMem;
+  static constexpr size_t Cuts = Child::Cuts;
+  static inline Type get(Expr &expr) { return Type(Child::get(expr.rhs)); }
+  static void print(std::ostream &os, size_t indent) {
+    auto_print_node<Expr>(os, indent, "neighbour");
+    Child::print(os, indent + 2);
+  }
+};
+
+/// \brief specialisation of AutoPlan for the neighbour operation with filter.
+/// The image is needed on the tile enlarged by the halo and the filter is
+/// planned as the root of its own kernel part.
+template <size_t LC, size_t LR, size_t LCT, size_t LRT, size_t HC, size_t HR,
+          typename CM, typename OP, size_t Halo_T, size_t Halo_L,
+          size_t Halo_B, size_t Halo_R, typename LHS, typename RHS,
+          size_t Cols, size_t Rows, size_t LfType, size_t LVL>
+struct AutoPlan<LC, LR, LCT, LRT, HC, HR, CM,
+                StnFilt<OP, Halo_T, Halo_L, Halo_B, Halo_R, LHS, RHS, Cols,
+                        Rows, LfType, LVL>> {
+  using Expr = StnFilt<OP, Halo_T, Halo_L, Halo_B, Halo_R, LHS, RHS, Cols, Rows,
+                       LfType, LVL>;
+  static constexpr size_t Area = (LC + HC) * (LR + HR);
+  static constexpr size_t Window =
+      (Halo_L + Halo_R + 1) * (Halo_T + Halo_B + 1);
+  using LHSChild = AutoChild<LC, LR, LCT, LRT, HC + Halo_L + Halo_R,
+                             HR + Halo_T + Halo_B, CM, LHS,
+                             Expr::Stencil_Conds, true>;
+  using RHSChild = AutoChild<LC, LR, LCT, LRT, 0, 0, CM, RHS, false, false>;
+  using Type = typename Expr::template ExprExchange<typename LHSChild::Type,
+                                                    typename RHSChild::Type>;
+  static constexpr bool IsOp = true;
+  static constexpr size_t Cost =
+      Area * Window * CM::OpCost + LHSChild::Cost + RHSChild::Cost;
+  static constexpr size_t LocalMem = Area * sizeof(typename Expr::OutType) +
+                                     LHSChild::LocalMem + RHSChild::LocalMem;
+  static constexpr size_t Cuts = LHSChild::Cuts + RHSChild::Cuts;
+  static inline Type get(Expr &expr) {
+    return Type(LHSChild::get(expr.lhs), RHSChild::get(expr.rhs));
+  }
+  static void print(std::ostream &os, size_t indent) {
+    auto_print_node<Expr>(os, indent, "neighbour");
+    LHSChild::print(os, indent + 2);
+    RHSChild::print(os, indent + 2);
+  }
+};
+
+/// \brief specialisation of AutoPlan for the reduction. A global reduction
+/// always runs its input in a separate kernel.
+template <size_t LC, size_t LR, size_t LCT, size_t LRT, size_t HC, size_t HR,
+          typename CM, typename OP, typename RHS, size_t Cols, size_t Rows,
+          size_t LfType, size_t LVL>
+struct AutoPlan<LC, LR, LCT, LRT, HC, HR, CM,
+                RDCN<OP, RHS, Cols, Rows, LfType, LVL>> {
+  using Expr = RDCN<OP, RHS, Cols, Rows, LfType, LVL>;
+  static constexpr size_t Area = (LC + HC) * (LR + HR);
+  using Child = AutoChild<
+      LC, LR, LCT, LRT, HC, HR, CM, RHS,
+      OP::Operation_type == ops_category::GlobalNeighbourOP, false>;
+  using Type = typename Expr::template ExprExchange<typename Child::Type>;
+  static constexpr bool IsOp = true;
+  static constexpr size_t Cost =
+      Area * Expr::LC_Ratio * Expr::LR_Ratio * CM::OpCost + Child::Cost;
+  static constexpr size_t LocalMem =
+      Area * sizeof(typename Expr::OutType) + Child::LocalMem;
+  static constexpr size_t Cuts = Child::Cuts;
+  static inline Type get(Expr &expr) { return Type(Child::get(expr.rhs)); }
+  static void print(std::ostream &os, size_t indent) {
+    auto_print_node<Expr>(os, indent, "reduction");
+    Child::print(os, indent + 2);
+  }
+};
+
+/// \brief specialisation of AutoPlan for the assign. The right-hand side is
+/// the root of the kernel.
+template <size_t LC, size_t LR, size_t LCT, size_t LRT, size_t HC, size_t HR,
+          typename CM, typename LHS, typename RHS, size_t Cols, size_t Rows,
+          size_t LfType, size_t LVL>
+struct AutoPlan<LC, LR, LCT, LRT, HC, HR, CM,
+                Assign<LHS, RHS, Cols, Rows, LfType, LVL>> {
+  using Expr = Assign<LHS, RHS, Cols, Rows, LfType, LVL>;
+  using Child = AutoChild<LC, LR, LCT, LRT, 0, 0, CM, RHS, false, false>;
+  using Type =
+      typename Expr::template ExprExchange<LHS, typename Child::Type>;
+  static constexpr bool IsOp = true;
+  static constexpr size_t Cost =
+      LC * LR * sizeof(typename Expr::OutType) * CM::ByteCost + Child::Cost;
+  static constexpr size_t LocalMem = Child::LocalMem;
+  static constexpr size_t Cuts = Child::Cuts;
+  static inline Type get(Expr &expr) {
+    return Type(expr.lhs, Child::get(expr.rhs));
+  }
+  static void print(std::ostream &os, size_t indent) {
+    auto_print_node<Expr>(os, indent, "assign");
+    Child::print(os, indent + 2);
+  }
+};
+
+/// \brief specialisation of PolicyPlan for the Auto policy. The expression is
+/// rewritten by the auto scheduler and executed with the Fuse policy. The
+/// kernel breaks are chosen at compile time, once per type of expression, so
+/// executing it again only copies the nodes into the planned tree. The
+/// outputs of the breaks are taken from the buffer pool of the device (see
+/// VirtualMemory), so a repeated execute allocates no device memory.
+template <size_t LC, size_t LR, size_t LCT, size_t LRT, typename Expr>
+struct PolicyPlan<policy::Auto, LC, LR, LCT, LRT, Expr> {
+  static constexpr policy::PolicyType Policy = policy::Fuse;
+  using Planner = AutoPlan<LC, LR, LCT, LRT, 0, 0, AutoCostModel, Expr>;
+  using Type = typename Planner::Type;
+  static inline Type get(Expr &expr) { return Planner::get(expr); }
+};
+}  // internal
+
+/// \brief auto_schedule returns the expression with the kernel breaks chosen
+/// by the auto scheduler. The result can be executed with any policy; this is
+/// what the Auto policy executes with the Fuse policy.
+/// template parameters:
+/// \tparam LC: the column size for local memory
+/// \tparam LR: the row size for local memory
+/// \tparam LCT: the size of the workgroup column
+/// \tparam LRT: the size of the workgroup row
+/// \tparam CostModel: the weights of the cost model
+/// function parameters:
+/// \param expr: the expression to be planned
+/// \return the planned expression
+template <size_t LC, size_t LR, size_t LCT, size_t LRT,
+          typename CostModel = internal::AutoCostModel, typename Expr>
+typename internal::AutoPlan<LC, LR, LCT, LRT, 0, 0, CostModel, Expr>::Type
+auto_schedule(Expr expr) {
+  return internal::AutoPlan<LC, LR, LCT, LRT, 0, 0, CostModel, Expr>::get(
+      expr);
+}
+
+/// \brief print_schedule prints the expression tree with the decisions of the
+/// auto scheduler: each neighbour operation input is marked as fused or
+/// broken, with the estimated cost of both choices.
+/// template parameters:
+/// \tparam LC: the column size for local memory
+/// \tparam LR: the row size for local memory
+/// \tparam LCT: the size of the workgroup column
+/// \tparam LRT: the size of the workgroup row
+/// \tparam CostModel: the weights of the cost model
+/// function parameters:
+/// \param os: the output stream
+/// \return the number of kernel breaks added by the auto scheduler
+template <size_t LC, size_t LR, size_t LCT, size_t LRT,
+          typename CostModel = internal::AutoCostModel, typename Expr>
+size_t print_schedule(const Expr &, std::ostream &os) {
+  using Planner = internal::AutoPlan<LC, LR, LCT, LRT, 0, 0, CostModel, Expr>;
+  Planner::print(os, 0);
+  return Planner::Cuts;
+}
+}  // visioncpp
+#endif  // VISIONCPP_INCLUDE_FRAMEWORK_EXECUTOR_POLICY_AUTO_HPP_
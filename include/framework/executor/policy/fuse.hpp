@@ -24,13 +24,19 @@
 #ifndef VISIONCPP_INCLUDE_FRAMEWORK_EXECUTOR_POLICY_FUSE_HPP_
 #define VISIONCPP_INCLUDE_FRAMEWORK_EXECUTOR_POLICY_FUSE_HPP_
 
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
 namespace visioncpp {
 namespace internal {
 /// \brief the FuseExpr when the expression type is not a terminal node
 /// (leafNode).
 template <size_t LCIn, size_t LRIn, size_t LCT, size_t LRT, typename Expr, typename DeviceT>
 struct FuseExpr {
-  /// \brief the fuse function for executing the given expr.
+  /// \brief the fuse function for executing the given expr. When the local
+  /// memory of the kernel does not fit the one of the device, the kernel is
+  /// launched with a smaller local memory size, or an exception is thrown.
   /// \param expr : the expression passed to be executed on the device
   /// \param dev : the selected device for executing the expression
   /// return void
@@ -59,9 +65,41 @@ struct FuseExpr {
         (tools::IfConst<(Expr::CThread % LC == 0), (Expr::CThread / LC),
                         ((Expr::CThread / LC) + 1)>::Value) *
         cLThread;
+    if (local_memory_bytes<LC, LR, Expr>() > dev.local_mem_size()) {
+      /// a kernel within the guaranteed local memory fits every device but
+      /// the custom ones, so it is not compiled with smaller sizes
+      using Smaller = std::integral_constant<
+          bool, (local_memory_bytes<LC, LR, Expr>() > GuaranteedLocalMem &&
+                 (LCIn > 1 || LRIn > 1))>;
+      refit<LCIn, LRIn>(expr, dev, Smaller());
+      return;
+    }
     dev.template execute<LC, LR, cGThreads, rGThreads, cLThread, rLThread>(
         expr);
   }
+
+ private:
+  /// \brief launches the kernel with the next smaller local memory size (see
+  /// LocalMemoryHalf) when LC x LR does not fit the device. The workgroup size
+  /// is reduced with it. The smaller size is checked again against the local
+  /// memory of the device, so the kernel runs with the largest size fitting
+  /// the device at runtime.
+  template <size_t LC, size_t LR>
+  static void refit(Expr &expr, const DeviceT &dev, std::true_type) {
+    using Half = LocalMemoryHalf<LC, LR>;
+    FuseExpr<Half::Cols, Half::Rows, (LCT < Half::Cols ? LCT : Half::Cols),
+             (LRT < Half::Rows ? LRT : Half::Rows), Expr,
+             DeviceT>::fuse(expr, dev);
+  }
+  /// \brief throws when the kernel does not fit the device with a smaller
+  /// local memory either
+  template <size_t LC, size_t LR>
+  static void refit(Expr &, const DeviceT &dev, std::false_type) {
+    throw std::runtime_error(
+        "The kernel of " + KernelLabel<Expr>::get() +
+        " needs more local memory than the " +
+        std::to_string(dev.local_mem_size()) + " bytes of the device");
+  }
 };
 /// \brief specialisation of Fuse struct when the Expr is a terminal node
 /// (leafNode)
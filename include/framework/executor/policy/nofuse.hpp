@@ -50,7 +50,8 @@ struct NoFuseExpr<LC, LR, LCT, LRT, internal::expr_category::Unary, Expr, Device
   /// operand. It recursively calls the no_fuse function for its RHS; collects
   /// the result; launch a device kernel for the current expr with the new
   /// collected result; and returns a leafNode representing the output result of
-  /// the expression.
+  /// the expression. The output memory is taken from the BufferPool of the
+  /// device and is reused once the parent kernel has been launched.
   /// \param expr : the expression passed to be executed on the device
   /// \param dev : the selected device for executing the expression
   /// \return the leafNode representing the result of the expression
@@ -59,7 +60,7 @@ struct NoFuseExpr<LC, LR, LCT, LRT, internal::expr_category::Unary, Expr, Device
     auto iOutput = NoFuseExpr<LC, LR, LCT, LRT, decltype(expr.rhs)::ND_Category,
                           decltype(expr.rhs), DeviceT>::no_fuse(expr.rhs, dev);
     using IOutput = decltype(iOutput);
-    auto lhs = ALHS();
+    auto lhs = pooled_leaf<ALHS>(dev);
     using ARHS = typename Expr::template ExprExchange<IOutput>;
     fuse<LC, LR, LCT, LRT>(
         Assign<ALHS, ARHS, ALHS::Type::Cols, ALHS::Type::Rows,
@@ -79,7 +80,8 @@ struct NoFuseExpr<LC, LR, LCT, LRT, internal::expr_category::Binary, Expr, Devic
   /// operands. It recursively calls the no_fuse function for its LHS and RHS;
   /// collects the results; launch a device kernel for the current expr with the
   /// expression with new collected results; and returns a leafNode
-  /// representing the output result of the expression.
+  /// representing the output result of the expression. The output memory is
+  /// taken from the BufferPool of the device.
   /// \param expr : the expression passed to be executed on the device
   /// \param dev : the selected device for executing the expression
   /// \return the leafNode representing the result of the expression
@@ -95,7 +97,7 @@ struct NoFuseExpr<LC, LR, LCT, LRT, internal::expr_category::Binary, Expr, Devic
 
     using ARHS = typename Expr::template ExprExchange<decltype(i_lhs_output),
                                                       decltype(i_rhs_output)>;
-    auto lhs = ALHS();
+    auto lhs = pooled_leaf<ALHS>(dev);
     fuse<LC, LR, LCT, LRT>(
         Assign<ALHS, ARHS, ALHS::Type::Cols, ALHS::Type::Rows,
                ALHS::Type::LeafType,
@@ -0,0 +1,436 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file tuner.hpp
+/// \brief This file contains the Tuner class used to choose the local memory
+/// and workgroup sizes of an expression by timing it on the device.
+
+#ifndef VISIONCPP_INCLUDE_FRAMEWORK_EXECUTOR_TUNER_HPP_
+#define VISIONCPP_INCLUDE_FRAMEWORK_EXECUTOR_TUNER_HPP_
+
+#include <exception>
+#include <fstream>
+#include <istream>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace visioncpp {
+/// \struct TuneConfig
+/// \brief TuneConfig is one candidate configuration of the Tuner.
+/// template parameters:
+/// \tparam LCV: the column size for local memory
+/// \tparam LRV: the row size for local memory
+/// \tparam LCTV: the size of the workgroup column
+/// \tparam LRTV: the size of the workgroup row
+template <size_t LCV, size_t LRV, size_t LCTV, size_t LRTV>
+struct TuneConfig {
+  static constexpr size_t LC = LCV;
+  static constexpr size_t LR = LRV;
+  static constexpr size_t LCT = LCTV;
+  static constexpr size_t LRT = LRTV;
+};
+
+/// \struct TuneConfigs
+/// \brief TuneConfigs is the list of the candidate configurations of the
+/// Tuner. The expression is compiled for each of them.
+template <typename... Configs>
+struct TuneConfigs {};
+
+/// \brief the default candidate configurations of the Tuner
+using DefaultTuneConfigs =
+    TuneConfigs<TuneConfig<8, 8, 8, 8>, TuneConfig<16, 16, 8, 8>,
+                TuneConfig<16, 16, 16, 16>, TuneConfig<32, 32, 16, 16>,
+                TuneConfig<32, 8, 32, 8>, TuneConfig<64, 8, 32, 8>>;
+
+namespace internal {
+/// \brief the definition is in \ref type_name
+template <typename T>
+std::string type_name();
+
+/// \struct TuneExtent
+/// \brief TuneExtent is the size of the images the Tuner executes an
+/// expression on. By default it is the compile-time size of the root of the
+/// expression; otherwise the runtime-sized execute function is used.
+struct TuneExtent {
+  bool runtime;
+  size_t cols;
+  size_t rows;
+};
+
+/// \brief executes the expression on the size of the images given by ext
+template <policy::PolicyType ExecPolicy, size_t LC, size_t LR, size_t LCT,
+          size_t LRT, typename Expr, typename DeviceT>
+inline void tune_execute(Expr &expr, const DeviceT &dev,
+                         const TuneExtent &ext) {
+  if (ext.runtime) {
+    visioncpp::execute<ExecPolicy, LC, LR, LCT, LRT>(expr, dev, ext.cols,
+                                                     ext.rows);
+  } else {
+    visioncpp::execute<ExecPolicy, LC, LR, LCT, LRT>(expr, dev);
+  }
+}
+
+/// \brief executes the expression on the size of the images given by ext
+/// without blocking the host
+template <policy::PolicyType ExecPolicy, size_t LC, size_t LR, size_t LCT,
+          size_t LRT, typename Expr, typename DeviceT>
+inline typename DeviceT::Event tune_execute_async(Expr &expr,
+                                                  const DeviceT &dev,
+                                                  const TuneExtent &ext) {
+  return ext.runtime ? visioncpp::execute_async<ExecPolicy, LC, LR, LCT, LRT>(
+                           expr, dev, ext.cols, ext.rows)
+                     : visioncpp::execute_async<ExecPolicy, LC, LR, LCT, LRT>(
+                           expr, dev);
+}
+
+/// \struct TuneDispatch
+/// \brief TuneDispatch runs the expression with the candidate configuration
+/// selected at runtime by its index in the list.
+/// template parameters:
+/// \tparam ExecPolicy: the policy used to execute the expression
+/// \tparam Configs: the list of candidate configurations
+template <policy::PolicyType ExecPolicy, typename Configs>
+struct TuneDispatch;
+
+/// \brief specialisation of TuneDispatch for the end of the list
+template <policy::PolicyType ExecPolicy>
+struct TuneDispatch<ExecPolicy, TuneConfigs<>> {
+  static constexpr size_t Size = 0;
+  template <typename Expr, typename DeviceT>
+  static inline void execute(size_t, Expr &, const DeviceT &,
+                             const TuneExtent &) {}
+  template <typename Expr, typename DeviceT>
+  static inline double time(size_t, Expr &, const DeviceT &,
+                            const TuneExtent &, size_t,
+                            std::vector<double> * = nullptr) {
+    return 0;
+  }
+  static inline std::string config(size_t) { return std::string(); }
+};
+
+/// \brief specialisation of TuneDispatch for the first configuration of the
+/// list
+template <policy::PolicyType ExecPolicy, typename Config, typename... Configs>
+struct TuneDispatch<ExecPolicy, TuneConfigs<Config, Configs...>> {
+  using Next = TuneDispatch<ExecPolicy, TuneConfigs<Configs...>>;
+  static constexpr size_t Size = 1 + Next::Size;
+
+  /// \brief executes the expression with the configuration index
+  template <typename Expr, typename DeviceT>
+  static inline void execute(size_t index, Expr &expr, const DeviceT &dev,
+                             const TuneExtent &ext) {
+    if (index == 0) {
+      tune_execute<ExecPolicy, Config::LC, Config::LR, Config::LCT,
+                   Config::LRT>(expr, dev, ext);
+    } else {
+      Next::execute(index - 1, expr, dev, ext);
+    }
+  }
+
+  /// \brief returns the best time, in seconds, of reps executions of the
+  /// expression with the configuration index. A first execution is not timed
+  /// as it includes the creation of the kernels and memories.
+  /// \param samples: when given, receives the time of each execution
+  template <typename Expr, typename DeviceT>
+  static inline double time(size_t index, Expr &expr, const DeviceT &dev,
+                            const TuneExtent &ext, size_t reps,
+                            std::vector<double> *samples = nullptr) {
+    if (index != 0) {
+      return Next::time(index - 1, expr, dev, ext, reps, samples);
+    }
+    tune_execute_async<ExecPolicy, Config::LC, Config::LR, Config::LCT,
+                       Config::LRT>(expr, dev, ext).wait();
+    double best = 0;
+    for (size_t i = 0; i < reps; i++) {
+      auto begin = tools::get_current_time();
+      tune_execute_async<ExecPolicy, Config::LC, Config::LR, Config::LCT,
+                         Config::LRT>(expr, dev, ext).wait();
+      double t = tools::get_elapse_time(begin, tools::get_current_time());
+      if (samples) {
+        samples->push_back(t);
+      }
+      if (i == 0 || t < best) {
+        best = t;
+      }
+    }
+    return best;
+  }
+
+  /// \brief returns the configuration index as "LC LR LCT LRT"
+  static inline std::string config(size_t index) {
+    if (index != 0) {
+      return Next::config(index - 1);
+    }
+    return std::to_string(Config::LC) + " " + std::to_string(Config::LR) +
+           " " + std::to_string(Config::LCT) + " " +
+           std::to_string(Config::LRT);
+  }
+};
+
+/// \brief a hash of a string which is the same on every run, used for the
+/// keys of the autotuning cache (FNV-1a)
+inline std::string stable_hash(const std::string &s) {
+  unsigned long long h = 14695981039346656037ull;
+  for (unsigned char c : s) {
+    h = (h ^ c) * 1099511628211ull;
+  }
+  std::ostringstream os;
+  os << std::hex << h;
+  return os.str();
+}
+
+/// \brief returns the name and version of the compiler. It is part of the keys
+/// of the autotuning cache, since both the kernels and the names of the
+/// expression types change with the compiler.
+inline std::string compiler_id() {
+#if defined(__VERSION__)
+  return __VERSION__;
+#elif defined(_MSC_FULL_VER)
+  return "msvc " + std::to_string(_MSC_FULL_VER);
+#else
+  return "unknown";
+#endif
+}
+}  // internal
+
+/// \class Tuner
+/// \brief Tuner chooses the local memory and workgroup sizes of an expression
+/// on a device. The first time an expression is executed through the tuner
+/// on a device, it is timed with each candidate configuration and the fastest
+/// one is written to the cache file. Later runs, including other processes
+/// using the same file, read the choice from the cache and execute the
+/// expression with it directly. The entries are keyed by the name of the
+/// device, the policy, the compiler, the type of the expression, the list of
+/// candidates and the size of the images, so each machine, build and image
+/// size keeps its own choice. A candidate which cannot run the expression,
+/// e.g. because its tiles exceed the local memory of the device, is skipped.
+/// Since the expression is executed several times while it is tuned, it must
+/// not read its own output.
+class Tuner {
+ private:
+  using Table = std::map<std::string, std::pair<std::string, double>>;
+  std::string path;
+  size_t reps;
+  /// key -> (configuration, time in seconds)
+  Table table;
+  std::mutex mtx;
+
+  /// \brief reads the entries of the cache file into entries. The lines which
+  /// cannot be parsed, e.g. written partially by a process which was stopped,
+  /// are skipped.
+  static void read(const std::string &file, Table &entries) {
+    std::ifstream in(file);
+    std::string line;
+    while (std::getline(in, line)) {
+      std::istringstream fields(line);
+      std::string key, config, time;
+      if (!std::getline(fields, key, '\t') ||
+          !std::getline(fields, config, '\t') || !std::getline(fields, time)) {
+        continue;
+      }
+      std::istringstream value(time);
+      double seconds;
+      if (value >> seconds && (value >> std::ws).eof()) {
+        entries[key] = std::make_pair(config, seconds);
+      }
+    }
+  }
+
+  /// \brief writes the table to the cache file. The file is read again first,
+  /// so the entries written by other processes since it was loaded are kept.
+  void save() {
+    Table entries;
+    read(path, entries);
+    for (const auto &e : table) {
+      entries[e.first] = e.second;
+    }
+    table.swap(entries);
+    std::ofstream out(path, std::ios::trunc);
+    for (const auto &e : table) {
+      out << e.first << '\t' << e.second.first << '\t' << e.second.second
+          << '\n';
+    }
+  }
+
+  /// \brief returns the key of the expression in the cache. The expression is
+  /// named by its demangled type and the candidates by their sizes, rather
+  /// than by the type_info names, which are specific to the compiler ABI.
+  template <policy::PolicyType ExecPolicy, typename Configs, typename Expr,
+            typename DeviceT>
+  static std::string key(const DeviceT &dev, const internal::TuneExtent &ext) {
+    using Dispatch = internal::TuneDispatch<ExecPolicy, Configs>;
+    std::string configs;
+    for (size_t i = 0; i < Dispatch::Size; i++) {
+      configs += Dispatch::config(i) + ",";
+    }
+    return dev.name() + "/" + std::to_string(ExecPolicy) + "/" +
+           internal::stable_hash(internal::compiler_id()) + "/" +
+           internal::stable_hash(internal::type_name<Expr>()) + "/" +
+           internal::stable_hash(configs) + "/" + std::to_string(ext.cols) +
+           "x" + std::to_string(ext.rows);
+  }
+
+  /// \brief the compile-time size of the root of the expression
+  template <typename Expr>
+  static internal::TuneExtent static_extent() {
+    return internal::TuneExtent{false, Expr::Type::Cols, Expr::Type::Rows};
+  }
+
+  template <policy::PolicyType ExecPolicy, typename Configs, typename Expr,
+            typename DeviceT>
+  size_t select(Expr &expr, const DeviceT &dev,
+                const internal::TuneExtent &ext) {
+    using Dispatch = internal::TuneDispatch<ExecPolicy, Configs>;
+    static_assert(Dispatch::Size > 0, "The Tuner needs a candidate");
+    const std::string k = key<ExecPolicy, Configs, Expr>(dev, ext);
+    std::lock_guard<std::mutex> lock(mtx);
+    auto found = table.find(k);
+    if (found != table.end()) {
+      for (size_t i = 0; i < Dispatch::Size; i++) {
+        if (Dispatch::config(i) == found->second.first) {
+          return i;
+        }
+      }
+    }
+    size_t best = Dispatch::Size;
+    double bestTime = 0;
+    std::exception_ptr failure;
+    for (size_t i = 0; i < Dispatch::Size; i++) {
+      double t;
+      try {
+        t = Dispatch::time(i, expr, dev, ext, reps);
+      } catch (...) {
+        /// the candidate cannot run the expression on the device
+        failure = std::current_exception();
+        continue;
+      }
+      if (best == Dispatch::Size || t < bestTime) {
+        best = i;
+        bestTime = t;
+      }
+    }
+    if (best == Dispatch::Size) {
+      std::rethrow_exception(failure);
+    }
+    table[k] = std::make_pair(Dispatch::config(best), bestTime);
+    save();
+    return best;
+  }
+
+ public:
+  /// \brief creates a tuner whose choices are kept in the file at path. The
+  /// file is read if it exists.
+  /// \param file: the path of the cache file
+  /// \param repeat: the number of timed executions of each configuration
+  explicit Tuner(std::string file, size_t repeat = 5)
+      : path(std::move(file)), reps(repeat > 0 ? repeat : 1) {
+    read(path, table);
+  }
+
+  /// \brief returns the index in Configs of the configuration chosen for the
+  /// expression on the device, tuning the expression if it is not in the
+  /// cache yet.
+  /// template parameters:
+  /// \tparam ExecPolicy: the policy used to execute the expression
+  /// \tparam Configs: the list of candidate configurations
+  /// function parameters:
+  /// \param expr: the expression to be executed
+  /// \param dev: the selected device for executing the expression
+  /// \return size_t
+  template <policy::PolicyType ExecPolicy,
+            typename Configs = DefaultTuneConfigs, typename Expr,
+            typename DeviceT>
+  size_t select(Expr &expr, const DeviceT &dev) {
+    return select<ExecPolicy, Configs>(expr, dev, static_extent<Expr>());
+  }
+
+  /// \brief select function for images whose size is only known at runtime.
+  /// The configuration is chosen for that size.
+  /// \param expr: the expression to be executed
+  /// \param dev: the selected device for executing the expression
+  /// \param cols: the runtime column size of the root of the expression
+  /// \param rows: the runtime row size of the root of the expression
+  /// \return size_t
+  template <policy::PolicyType ExecPolicy,
+            typename Configs = DefaultTuneConfigs, typename Expr,
+            typename DeviceT>
+  size_t select(Expr &expr, const DeviceT &dev, size_t cols, size_t rows) {
+    return select<ExecPolicy, Configs>(expr, dev,
+                                       internal::TuneExtent{true, cols, rows});
+  }
+
+  /// \brief returns the configuration chosen for the expression as
+  /// "LC LR LCT LRT", tuning the expression if it is not in the cache yet.
+  template <policy::PolicyType ExecPolicy,
+            typename Configs = DefaultTuneConfigs, typename Expr,
+            typename DeviceT>
+  std::string chosen(Expr &expr, const DeviceT &dev) {
+    return internal::TuneDispatch<ExecPolicy, Configs>::config(
+        select<ExecPolicy, Configs>(expr, dev));
+  }
+
+  /// \brief chosen function for images whose size is only known at runtime.
+  template <policy::PolicyType ExecPolicy,
+            typename Configs = DefaultTuneConfigs, typename Expr,
+            typename DeviceT>
+  std::string chosen(Expr &expr, const DeviceT &dev, size_t cols,
+                     size_t rows) {
+    return internal::TuneDispatch<ExecPolicy, Configs>::config(
+        select<ExecPolicy, Configs>(expr, dev, cols, rows));
+  }
+
+  /// \brief executes the expression with the configuration chosen for it on
+  /// the device, tuning the expression if it is not in the cache yet.
+  /// template parameters:
+  /// \tparam ExecPolicy: the policy used to execute the expression
+  /// \tparam Configs: the list of candidate configurations
+  /// function parameters:
+  /// \param expr: the expression to be executed
+  /// \param dev: the selected device for executing the expression
+  /// \return void
+  template <policy::PolicyType ExecPolicy,
+            typename Configs = DefaultTuneConfigs, typename Expr,
+            typename DeviceT>
+  void execute(Expr &expr, const DeviceT &dev) {
+    const auto ext = static_extent<Expr>();
+    internal::TuneDispatch<ExecPolicy, Configs>::execute(
+        select<ExecPolicy, Configs>(expr, dev, ext), expr, dev, ext);
+  }
+
+  /// \brief execute function for images whose size is only known at runtime.
+  /// See the runtime-sized visioncpp::execute function.
+  /// \param expr: the expression to be executed
+  /// \param dev: the selected device for executing the expression
+  /// \param cols: the runtime column size of the root of the expression
+  /// \param rows: the runtime row size of the root of the expression
+  /// \return void
+  template <policy::PolicyType ExecPolicy,
+            typename Configs = DefaultTuneConfigs, typename Expr,
+            typename DeviceT>
+  void execute(Expr &expr, const DeviceT &dev, size_t cols, size_t rows) {
+    const internal::TuneExtent ext{true, cols, rows};
+    internal::TuneDispatch<ExecPolicy, Configs>::execute(
+        select<ExecPolicy, Configs>(expr, dev, ext), expr, dev, ext);
+  }
+};
+}  // visioncpp
+#endif  // VISIONCPP_INCLUDE_FRAMEWORK_EXECUTOR_TUNER_HPP_
@@ -58,6 +58,17 @@ struct LeafCount;
 /// subxpression.
 template <size_t Category, typename Expr>
 struct LocalMemCount;
+/// \brief is used to find how far outside of a region of the root the nodes
+/// of the expression tree are read. The margin is given in pixels of the
+/// nodes, which does not underestimate it in pixels of the root as the nodes
+/// are never smaller than the root.
+template <size_t Category, typename Expr>
+struct HaloMargin;
+/// \brief is used to find whether the leaves of the expression tree read by a
+/// tile of Cols x Rows threads are read inside their memories when the tile
+/// and its halo lie inside the image.
+template <size_t Category, typename Expr, size_t Cols, size_t Rows>
+struct InteriorLeaves;
 
 // template <size_t Memory_Type, size_t N, size_t R = 0, size_t C = 0>
 // struct PlaceHolder;
@@ -70,7 +81,9 @@ struct MakePlaceHolderExprHelper;
 }  // internal
 }  // visioncpp
 // Static Operation Over Type
+#include "halo_margin.hpp"
 #include "leaf_count.hpp"
+#include "local_alias.hpp"
 #include "local_mem_count.hpp"
 #include "local_output.hpp"
 #include "make_place_holder_expr.hpp"
@@ -0,0 +1,135 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file halo_margin.hpp
+/// \brief HaloMargin is used to find how far outside of a region of the root
+/// the nodes of an expression tree may be read by the neighbour operations, and
+/// InteriorLeaves whether the leaves are then read inside their memories.
+
+#ifndef VISIONCPP_INCLUDE_FRAMEWORK_EXPR_CONVERTOR_HALO_MARGIN_HPP_
+#define VISIONCPP_INCLUDE_FRAMEWORK_EXPR_CONVERTOR_HALO_MARGIN_HPP_
+
+namespace visioncpp {
+namespace internal {
+/// \brief the largest of the four sides of a halo
+template <size_t Halo_T, size_t Halo_L, size_t Halo_B, size_t Halo_R>
+struct HaloSide {
+  static constexpr size_t LR = Halo_L > Halo_R ? Halo_L : Halo_R;
+  static constexpr size_t TB = Halo_T > Halo_B ? Halo_T : Halo_B;
+  static constexpr size_t Value = LR > TB ? LR : TB;
+};
+
+/// \brief specialisation of HaloMargin when the node has one child
+template <typename Expr>
+struct HaloMargin<expr_category::Unary, Expr> {
+  static constexpr size_t Value =
+      HaloMargin<Expr::RHSExpr::ND_Category, typename Expr::RHSExpr>::Value;
+};
+
+/// \brief specialisation of HaloMargin when the node has two children
+template <typename Expr>
+struct HaloMargin<expr_category::Binary, Expr> {
+  static constexpr size_t LHSValue =
+      HaloMargin<Expr::LHSExpr::ND_Category, typename Expr::LHSExpr>::Value;
+  static constexpr size_t RHSValue =
+      HaloMargin<Expr::RHSExpr::ND_Category, typename Expr::RHSExpr>::Value;
+  static constexpr size_t Value = LHSValue > RHSValue ? LHSValue : RHSValue;
+};
+
+/// \brief specialisation of HaloMargin when the node is a LeafNode. A terminal
+/// is never computed.
+template <typename RHSExpr, size_t LVL>
+struct HaloMargin<expr_category::Unary, LeafNode<RHSExpr, LVL>> {
+  static constexpr size_t Value = 0;
+};
+
+/// \brief specialisation of HaloMargin when the node is a scheduled
+/// subexpression. Its kernel is launched on the same region as the root, so
+/// the neighbour operations of the subexpression read their own halo around it.
+template <policy::PolicyType PlcType, typename Node, size_t LC, size_t LR,
+          size_t LCT, size_t LRT, size_t LVL>
+struct HaloMargin<
+    expr_category::Unary,
+    LeafNode<VirtualMemory<PlcType, Node, LC, LR, LCT, LRT>, LVL>> {
+  static constexpr size_t Value =
+      HaloMargin<Node::ND_Category, Node>::Value;
+};
+
+/// \brief specialisation of HaloMargin when the node is a neighbour operation
+/// without filter. Its child is read as far as the halo of the node outside of
+/// the region of the node.
+template <typename OP, size_t Halo_T, size_t Halo_L, size_t Halo_B,
+          size_t Halo_R, typename RHS, size_t Cols, size_t Rows, size_t LfType,
+          size_t LVL>
+struct HaloMargin<expr_category::Unary,
+                  StnNoFilt<OP, Halo_T, Halo_L, Halo_B, Halo_R, RHS, Cols,
+                            Rows, LfType, LVL>> {
+  static constexpr size_t Value =
+      HaloSide<Halo_T, Halo_L, Halo_B, Halo_R>::Value +
+      HaloMargin<RHS::ND_Category, RHS>::Value;
+};
+
+/// \brief specialisation of HaloMargin when the node is a neighbour operation
+/// with filter. The filter is read whole by each pixel.
+template <typename OP, size_t Halo_T, size_t Halo_L, size_t Halo_B,
+          size_t Halo_R, typename LHS, typename RHS, size_t Cols, size_t Rows,
+          size_t LfType, size_t LVL>
+struct HaloMargin<expr_category::Binary,
+                  StnFilt<OP, Halo_T, Halo_L, Halo_B, Halo_R, LHS, RHS, Cols,
+                          Rows, LfType, LVL>> {
+  static constexpr size_t Value =
+      HaloSide<Halo_T, Halo_L, Halo_B, Halo_R>::Value +
+      HaloMargin<LHS::ND_Category, LHS>::Value;
+};
+
+/// \brief specialisation of InteriorLeaves when the node has one child
+template <typename Expr, size_t Cols, size_t Rows>
+struct InteriorLeaves<expr_category::Unary, Expr, Cols, Rows> {
+  static constexpr bool Value =
+      InteriorLeaves<Expr::RHSExpr::ND_Category, typename Expr::RHSExpr, Cols,
+                     Rows>::Value;
+};
+
+/// \brief specialisation of InteriorLeaves when the node has two children
+template <typename Expr, size_t Cols, size_t Rows>
+struct InteriorLeaves<expr_category::Binary, Expr, Cols, Rows> {
+  static constexpr bool Value =
+      InteriorLeaves<Expr::LHSExpr::ND_Category, typename Expr::LHSExpr, Cols,
+                     Rows>::Value &&
+      InteriorLeaves<Expr::RHSExpr::ND_Category, typename Expr::RHSExpr, Cols,
+                     Rows>::Value;
+};
+
+/// \brief specialisation of InteriorLeaves when the node is a LeafNode of the
+/// placeholder expression. The constant variables and the memories on device
+/// constant memory are read in place; the other memories are loaded from the
+/// halo of the tile, which is inside them only when they have the size of the
+/// threads.
+template <size_t Memory_Type, size_t N, size_t C, size_t R, size_t Sc,
+          size_t LVL, size_t Cols, size_t Rows>
+struct InteriorLeaves<expr_category::Unary,
+                      LeafNode<PlaceHolder<Memory_Type, N, C, R, Sc>, LVL>,
+                      Cols, Rows> {
+  static constexpr bool Value = Memory_Type == memory_type::Const ||
+                                Sc == scope::Constant ||
+                                (C == Cols && R == Rows);
+};
+}  // internal
+}  // visioncpp
+#endif  // VISIONCPP_INCLUDE_FRAMEWORK_EXPR_CONVERTOR_HALO_MARGIN_HPP_
@@ -0,0 +1,216 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file local_alias.hpp
+/// \brief This file contains the liveness pass which lets the nodes of a fused
+/// kernel share their local memory when their tiles are not used at the same
+/// time.
+
+#ifndef VISIONCPP_INCLUDE_FRAMEWORK_EXPR_CONVERTOR_LOCAL_ALIAS_HPP_
+#define VISIONCPP_INCLUDE_FRAMEWORK_EXPR_CONVERTOR_LOCAL_ALIAS_HPP_
+
+#include <type_traits>
+
+namespace visioncpp {
+namespace internal {
+/// \struct LocalTile
+/// \brief LocalTile describes the local memory of a node of a fused kernel.
+/// The nodes write their tile one after the other, in the order of the local
+/// memories of the kernel (a child before its parent), and a tile is only read
+/// by the parent of its node.
+/// template parameters:
+/// \tparam T: the type of each element of the tile
+/// \tparam Elements: the number of elements of the tile
+/// \tparam Reader: the number of tiles from this one to the one of the parent
+/// of the node, which is the last node reading it
+template <typename T, size_t Elements, size_t Reader>
+struct LocalTile {
+  using Type = T;
+  static constexpr size_t Count = Elements;
+  static constexpr size_t ReadBy = Reader;
+};
+
+/// \struct LocalTiles
+/// \brief LocalTiles is the list of the tiles of a subtree, in the order of
+/// the local memories of the kernel.
+template <typename... Tiles>
+struct LocalTiles {
+  static constexpr size_t Size = sizeof...(Tiles);
+};
+
+/// \struct ConcatTiles
+/// \brief ConcatTiles appends the tiles of the lists Rest to the ones of List
+template <typename List, typename... Rest>
+struct ConcatTiles {
+  using Type = List;
+};
+
+/// \brief specialisation of ConcatTiles appending the tiles of the next list
+template <typename... Head, typename... Next, typename... Rest>
+struct ConcatTiles<LocalTiles<Head...>, LocalTiles<Next...>, Rest...>
+    : ConcatTiles<LocalTiles<Head..., Next...>, Rest...> {};
+
+/// \struct ReadTiles
+/// \brief ReadTiles sets the reader of the tile of the node of a subtree, which
+/// is the last tile of the subtree, to Reader tiles after it.
+/// template parameters:
+/// \tparam Tiles: the tiles of the subtree
+/// \tparam Reader: the number of tiles from the node to its parent
+/// \tparam Done: the tiles already copied
+template <typename Tiles, size_t Reader, typename Done = LocalTiles<>>
+struct ReadTiles;
+
+/// \brief specialisation of ReadTiles when the subtree has no tile
+template <size_t Reader, typename... Done>
+struct ReadTiles<LocalTiles<>, Reader, LocalTiles<Done...>> {
+  using Type = LocalTiles<Done...>;
+};
+
+/// \brief specialisation of ReadTiles for the tile of the node
+template <typename T, size_t Elements, size_t Old, size_t Reader,
+          typename... Done>
+struct ReadTiles<LocalTiles<LocalTile<T, Elements, Old>>, Reader,
+                 LocalTiles<Done...>> {
+  using Type = LocalTiles<Done..., LocalTile<T, Elements, Reader>>;
+};
+
+/// \brief specialisation of ReadTiles for the tiles of the subtree of the node
+template <typename Tile, typename Next, typename... Rest, size_t Reader,
+          typename... Done>
+struct ReadTiles<LocalTiles<Tile, Next, Rest...>, Reader, LocalTiles<Done...>>
+    : ReadTiles<LocalTiles<Next, Rest...>, Reader,
+                LocalTiles<Done..., Tile>> {};
+
+/// \struct LocalSlot
+/// \brief LocalSlot is a local memory shared by tiles of the same type.
+/// template parameters:
+/// \tparam T: the type of each element of the slot
+/// \tparam Free: the position of the last tile reading the slot so far. The
+/// slot can be written again by the tiles after this position.
+/// \tparam Elements: the number of elements of the largest tile of the slot
+template <typename T, size_t Free, size_t Elements>
+struct LocalSlot {
+  using Type = T;
+  static constexpr size_t Count = Elements;
+  static constexpr size_t Bytes = Elements * sizeof(T);
+};
+
+/// \struct LocalSlots
+/// \brief LocalSlots is the list of the local memories created for a kernel
+template <typename... Slots>
+struct LocalSlots {
+  static constexpr size_t Size = sizeof...(Slots);
+  static constexpr size_t Bytes = 0;
+};
+
+/// \brief specialisation of LocalSlots adding up the bytes of the slots
+template <typename Slot, typename... Slots>
+struct LocalSlots<Slot, Slots...> {
+  static constexpr size_t Size = 1 + sizeof...(Slots);
+  static constexpr size_t Bytes = Slot::Bytes + LocalSlots<Slots...>::Bytes;
+};
+
+/// \struct FreeSlot
+/// \brief FreeSlot gives the index of the first slot of type T which is no
+/// longer read at the position Pos, or the number of slots when there is none.
+template <typename T, size_t Pos, size_t I, typename... Slots>
+struct FreeSlot {
+  static constexpr size_t Index = I;
+};
+
+/// \brief specialisation of FreeSlot checking the slot I
+template <typename T, size_t Pos, size_t I, typename S, size_t Free,
+          size_t Elements, typename... Slots>
+struct FreeSlot<T, Pos, I, LocalSlot<S, Free, Elements>, Slots...> {
+  static constexpr size_t Index =
+      (std::is_same<T, S>::value && Free < Pos)
+          ? I
+          : FreeSlot<T, Pos, I + 1, Slots...>::Index;
+};
+
+/// \struct TakeSlot
+/// \brief TakeSlot gives the slots once a tile of Elements elements of type T,
+/// read until the position End, has been placed in the slot I. A new slot is
+/// added when I is the number of slots.
+template <size_t I, typename T, size_t End, size_t Elements, typename Done,
+          typename Rest, bool Here = (Done::Size == I)>
+struct TakeSlot;
+
+/// \brief specialisation of TakeSlot adding a new slot
+template <size_t I, typename T, size_t End, size_t Elements, typename... Done>
+struct TakeSlot<I, T, End, Elements, LocalSlots<Done...>, LocalSlots<>, true> {
+  using Type = LocalSlots<Done..., LocalSlot<T, End, Elements>>;
+};
+
+/// \brief specialisation of TakeSlot for the slot I, which is grown to the
+/// tile when it is smaller
+template <size_t I, typename T, size_t End, size_t Elements, typename... Done,
+          size_t Free, size_t Count, typename... Rest>
+struct TakeSlot<I, T, End, Elements, LocalSlots<Done...>,
+                LocalSlots<LocalSlot<T, Free, Count>, Rest...>, true> {
+  using Type = LocalSlots<
+      Done..., LocalSlot<T, End, (Count > Elements ? Count : Elements)>,
+      Rest...>;
+};
+
+/// \brief specialisation of TakeSlot for the slots before the slot I
+template <size_t I, typename T, size_t End, size_t Elements, typename... Done,
+          typename Slot, typename... Rest>
+struct TakeSlot<I, T, End, Elements, LocalSlots<Done...>,
+                LocalSlots<Slot, Rest...>, false>
+    : TakeSlot<I, T, End, Elements, LocalSlots<Done..., Slot>,
+               LocalSlots<Rest...>> {};
+
+/// \struct LocalAlias
+/// \brief LocalAlias is the liveness pass assigning the tiles of a fused kernel
+/// to the local memories created for it. The tile at the position Pos is
+/// written at Pos and read until its parent, at Pos + ReadBy. As every node
+/// ends with a barrier, a tile can be written in the local memory of a tile of
+/// the same type once the parent of the latter has been computed. Each tile is
+/// placed in the first free slot of its type, so that a chain of nodes uses two
+/// local memories rather than one per node.
+/// template parameters:
+/// \tparam Tiles: the tiles left to place
+/// \tparam Pos: the position of the first tile of Tiles
+/// \tparam Slots: the slots of the tiles placed so far
+/// \tparam Assigned: the index of the slot of each tile placed so far
+template <typename Tiles, size_t Pos = 0, typename Slots = LocalSlots<>,
+          typename Assigned = tools::tuple::Index_list<>>
+struct LocalAlias {
+  using Type = Slots;
+  using Slot = Assigned;
+};
+
+/// \brief specialisation of LocalAlias placing the tile at the position Pos
+template <typename Tile, typename... Tiles, size_t Pos, typename... Slots,
+          size_t... Assigned>
+struct LocalAlias<LocalTiles<Tile, Tiles...>, Pos, LocalSlots<Slots...>,
+                  tools::tuple::Index_list<Assigned...>>
+    : LocalAlias<
+          LocalTiles<Tiles...>, Pos + 1,
+          typename TakeSlot<
+              FreeSlot<typename Tile::Type, Pos, 0, Slots...>::Index,
+              typename Tile::Type, Pos + Tile::ReadBy, Tile::Count,
+              LocalSlots<>, LocalSlots<Slots...>>::Type,
+          tools::tuple::Index_list<
+              Assigned...,
+              FreeSlot<typename Tile::Type, Pos, 0, Slots...>::Index>> {};
+}  // internal
+}  // visioncpp
+#endif  // VISIONCPP_INCLUDE_FRAMEWORK_EXPR_CONVERTOR_LOCAL_ALIAS_HPP_
@@ -25,29 +25,37 @@
 
 namespace visioncpp {
 namespace internal {
+/// \struct LocalAccessor
+/// \brief LocalAccessor is used to select the type of the local memory
+/// accessor from the command group handler used to build the kernel. By default
+/// the sycl handler is used and a sycl local accessor is created. A backend
+/// that does not use sycl for executing the kernel specialises this struct for
+/// its own handler.
+/// template parameters:
+/// \tparam Handler: the command group handler type
+/// \tparam ElementType: the type of each element of the local memory
+/// \tparam Dim: the dimension of the local memory
+template <typename Handler, typename ElementType, size_t Dim>
+struct LocalAccessor {
+  using Type = cl::sycl::accessor<ElementType, Dim,
+                                  cl::sycl::access::mode::read_write,
+                                  cl::sycl::access::target::local>;
+};
+
 /// \brief OutputAccessor struct is used to generate an accessor when the node
 /// is not root. When the node is root no local accessor will be created.
 /// Therefore we eliminate the extra local memory for root node.
 template <size_t IsRoot, size_t LeafType, size_t LC, size_t LR,
           typename OutType>
 struct OutputAccessor {
-  static auto getTuple(cl::sycl::handler &cgh)
-      -> decltype(tools::tuple::make_tuple()) {
-    return tools::tuple::make_tuple();
-  }
+  /// the tile of local memory needed for the output of the node
+  using Tiles = LocalTiles<>;
 };
 /// \brief specialisation of OutputAccessor when a node is not a root node.
 /// Here we create on output memory for the node.
 template <size_t LeafType, size_t LC, size_t LR, typename OutType>
 struct OutputAccessor<false, LeafType, LC, LR, OutType> {
-  using Accessor = cl::sycl::accessor<OutType, MemDimension<LeafType>::Dim,
-                                      cl::sycl::access::mode::read_write,
-                                      cl::sycl::access::target::local>;
-  static tools::tuple::Tuple<Accessor> getTuple(cl::sycl::handler &cgh) {
-    /// In get range the column is changed with row in order to set x as
-    /// column and y as row
-    return Accessor(get_range<MemDimension<LeafType>::Dim>(LR, LC), cgh);
-  }
+  using Tiles = LocalTiles<LocalTile<OutType, LC * LR, 0>>;
 };
 
 /// \brief LocalOutput accessor. The local output does nothing when the
@@ -66,13 +74,9 @@ template <bool PointOp, size_t IsRoot, size_t LC, size_t LR, typename Expr>
 struct LocalOutput {
   static constexpr size_t Out_LC = LC;
   static constexpr size_t Out_LR = LR;
-  /// \brief getTuple function is used to create and wrap local memory into a
-  /// tuple
-  /// \param cgh : sycl command group handler. 
-  static inline decltype(tools::tuple::make_tuple()) getTuple(
-      cl::sycl::handler &cgh) {
-    return tools::tuple::make_tuple();
-  }
+  /// the tiles of local memory needed by the node and its subtree, in the
+  /// order of the local memories of the kernel
+  using Tiles = LocalTiles<>;
 };
 
 /// \brief specialisation of the LocalOutput for leaf node when the vision
@@ -88,9 +92,7 @@ struct LocalOutput<
              LVL>> {
   static constexpr size_t Out_LC = LC;
   static constexpr size_t Out_LR = LR;
-  static decltype(tools::tuple::make_tuple()) getTuple(cl::sycl::handler &cgh) {
-    return tools::tuple::make_tuple();
-  }
+  using Tiles = LocalTiles<>;
 };
 
 /// \brief specialisation of the LocalOutput for leaf node when the vision
@@ -107,9 +109,7 @@ struct LocalOutput<
              LVL>> {
   static constexpr size_t Out_LC = LC;
   static constexpr size_t Out_LR = LR;
-  static decltype(tools::tuple::make_tuple()) getTuple(cl::sycl::handler &cgh) {
-    return tools::tuple::make_tuple();
-  }
+  using Tiles = LocalTiles<>;
 };
 
 /// \brief LocalOutput specialisation for leaf node it creates the local
@@ -119,12 +119,8 @@ template <size_t IsRoot, size_t LC, size_t LR, size_t LVL, typename RHS>
 struct LocalOutput<false, IsRoot, LC, LR, LeafNode<RHS, LVL>> {
   static constexpr size_t Out_LC = LC;
   static constexpr size_t Out_LR = LR;
-  using Accessor = cl::sycl::accessor<typename RHS::ElementType, RHS::Dim,
-                                      cl::sycl::access::mode::read_write,
-                                      cl::sycl::access::target::local>;
-  static tools::tuple::Tuple<Accessor> getTuple(cl::sycl::handler &cgh) {
-    return Accessor(get_range<RHS::Dim>(LR, LC), cgh);
-  }
+  using Tiles =
+      LocalTiles<LocalTile<typename RHS::ElementType, LC * LR, 0>>;
 };
 
 /// \brief LocalOutput specialisation for unary operation(RUnOP) it creates the
@@ -138,15 +134,11 @@ struct LocalOutput<false, IsRoot, LC, LR,
       LocalOutput<false, false, LC, LR, RHSExpr>::Out_LC;
   static constexpr size_t Out_LR =
       LocalOutput<false, false, LC, LR, RHSExpr>::Out_LR;
-  static auto getTuple(cl::sycl::handler &cgh) -> decltype(tools::tuple::append(
-      LocalOutput<false, false, LC, LR, RHSExpr>::getTuple(cgh),
-      OutputAccessor<IsRoot, LeafType, Out_LC, Out_LR,
-                     typename OP::OutType>::getTuple(cgh))) {
-    auto OutTuple = OutputAccessor<IsRoot, LeafType, Out_LC, Out_LR,
-                                   typename OP::OutType>::getTuple(cgh);
-    auto RHSTuple = LocalOutput<false, false, LC, LR, RHSExpr>::getTuple(cgh);
-    return tools::tuple::append(RHSTuple, OutTuple);
-  }
+  using Tiles = typename ConcatTiles<
+      typename ReadTiles<
+          typename LocalOutput<false, false, LC, LR, RHSExpr>::Tiles, 1>::Type,
+      typename OutputAccessor<IsRoot, LeafType, Out_LC, Out_LR,
+                              typename OP::OutType>::Tiles>::Type;
 };
 
 /// \brief LocalOutput specialisation for binary operation(RBiOP) it creates the
@@ -170,20 +162,14 @@ struct LocalOutput<false, IsRoot, LC, LR,
       LocalOutput<false, false, LC, LR, Type>::Out_LC;
   static constexpr size_t Out_LR =
       LocalOutput<false, false, LC, LR, Type>::Out_LR;
-
-  static auto getTuple(cl::sycl::handler &cgh) -> decltype(tools::tuple::append(
-      tools::tuple::append(
-          LocalOutput<false, false, LC, LR, LHSExpr>::getTuple(cgh),
-          LocalOutput<false, false, LC, LR, RHSExpr>::getTuple(cgh)),
-      OutputAccessor<IsRoot, LeafType, Out_LC, Out_LR,
-                     typename OP::OutType>::getTuple(cgh))) {
-    auto OutTuple = OutputAccessor<IsRoot, LeafType, Out_LC, Out_LR,
-                                   typename OP::OutType>::getTuple(cgh);
-    auto LHSTuple = LocalOutput<false, false, LC, LR, LHSExpr>::getTuple(cgh);
-    auto RHSTuple = LocalOutput<false, false, LC, LR, RHSExpr>::getTuple(cgh);
-    return tools::tuple::append(tools::tuple::append(LHSTuple, RHSTuple),
-                                OutTuple);
-  }
+  using RHSTiles = typename LocalOutput<false, false, LC, LR, RHSExpr>::Tiles;
+  using Tiles = typename ConcatTiles<
+      typename ReadTiles<
+          typename LocalOutput<false, false, LC, LR, LHSExpr>::Tiles,
+          RHSTiles::Size + 1>::Type,
+      typename ReadTiles<RHSTiles, 1>::Type,
+      typename OutputAccessor<IsRoot, LeafType, Out_LC, Out_LR,
+                              typename OP::OutType>::Tiles>::Type;
 };
 /// \brief LocalOutput specialisation for binary neighbour operation(StnFilt).
 /// It creates the local accessor to store the output of neighbour operation
@@ -203,24 +189,14 @@ struct LocalOutput<false, IsRoot, LC, LR,
   static constexpr size_t Out_LR =
       LocalOutput<false, false, LC + Halo_COL, LR + Halo_ROW, LHSExpr>::Out_LR -
       Halo_ROW;
-
-  static auto getTuple(cl::sycl::handler &cgh) -> decltype(tools::tuple::append(
-      tools::tuple::append(
-          LocalOutput<false, false, LC + Halo_COL, LR + Halo_ROW,
-                      LHSExpr>::getTuple(cgh),
-          LocalOutput<false, false, LC, LR, RHSExpr>::getTuple(cgh)),
-      OutputAccessor<IsRoot, LeafType, Out_LC, Out_LR,
-                     typename OP::OutType>::getTuple(cgh))) {
-    auto OutTuple = OutputAccessor<IsRoot, LeafType, Out_LC, Out_LR,
-                                   typename OP::OutType>::getTuple(cgh);
-    auto LHSTuple = LocalOutput<false, false, LC + Halo_COL, LR + Halo_ROW,
-                                LHSExpr>::getTuple(cgh);
-
-    auto RHSTuple = LocalOutput<false, false, LC, LR, RHSExpr>::getTuple(cgh);
-
-    return tools::tuple::append(tools::tuple::append(LHSTuple, RHSTuple),
-                                OutTuple);
-  }
+  using RHSTiles = typename LocalOutput<false, false, LC, LR, RHSExpr>::Tiles;
+  using Tiles = typename ConcatTiles<
+      typename ReadTiles<typename LocalOutput<false, false, LC + Halo_COL,
+                                              LR + Halo_ROW, LHSExpr>::Tiles,
+                         RHSTiles::Size + 1>::Type,
+      typename ReadTiles<RHSTiles, 1>::Type,
+      typename OutputAccessor<IsRoot, LeafType, Out_LC, Out_LR,
+                              typename OP::OutType>::Tiles>::Type;
 };
 
 /// \brief LocalOutput specialisation for unary neighbour operation(StnNoFilt).
@@ -240,19 +216,12 @@ struct LocalOutput<false, IsRoot, LC, LR,
   static constexpr size_t Out_LR =
       LocalOutput<false, false, LC + Halo_COL, LR + Halo_ROW, RHSExpr>::Out_LR -
       Halo_ROW;
-
-  static auto getTuple(cl::sycl::handler &cgh) -> decltype(tools::tuple::append(
-      LocalOutput<false, false, LC + Halo_COL, LR + Halo_ROW,
-                  RHSExpr>::getTuple(cgh),
-      OutputAccessor<IsRoot, LeafType, Out_LC, Out_LR,
-                     typename OP::OutType>::getTuple(cgh))) {
-    auto OutTuple = OutputAccessor<IsRoot, LeafType, Out_LC, Out_LR,
-                                   typename OP::OutType>::getTuple(cgh);
-    auto RHSTuple = LocalOutput<false, false, LC + Halo_COL, LR + Halo_ROW,
-                                RHSExpr>::getTuple(cgh);
-
-    return tools::tuple::append(RHSTuple, OutTuple);
-  }
+  using Tiles = typename ConcatTiles<
+      typename ReadTiles<typename LocalOutput<false, false, LC + Halo_COL,
+                                              LR + Halo_ROW, RHSExpr>::Tiles,
+                         1>::Type,
+      typename OutputAccessor<IsRoot, LeafType, Out_LC, Out_LR,
+                              typename OP::OutType>::Tiles>::Type;
 };
 
 /// \brief LocalOutput specialisation for reduction neighbour operation(RDCN).
@@ -271,15 +240,11 @@ struct LocalOutput<false, IsRoot, LC, LR,
       LocalOutput<false, false, LC, LR, RHSExpr>::Out_LC / LC_Ratio;
   static constexpr size_t Out_LR =
       LocalOutput<false, false, LC, LR, RHSExpr>::Out_LR / LR_Ratio;
-  static auto getTuple(cl::sycl::handler &cgh) -> decltype(tools::tuple::append(
-      LocalOutput<false, false, LC, LR, RHSExpr>::getTuple(cgh),
-      OutputAccessor<IsRoot, LeafType, Out_LC, Out_LR,
-                     typename OP::OutType>::getTuple(cgh))) {
-    auto OutTuple = OutputAccessor<IsRoot, LeafType, Out_LC, Out_LR,
-                                   typename OP::OutType>::getTuple(cgh);
-    auto RHSTuple = LocalOutput<false, false, LC, LR, RHSExpr>::getTuple(cgh);
-    return tools::tuple::append(RHSTuple, OutTuple);
-  }
+  using Tiles = typename ConcatTiles<
+      typename ReadTiles<
+          typename LocalOutput<false, false, LC, LR, RHSExpr>::Tiles, 1>::Type,
+      typename OutputAccessor<IsRoot, LeafType, Out_LC, Out_LR,
+                              typename OP::OutType>::Tiles>::Type;
 };
 
 /// \brief LocalOutput specialisation for point operation(ParallelCopy).
@@ -293,10 +258,7 @@ struct LocalOutput<
     false, IsRoot, LC, LR,
     ParallelCopy<LHSExpr, RHSExpr, Cols, Rows, OffsetColIn, OffsetRowIn,
                  OffsetColOut, OffsetRowOut, LeafType, LVL>> {
-  static auto getTuple(cl::sycl::handler &cgh)
-      -> decltype(LocalOutput<false, false, LC, LR, RHSExpr>::getTuple(cgh)) {
-    return LocalOutput<false, false, LC, LR, RHSExpr>::getTuple(cgh);
-  }
+  using Tiles = typename LocalOutput<false, false, LC, LR, RHSExpr>::Tiles;
 };
 
 /// \brief LocalOutput specialisation for point operation(Assign).
@@ -307,25 +269,91 @@ template <size_t IsRoot, size_t LC, size_t LR, typename LHSExpr,
           size_t LVL>
 struct LocalOutput<false, IsRoot, LC, LR,
                    Assign<LHSExpr, RHSExpr, Cols, Rows, LeafType, LVL>> {
-  static auto getTuple(cl::sycl::handler &cgh)
-      -> decltype(LocalOutput<false, IsRoot, LC, LR, RHSExpr>::getTuple(cgh)) {
-    return LocalOutput<false, IsRoot, LC, LR, RHSExpr>::getTuple(cgh);
+  using Tiles = typename LocalOutput<false, IsRoot, LC, LR, RHSExpr>::Tiles;
+};
+
+/// \struct LocalPlan
+/// \brief LocalPlan gives the local memories created for the kernel of the
+/// expression with a local memory of LC x LR, and the local memory used by
+/// each tile of the kernel (see LocalAlias).
+template <size_t LC, size_t LR, typename Expr>
+struct LocalPlan
+    : LocalAlias<typename LocalOutput<
+          Expr::Operation_type != ops_category::NeighbourOP, true, LC, LR,
+          Expr>::Tiles> {};
+
+/// \struct LocalSlotAccessors
+/// \brief LocalSlotAccessors creates the local memories of a kernel and hands
+/// to each tile the one it is assigned to. The tuple has an accessor per tile,
+/// in the order of the tiles, so that the evaluators find the local memory of
+/// a node at the same index whether or not it is shared.
+template <typename Slots, typename Assigned>
+struct LocalSlotAccessors;
+
+/// \brief specialisation of the LocalSlotAccessors unpacking the slots
+template <typename... Slots, size_t... Assigned>
+struct LocalSlotAccessors<LocalSlots<Slots...>,
+                          tools::tuple::Index_list<Assigned...>> {
+  /// \brief returns the accessor of the slot of each tile
+  /// \param slots: the accessors of the slots
+  template <typename... Accessors>
+  static auto assign(const tools::tuple::Tuple<Accessors...> &slots)
+      -> decltype(tools::tuple::make_tuple(
+          tools::tuple::get<Assigned>(slots)...)) {
+    return tools::tuple::make_tuple(tools::tuple::get<Assigned>(slots)...);
+  }
+  /// \brief creates the slots and returns the accessor of each tile
+  /// \param cgh: the command group handler of the backend
+  template <typename Handler>
+  static auto getTuple(Handler &cgh) -> decltype(assign(
+      tools::tuple::make_tuple(typename LocalAccessor<
+                               Handler, typename Slots::Type, 1>::Type(
+          cl::sycl::range<1>(Slots::Count), cgh)...))) {
+    return assign(tools::tuple::make_tuple(
+        typename LocalAccessor<Handler, typename Slots::Type, 1>::Type(
+            cl::sycl::range<1>(Slots::Count), cgh)...));
   }
 };
 
 /// \brief create_local_accessors is a deduction function for creating local
 /// accessor.
 /// parameters:
-/// \param cgh: sycl command group handler
+/// \param cgh: the command group handler of the backend building the kernel
 /// \return Tuple
 
+template <size_t LC, size_t LR, typename Expr, typename Handler>
+inline auto create_local_accessors(Handler &cgh) -> decltype(
+    LocalSlotAccessors<typename LocalPlan<LC, LR, Expr>::Type,
+                       typename LocalPlan<LC, LR, Expr>::Slot>::getTuple(cgh)) {
+  return LocalSlotAccessors<typename LocalPlan<LC, LR, Expr>::Type,
+                            typename LocalPlan<LC, LR, Expr>::Slot>::
+      getTuple(cgh);
+}
+
+/// \brief local_memory_bytes returns the bytes of local memory created by
+/// create_local_accessors for the kernel of the expression, i.e. per
+/// work-group, with a local memory of LC x LR.
 template <size_t LC, size_t LR, typename Expr>
-inline auto create_local_accessors(cl::sycl::handler &cgh)
-    -> decltype(LocalOutput<Expr::Operation_type != ops_category::NeighbourOP,
-                            true, LC, LR, Expr>::getTuple(cgh)) {
-  return LocalOutput<Expr::Operation_type != ops_category::NeighbourOP, true,
-                     LC, LR, Expr>::getTuple(cgh);
+constexpr size_t local_memory_bytes() {
+  return LocalPlan<LC, LR, Expr>::Type::Bytes;
 }
+
+/// \brief the local memory every SYCL device, apart from the custom ones, is
+/// guaranteed to have, in bytes
+static constexpr size_t GuaranteedLocalMem = 32 * 1024;
+
+/// \struct LocalMemoryHalf
+/// \brief LocalMemoryHalf gives the next local memory size tried for a kernel
+/// whose LC x LR local memory does not fit the device: the larger of the two
+/// sizes is halved, so that it stays a multiple of the workgroup size.
+/// template parameters:
+/// \tparam LC: the column size of local memory which does not fit
+/// \tparam LR: the row size of local memory which does not fit
+template <size_t LC, size_t LR>
+struct LocalMemoryHalf {
+  static constexpr size_t Cols = LC >= LR ? LC / 2 : LC;
+  static constexpr size_t Rows = LC >= LR ? LR : LR / 2;
+};
 }  // internal
 }  // visioncpp
 #endif  // VISIONCPP_INCLUDE_FRAMEWORK_EXPR_CONVERTOR_LOCAL_OUTPUT_HPP_
\ No newline at end of file
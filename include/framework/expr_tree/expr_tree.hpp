@@ -42,6 +42,12 @@ struct GlobalUnaryOp {
   static constexpr size_t Operation_type =
       internal::ops_category::GlobalNeighbourOP;
 };
+/// \struct ZeroBorder
+/// \brief ZeroBorder is the default BorderValue of a neighbour operation. For
+/// border_type::Constant the pixel read outside of the image then has all of
+/// its channels zero. A user BorderValue is a functor taking no argument and
+/// returning the pixel read outside of the image instead.
+struct ZeroBorder {};
 /// \struct LocalUnaryOp
 /// \brief This class is used to encapsulate the local unary functor and the
 /// types of each operand in this functor. The functor passed to this struct
@@ -49,13 +55,21 @@ struct GlobalUnaryOp {
 /// template parameters:
 /// \tparam USROP : the user/built-in functor
 /// \tparam InTp the input type for that unary functor
-template <typename USROP, typename InTp>
+/// \tparam BorderType the visioncpp::border_type used to read the input
+/// outside of the image
+/// \tparam BorderValueOP the functor returning the pixel read outside of the
+/// image for border_type::Constant (see ZeroBorder)
+template <typename USROP, typename InTp,
+          size_t BorderType = border_type::Replicate,
+          typename BorderValueOP = ZeroBorder>
 struct LocalUnaryOp {
   using OP = USROP;
   using InType = InTp;
   visioncpp::internal::LocalNeighbour<InTp> x;
   using OutType = decltype(OP()(x));
   static constexpr size_t Operation_type = internal::ops_category::NeighbourOP;
+  static constexpr size_t Border = BorderType;
+  using BorderValue = BorderValueOP;
 };
 /// \struct LocalBinaryOp
 /// \brief This class is used to encapsulate the local binary functor and the
@@ -65,7 +79,13 @@ struct LocalUnaryOp {
 /// \tparam USROP : the user/built-in functor
 /// \tparam InTp1 the left hand side input type for the binary functor
 /// \tparam InTp2 the right hand side input type for the binary functor
-template <typename USROP, typename InTp1, typename InTp2>
+/// \tparam BorderType the visioncpp::border_type used to read the left hand
+/// side input outside of the image
+/// \tparam BorderValueOP the functor returning the pixel read outside of the
+/// image for border_type::Constant (see ZeroBorder)
+template <typename USROP, typename InTp1, typename InTp2,
+          size_t BorderType = border_type::Replicate,
+          typename BorderValueOP = ZeroBorder>
 struct LocalBinaryOp {
   using OP = USROP;
   using InType1 = InTp1;
@@ -74,6 +94,8 @@ struct LocalBinaryOp {
   visioncpp::internal::ConstNeighbour<InTp2> y;
   using OutType = decltype(OP()(x, y));
   static constexpr size_t Operation_type = internal::ops_category::NeighbourOP;
+  static constexpr size_t Border = BorderType;
+  using BorderValue = BorderValueOP;
 };
 /// \struct PixelUnaryOp
 /// \brief This class is used to encapsulate the unary point operation functor
@@ -106,6 +128,28 @@ struct PixelBinaryOp {
   InType2 y;
   using OutType = decltype(OP()(x, y));
 };
+/// \struct FusedBorder
+/// \brief FusedBorder is used to check whether a neighbour operation can be
+/// fused with its input. Outside of the image the fused input is computed from
+/// the border of its leaves rather than read with the border of the neighbour
+/// operation. The two only match for a leaf and for point operations under a
+/// border which remaps the coordinates. border_type::ReplicateFused is fused
+/// anyway, trading exact pixels near the edge of the image for fewer kernels.
+/// template parameters:
+/// \tparam Border the visioncpp::border_type of the neighbour operation
+/// \tparam Expr the input of the neighbour operation
+template <size_t Border, typename Expr>
+struct FusedBorder {
+  static constexpr bool Value =
+      (Border == border_type::ReplicateFused) ||
+      ((Border != border_type::Constant) &&
+       (Expr::Operation_type == internal::ops_category::PointOP));
+};
+/// \brief specialisation of FusedBorder when the input is a leaf
+template <size_t Border, typename RHS, size_t LVL>
+struct FusedBorder<Border, LeafNode<RHS, LVL>> {
+  static constexpr bool Value = true;
+};
 
 }  // internal
 }  // visioncpp
@@ -65,8 +65,12 @@ struct StnNoFilt {
   static constexpr size_t RThread = Rows;
   static constexpr size_t CThread = Cols;
   static constexpr size_t ND_Category = internal::expr_category::Unary;
+  static constexpr size_t Border = FilterOP::Border;
+  /// the input is executed on its own when fusing it changes the pixels read
+  /// outside of the image
+  static constexpr bool Border_Conds = !FusedBorder<Border, RHS>::Value;
   static constexpr bool Stencil_Conds =
-      ((RThread != RHS::RThread) || (CThread != RHS::CThread));
+      ((RThread != RHS::RThread) || (CThread != RHS::CThread)) || Border_Conds;
   static constexpr bool SubExpressionEvaluationNeeded =
       Stencil_Conds || RHS::SubExpressionEvaluationNeeded;
   template <typename TmpRHS>
@@ -147,5 +151,24 @@ auto neighbour_operation(RHS rhs)
                              RHS::Type::Cols, RHS::Type::Rows,
                              RHS::Type::LeafType, 1 + RHS::Level>(rhs);
 }
+
+/// \brief template deduction for StnNoFilt class when the memory type of the
+/// output and column and row are automatically deduced from the input. The
+/// halos, the visioncpp::border_type and its BorderValue are defined by user.
+/// Under the Fuse policy, only border_type::ReplicateFused fuses a neighbour
+/// operation input, which can change the pixels near the edge (see
+/// neighbour_operation in stencil_with_filter.hpp).
+template <typename OP, size_t Halo_T, size_t Halo_L, size_t Halo_B,
+          size_t Halo_R, size_t Border,
+          typename BorderValue = internal::ZeroBorder, typename RHS>
+auto neighbour_operation(RHS rhs) -> internal::StnNoFilt<
+    internal::LocalUnaryOp<OP, typename RHS::OutType, Border, BorderValue>,
+    Halo_T, Halo_L, Halo_B, Halo_R, RHS, RHS::Type::Cols, RHS::Type::Rows,
+    RHS::Type::LeafType, 1 + RHS::Level> {
+  return internal::StnNoFilt<
+      internal::LocalUnaryOp<OP, typename RHS::OutType, Border, BorderValue>,
+      Halo_T, Halo_L, Halo_B, Halo_R, RHS, RHS::Type::Cols, RHS::Type::Rows,
+      RHS::Type::LeafType, 1 + RHS::Level>(rhs);
+}
 }  // visioncpp
 #endif  // VISIONCPP_INCLUDE_FRAMEWORK_EXPR_TREE_NEIGHBOUR_OPS_STENCIL_NO_FILTER_HPP_
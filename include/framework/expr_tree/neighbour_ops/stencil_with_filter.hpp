@@ -65,8 +65,12 @@ struct StnFilt {
   static constexpr size_t RThread = Rows;
   static constexpr size_t CThread = Cols;
   static constexpr size_t ND_Category = internal::expr_category::Binary;
+  static constexpr size_t Border = Conv_OP::Border;
+  /// the input is executed on its own when fusing it changes the pixels read
+  /// outside of the image
+  static constexpr bool Border_Conds = !FusedBorder<Border, LHS>::Value;
   static constexpr bool Stencil_Conds =
-      ((RThread != LHS::RThread) || (CThread != LHS::CThread));
+      ((RThread != LHS::RThread) || (CThread != LHS::CThread)) || Border_Conds;
   static constexpr bool SubExpressionEvaluationNeeded =
       Stencil_Conds || LHS::SubExpressionEvaluationNeeded ||
       RHS::SubExpressionEvaluationNeeded;
@@ -202,5 +206,58 @@ auto neighbour_operation(LHS lhs, RHS rhs) -> internal::StnFilt<
       1 + internal::tools::StaticIf<(LHS::Level > RHS::Level), LHS,
                                     RHS>::Type::Level>(lhs, rhs);
 }
+
+/// \brief template deduction for StnFilt class when the memory type of the
+/// output and column and row are automatically deduced from the input and the
+/// halos from the filter. The visioncpp::border_type is defined by user, and
+/// for border_type::Constant the BorderValue functor returns the pixel read
+/// outside of the image (see internal::ZeroBorder). Under the Fuse policy, a
+/// neighbour operation whose input is another neighbour operation runs the
+/// input in a separate kernel, so the result matches OpenCV, unless the border
+/// is border_type::ReplicateFused.
+template <typename OP, size_t Border,
+          typename BorderValue = internal::ZeroBorder, typename LHS,
+          typename RHS>
+auto neighbour_operation(LHS lhs, RHS rhs) -> internal::StnFilt<
+    internal::LocalBinaryOp<OP, typename LHS::OutType, typename RHS::OutType,
+                            Border, BorderValue>,
+    RHS::Type::Rows / 2, RHS::Type::Cols / 2, RHS::Type::Rows / 2,
+    RHS::Type::Cols / 2, LHS, RHS, LHS::Type::Cols, LHS::Type::Rows,
+    LHS::Type::LeafType,
+    1 + internal::tools::StaticIf<(LHS::Level > RHS::Level), LHS,
+                                  RHS>::Type::Level> {
+  return internal::StnFilt<
+      internal::LocalBinaryOp<OP, typename LHS::OutType, typename RHS::OutType,
+                              Border, BorderValue>,
+      RHS::Type::Rows / 2, RHS::Type::Cols / 2, RHS::Type::Rows / 2,
+      RHS::Type::Cols / 2, LHS, RHS, LHS::Type::Cols, LHS::Type::Rows,
+      LHS::Type::LeafType,
+      1 + internal::tools::StaticIf<(LHS::Level > RHS::Level), LHS,
+                                    RHS>::Type::Level>(lhs, rhs);
+}
+
+/// \brief template deduction for StnFilt class when the memory type of the
+/// output and column and row are automatically deduced from the input. The
+/// halos, the visioncpp::border_type and its BorderValue are defined by user.
+/// See above for the fusion of border_type::ReplicateFused.
+template <typename OP, size_t Halo_T, size_t Halo_L, size_t Halo_B,
+          size_t Halo_R, size_t Border,
+          typename BorderValue = internal::ZeroBorder, typename LHS,
+          typename RHS>
+auto neighbour_operation(LHS lhs, RHS rhs) -> internal::StnFilt<
+    internal::LocalBinaryOp<OP, typename LHS::OutType, typename RHS::OutType,
+                            Border, BorderValue>,
+    Halo_T, Halo_L, Halo_B, Halo_R, LHS, RHS, LHS::Type::Cols, LHS::Type::Rows,
+    LHS::Type::LeafType,
+    1 + internal::tools::StaticIf<(LHS::Level > RHS::Level), LHS,
+                                  RHS>::Type::Level> {
+  return internal::StnFilt<
+      internal::LocalBinaryOp<OP, typename LHS::OutType, typename RHS::OutType,
+                              Border, BorderValue>,
+      Halo_T, Halo_L, Halo_B, Halo_R, LHS, RHS, LHS::Type::Cols,
+      LHS::Type::Rows, LHS::Type::LeafType,
+      1 + internal::tools::StaticIf<(LHS::Level > RHS::Level), LHS,
+                                    RHS>::Type::Level>(lhs, rhs);
+}
 }  // visioncpp
 #endif  // VISIONCPP_INCLUDE_FRAMEWORK_EXPR_TREE_NEIGHBOUR_OPS_STENCIL_WITH_FILTER_HPP_
@@ -24,6 +24,8 @@
 #ifndef VISIONCPP_INCLUDE_FRAMEWORK_EXPR_TREE_POINT_OPS_LEAF_NODE_HPP_
 #define VISIONCPP_INCLUDE_FRAMEWORK_EXPR_TREE_POINT_OPS_LEAF_NODE_HPP_
 
+#include <stdexcept>
+
 namespace visioncpp {
 namespace internal {
 /// \struct LeafNode
@@ -58,7 +60,10 @@ struct LeafNode {
   bool subexpr_execution_reseter;
   LeafNode(typename RHS::syclBuffer dt) : LeafNode(RHS(dt)) {}
 
-  void reset(bool reset) { subexpr_execution_reseter = reset; }
+  void reset(bool reset) {
+    vilibMemory.reset(reset);
+    subexpr_execution_reseter = reset;
+  }
 
   /// sub_expression_evaluation
   /// \brief This function is used to break the expression tree whenever
@@ -103,6 +108,23 @@ struct LeafNode {
   /// \return void
   inline void reset_input(Scalar *dt) { vilibMemory.reset_input(dt); }
 
+  /// \brief reset_input for an image whose size is only known at runtime
+  /// \return void
+  inline void reset_input(Scalar *dt, size_t cols, size_t rows) {
+    vilibMemory.reset_input(dt, cols, rows);
+  }
+
+  /// \brief read_output is used to copy the value of the node to a host
+  /// pointer without destroying the sycl buffer.
+  /// \return void
+  inline void read_output(Scalar *dt) { vilibMemory.read_output(dt); }
+
+  /// \brief read_output for an image whose size is only known at runtime
+  /// \return void
+  inline void read_output(Scalar *dt, size_t cols, size_t rows) {
+    vilibMemory.read_output(dt, cols, rows);
+  }
+
   /// \brief lock function is used to access the sycl buffer on the host using
   /// a host pointer. Because the host accessor is blocking. We are creating it
   /// dynamically so by calling the lock function. It is the responsibility of
@@ -165,6 +187,53 @@ auto terminal() -> internal::LeafNode<
       ElemTp, internal::MemoryProperties<ElemTp>::ChannelSize, Sc, 0>());
 }
 
+/// \brief creation of the terminal of a batch of frames executed by
+/// execute_batch. The frames of Cols x Rows are one after the other in dt.
+/// \param dt: the host memory of the frames
+/// \param frames: the number of frames
+template <typename ElemTp, size_t Cols, size_t Rows, size_t MemoryType,
+          size_t Sc = scope::Global>
+auto terminal(typename internal::MemoryProperties<ElemTp>::ChannelType *dt,
+              size_t frames)
+    -> decltype(terminal<ElemTp, Cols, Rows, MemoryType, Sc>(dt)) {
+  using Leaf = decltype(terminal<ElemTp, Cols, Rows, MemoryType, Sc>(dt));
+  return Leaf(typename Leaf::RHSExpr(dt, frames));
+}
+
+/// \brief creation of the terminal of a Pitched2D memory whose rows are pitch
+/// elements apart in dt, e.g. the data of a sub-image of a larger cv::Mat or a
+/// camera frame with padded rows. The rows are processed on a copy of dt, and
+/// only the elements of the rows are written back, so that the side by side
+/// sub-images of an image can be processed at the same time.
+/// \param dt: the first element of the first row
+/// \param frames: the number of frames, each of them Rows rows after the
+/// previous one
+/// \param pitch: the number of elements from a row to the next one
+template <typename ElemTp, size_t Cols, size_t Rows, size_t MemoryType,
+          size_t Sc = scope::Global>
+auto terminal(typename internal::MemoryProperties<ElemTp>::ChannelType *dt,
+              size_t frames, size_t pitch)
+    -> decltype(terminal<ElemTp, Cols, Rows, MemoryType, Sc>(dt)) {
+  static_assert(MemoryType == memory_type::Pitched2D,
+                "Only a Pitched2D memory has a row pitch");
+  if (pitch < Cols) {
+    throw std::invalid_argument("The row pitch is smaller than the row");
+  }
+  using Leaf = decltype(terminal<ElemTp, Cols, Rows, MemoryType, Sc>(dt));
+  return Leaf(typename Leaf::RHSExpr(dt, frames, pitch));
+}
+
+/// \brief creation of the device only memory of a batch of frames executed by
+/// execute_batch
+/// \param frames: the number of frames
+template <typename ElemTp, size_t Cols, size_t Rows, size_t MemoryType,
+          size_t Sc = scope::Global>
+auto terminal(size_t frames)
+    -> decltype(terminal<ElemTp, Cols, Rows, MemoryType, Sc>()) {
+  using Leaf = decltype(terminal<ElemTp, Cols, Rows, MemoryType, Sc>());
+  return Leaf(typename Leaf::RHSExpr(frames));
+}
+
 /// \brief template deduction of LeafNode where the memory_type is a constant
 /// variable and element_category is Struct
 template <typename ElemTp, size_t LeafType>
@@ -23,6 +23,21 @@
 #ifndef VISIONCPP_INCLUDE_FRAMEWORK_FORWARD_DECLARATIONS_HPP_
 #define VISIONCPP_INCLUDE_FRAMEWORK_FORWARD_DECLARATIONS_HPP_
 
+/// \brief VISIONCPP_SYCL_121 is 1 when the SYCL implementation provides the
+/// SYCL 1.2.1 properties and allocators: the profiling of the queue and the
+/// buffers used in place on a host memory. With a SYCL 1.2 implementation the
+/// buffers work on a copy of the host memory and the kernels are timed on the
+/// host. It can be defined on the command line to override the detection.
+#ifndef VISIONCPP_SYCL_121
+#if defined(CL_SYCL_LANGUAGE_VERSION) && CL_SYCL_LANGUAGE_VERSION >= 121
+#define VISIONCPP_SYCL_121 1
+#elif defined(SYCL_LANGUAGE_VERSION)
+#define VISIONCPP_SYCL_121 1
+#else
+#define VISIONCPP_SYCL_121 0
+#endif
+#endif
+
 /// \brief VisionCpp namespace
 namespace visioncpp {
 /// \brief Scope is used to define the scope of the memory on the device
@@ -41,12 +56,47 @@ static constexpr size_t Buffer1D = 1;
 static constexpr size_t Buffer2D = 2;
 static constexpr size_t Image = 3;
 static constexpr size_t Const = 4;
+/// a 2d buffer whose rows are a runtime row pitch apart, e.g. a sub-image of
+/// a larger image or a camera frame with padded rows
+static constexpr size_t Pitched2D = 5;
+/// a 2d buffer holding each channel of the pixels in its own plane
+static constexpr size_t Planar2D = 6;
+}
+
+/// \brief defines how a neighbour operation reads the pixels outside of the
+/// image. The patterns below show the row abcdefgh with three pixels read
+/// outside of it on each side, as in the OpenCV BORDER_* modes.
+namespace border_type {
+/// aaa|abcdefgh|hhh
+static constexpr size_t Replicate = 0;
+/// dcb|abcdefgh|gfe
+static constexpr size_t Reflect101 = 1;
+/// fgh|abcdefgh|abc
+static constexpr size_t Wrap = 2;
+/// 000|abcdefgh|000, where 0 is the pixel returned by the BorderValue of the
+/// neighbour operation, zero by default
+static constexpr size_t Constant = 3;
+/// aaa|abcdefgh|hhh as Replicate, but under the Fuse policy a neighbour
+/// operation is fused with a neighbour operation input. The input is then
+/// computed outside of the image from the replicated border of its own input
+/// instead of being replicated itself, so the pixels within the sum of the
+/// halos from the edge differ from OpenCV. It saves the kernel and the global
+/// memory of the input.
+static constexpr size_t ReplicateFused = 4;
 }
 
 /// \brief defines Executor policies available
 namespace policy {
-constexpr static bool Fuse = true;
-constexpr static bool NoFuse = false;
+using PolicyType = size_t;
+/// one kernel per node of the expression
+constexpr static PolicyType NoFuse = 0;
+/// one kernel for the whole expression, except where the sizes of the nodes
+/// require breaking it
+constexpr static PolicyType Fuse = 1;
+/// like Fuse, but the expression is broken wherever the cost model of the
+/// auto scheduler estimates that recomputing the halos of nested neighbour
+/// operations costs more than storing the intermediate result
+constexpr static PolicyType Auto = 2;
 }
 
 /// \class backend
@@ -54,6 +104,9 @@ constexpr static bool NoFuse = false;
 enum class backend {
   /// represents sycl backend.
   sycl,
+  /// represents the native multithreaded cpu backend. It needs no OpenCL
+  /// device, but its memories are still SYCL buffers.
+  threads,
   /// number of backends.
   size
 };
@@ -80,6 +133,17 @@ namespace internal {
 /// \tparam  DV is used to determine the selected device for that backend
 template <backend BK, device DV>
 class Device_;
+/// \class Event_
+/// class used as a waitable handle on an expression run by execute_async.
+/// \tparam BK is used to determine the backend
+template <backend BK>
+class Event_;
+/// \class ExtentDevice
+/// class used to execute an expression with a runtime image size.
+/// \tparam DeviceT is the wrapped device
+/// \tparam Extent is the runtime size of the images
+template <typename DeviceT, typename Extent>
+class ExtentDevice;
 }
 
 /// \brief template deduction function for Device_ class
@@ -91,11 +155,11 @@ internal::Device_<BK, DV> make_device() {
   return internal::Device_<BK, DV>();
 }
 
-template <bool ExecPolicy, typename Expr, typename DeviceT>
+template <policy::PolicyType ExecPolicy, typename Expr, typename DeviceT>
 void execute(Expr &, DeviceT &);
 
-template <bool ExecPolicy, size_t LC, size_t LR, size_t LCT, size_t LRT,
-          typename Expr, typename DeviceT>
+template <policy::PolicyType ExecPolicy, size_t LC, size_t LR, size_t LCT,
+          size_t LRT, typename Expr, typename DeviceT>
 void execute(Expr &, const DeviceT &);
 
 namespace internal {
@@ -115,8 +179,8 @@ constexpr static size_t GlobalNeighbourOP = 2;
 };
 
 /// \brief the definition is in \ref VirtualMemory
-template <bool PlcType, typename Node, size_t LC = 8, size_t LR = 8,
-          size_t LCT = 8, size_t LRT = 8>
+template <policy::PolicyType PlcType, typename Node, size_t LC = 8,
+          size_t LR = 8, size_t LCT = 8, size_t LRT = 8>
 struct VirtualMemory;
 
 /// \brief the definition is in \ref LeafNode.
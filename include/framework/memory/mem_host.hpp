@@ -0,0 +1,108 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file mem_host.hpp
+/// \brief This file contains the AlignedAllocator used to allocate the host
+/// memories shared by the buffers with the cpu and host devices.
+
+#ifndef VISIONCPP_INCLUDE_FRAMEWORK_MEMORY_MEM_HOST_HPP_
+#define VISIONCPP_INCLUDE_FRAMEWORK_MEMORY_MEM_HOST_HPP_
+
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <new>
+
+namespace visioncpp {
+/// \brief the default alignment of the AlignedAllocator, in bytes. It is the
+/// size of a page, which the OpenCL cpu drivers require to use a host memory
+/// without copying it.
+constexpr size_t HostMemAlignment = 4096;
+
+/// \class AlignedAllocator
+/// \brief AlignedAllocator is a standard allocator returning memories aligned
+/// to Align bytes. A buffer created on such a memory, e.g. the data of a
+/// cv::Mat or of a std::vector using the allocator, is used in place by the
+/// cpu and host devices. With a memory which is not aligned the driver may
+/// still make a copy of it.
+/// template parameters:
+/// \tparam T: the type of the elements of the memory
+/// \tparam Align: the alignment of the memory in bytes, a power of two
+template <typename T, size_t Align = HostMemAlignment>
+class AlignedAllocator {
+  static_assert(Align >= sizeof(void *) && (Align & (Align - 1)) == 0,
+                "The alignment must be a power of two holding a pointer");
+
+ public:
+  using value_type = T;
+  template <typename U>
+  struct rebind {
+    using other = AlignedAllocator<U, Align>;
+  };
+
+  AlignedAllocator() = default;
+  template <typename U>
+  AlignedAllocator(const AlignedAllocator<U, Align> &) {}
+
+  /// \brief allocates n elements. The address returned by malloc is kept just
+  /// before the aligned memory so that deallocate can release it.
+  T *allocate(size_t n) {
+    void *raw = std::malloc(n * sizeof(T) + Align);
+    if (!raw) {
+      throw std::bad_alloc();
+    }
+    auto aligned =
+        (reinterpret_cast<std::uintptr_t>(raw) + Align) & ~(Align - 1);
+    reinterpret_cast<void **>(aligned)[-1] = raw;
+    return reinterpret_cast<T *>(aligned);
+  }
+
+  void deallocate(T *p, size_t) {
+    if (p) {
+      std::free(reinterpret_cast<void **>(p)[-1]);
+    }
+  }
+};
+
+template <typename T, typename U, size_t Align>
+bool operator==(const AlignedAllocator<T, Align> &,
+                const AlignedAllocator<U, Align> &) {
+  return true;
+}
+
+template <typename T, typename U, size_t Align>
+bool operator!=(const AlignedAllocator<T, Align> &,
+                const AlignedAllocator<U, Align> &) {
+  return false;
+}
+
+/// \brief allocates an aligned host memory of n elements which is released
+/// with the last copy of the returned pointer. It can be given to set_output
+/// so that the result of a device only memory is written to it in place.
+/// \param n: the number of elements of the memory
+/// \return std::shared_ptr<T>
+template <typename T, size_t Align = HostMemAlignment>
+std::shared_ptr<T> make_aligned_host(size_t n) {
+  AlignedAllocator<T, Align> alloc;
+  return std::shared_ptr<T>(alloc.allocate(n), [n](T *p) {
+    AlignedAllocator<T, Align>().deallocate(p, n);
+  });
+}
+}  // visioncpp
+#endif  // VISIONCPP_INCLUDE_FRAMEWORK_MEMORY_MEM_HOST_HPP_
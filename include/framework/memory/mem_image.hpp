@@ -0,0 +1,293 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file mem_image.hpp
+/// \brief This file contains the image format of the pixel types and the
+/// ImageAccessor used by the evaluators to read and write an Image memory
+/// through samplers.
+
+#ifndef VISIONCPP_INCLUDE_FRAMEWORK_MEMORY_MEM_IMAGE_HPP_
+#define VISIONCPP_INCLUDE_FRAMEWORK_MEMORY_MEM_IMAGE_HPP_
+
+#include <type_traits>
+
+namespace visioncpp {
+namespace internal {
+/// \struct ImageChannel
+/// \brief ImageChannel gives the image channel type storing a channel of the
+/// given scalar type. The channels are read from the image as floats.
+/// template parameters:
+/// \tparam Scalar: the type of each channel of the pixel
+template <typename Scalar>
+struct ImageChannel {
+  static constexpr bool Supported = false;
+  static constexpr cl::sycl::image_channel_type type =
+      cl::sycl::image_channel_type::fp32;
+};
+
+/// \brief specialisation of the ImageChannel when the channel is float
+template <>
+struct ImageChannel<float> {
+  static constexpr bool Supported = true;
+  static constexpr cl::sycl::image_channel_type type =
+      cl::sycl::image_channel_type::fp32;
+  static inline float to_float(float v) { return v; }
+  static inline float from_float(float v) { return v; }
+};
+
+/// \brief specialisation of the ImageChannel when the channel is unsigned
+/// char. The channel is normalised to [0, 1] by the image, so that the image
+/// can be read with linear filtering.
+template <>
+struct ImageChannel<unsigned char> {
+  static constexpr bool Supported = true;
+  static constexpr cl::sycl::image_channel_type type =
+      cl::sycl::image_channel_type::unorm_int8;
+  static inline float to_float(unsigned char v) { return v / 255.0f; }
+  static inline unsigned char from_float(float v) {
+    return static_cast<unsigned char>(
+        cl::sycl::clamp(v * 255.0f + 0.5f, 0.0f, 255.0f));
+  }
+};
+
+/// \brief specialisation of the ImageChannel when the channel is
+/// cl::sycl::half
+template <>
+struct ImageChannel<cl::sycl::half> {
+  static constexpr bool Supported = true;
+  static constexpr cl::sycl::image_channel_type type =
+      cl::sycl::image_channel_type::fp16;
+  static inline float to_float(cl::sycl::half v) {
+    return static_cast<float>(v);
+  }
+  static inline cl::sycl::half from_float(float v) {
+    return static_cast<cl::sycl::half>(v);
+  }
+};
+
+/// \brief specialisation of the ImageChannel when the channel is unsigned
+/// short. The channel is normalised to [0, 1] by the image.
+template <>
+struct ImageChannel<unsigned short> {
+  static constexpr bool Supported = true;
+  static constexpr cl::sycl::image_channel_type type =
+      cl::sycl::image_channel_type::unorm_int16;
+  static inline float to_float(unsigned short v) { return v / 65535.0f; }
+  static inline unsigned short from_float(float v) {
+    return static_cast<unsigned short>(
+        cl::sycl::clamp(v * 65535.0f + 0.5f, 0.0f, 65535.0f));
+  }
+};
+
+/// \struct ImageOrder
+/// \brief ImageOrder gives the image channel order of a pixel with the given
+/// number of channels. There is no image format for the three channel pixels.
+/// template parameters:
+/// \tparam Channels: the number of channels of the pixel
+template <size_t Channels>
+struct ImageOrder {
+  static constexpr bool Supported = false;
+  static constexpr cl::sycl::image_channel_order order =
+      cl::sycl::image_channel_order::rgba;
+};
+
+/// \brief specialisation of the ImageOrder for one channel pixels
+template <>
+struct ImageOrder<1> {
+  static constexpr bool Supported = true;
+  static constexpr cl::sycl::image_channel_order order =
+      cl::sycl::image_channel_order::r;
+};
+
+/// \brief specialisation of the ImageOrder for two channel pixels
+template <>
+struct ImageOrder<2> {
+  static constexpr bool Supported = true;
+  static constexpr cl::sycl::image_channel_order order =
+      cl::sycl::image_channel_order::rg;
+};
+
+/// \brief specialisation of the ImageOrder for four channel pixels
+template <>
+struct ImageOrder<4> {
+  static constexpr bool Supported = true;
+  static constexpr cl::sycl::image_channel_order order =
+      cl::sycl::image_channel_order::rgba;
+};
+
+/// function pixel_channel
+/// \brief returns the channel i of a pixel. A basic type has a single channel.
+template <typename T>
+static inline typename std::enable_if<
+    MemoryProperties<T>::ElementCategory == element_category::Basic, T &>::type
+pixel_channel(T &t, size_t) {
+  return t;
+}
+/// \brief returns the channel i of a pixel of struct type (e.g. F32C4)
+template <typename T>
+static inline typename std::enable_if<
+    MemoryProperties<T>::ElementCategory == element_category::Struct,
+    typename T::data_type &>::type
+pixel_channel(T &t, size_t i) {
+  return t[i];
+}
+
+/// \struct ImageProperties
+/// \brief ImageProperties gives the format of the image storing a pixel type
+/// and converts the pixels to and from the float4 read and written by the
+/// image accessors. The pixels made of 1, 2 or 4 float, half, unsigned char
+/// or unsigned short channels can be stored in an image.
+/// template parameters:
+/// \tparam T: the pixel type
+/// \tparam Scalar: the type of each channel of the pixel
+template <typename T, typename Scalar>
+struct ImageProperties {
+  using Channel = ImageChannel<Scalar>;
+  static constexpr size_t Channels = MemoryProperties<T>::ChannelSize;
+  static constexpr bool Supported =
+      Channel::Supported && ImageOrder<Channels>::Supported;
+  static constexpr cl::sycl::image_channel_order channel_order =
+      ImageOrder<Channels>::order;
+  static constexpr cl::sycl::image_channel_type channel_type = Channel::type;
+  using access_type = cl::sycl::float4;
+
+  /// \brief converts a pixel to the texel written to the image
+  static inline access_type to_access(T t) {
+    float v[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+    for (size_t i = 0; i < Channels; i++) {
+      v[i] = Channel::to_float(pixel_channel(t, i));
+    }
+    return access_type(v[0], v[1], v[2], v[3]);
+  }
+
+  /// \brief converts a texel read from the image to a pixel
+  static inline T from_access(const access_type &a) {
+    const float v[4] = {a.x(), a.y(), a.z(), a.w()};
+    T t;
+    for (size_t i = 0; i < Channels; i++) {
+      pixel_channel(t, i) = Channel::from_float(v[i]);
+    }
+    return t;
+  }
+};
+
+template <typename Acc, typename T>
+struct ImageAccessor;
+
+/// \struct ImageTexel
+/// \brief ImageTexel stands for an element of an image in the evaluators,
+/// which index the memories through their pointer. Reading it samples the
+/// image and assigning to it writes the image.
+/// template parameters:
+/// \tparam Acc: the accessor on the image
+/// \tparam T: the pixel type
+template <typename Acc, typename T>
+struct ImageTexel {
+  ImageAccessor<Acc, T> img;
+  int c;
+  int r;
+  ImageTexel(const ImageAccessor<Acc, T> &imgArg, int cArg, int rArg)
+      : img(imgArg), c(cArg), r(rArg) {}
+  inline operator T() const { return img.read(c, r); }
+  inline const ImageTexel &operator=(const T &v) const {
+    img.write(c, r, v);
+    return *this;
+  }
+  /// copies the pixel of another texel rather than the texel itself
+  inline const ImageTexel &operator=(const ImageTexel &t) const {
+    return (*this = static_cast<T>(t));
+  }
+};
+
+/// \struct ImagePointer
+/// \brief ImagePointer is returned by the get_pointer of an ImageAccessor. It
+/// maps the index of an element in a memory of width columns to its texel, so
+/// the evaluators index an image as they index a buffer. When the expression
+/// is executed with the compile-time size, the index of the pixel (c, r)
+/// selects the texel (c, r).
+/// template parameters:
+/// \tparam Acc: the accessor on the image
+/// \tparam T: the pixel type
+template <typename Acc, typename T>
+struct ImagePointer {
+  ImageAccessor<Acc, T> img;
+  explicit ImagePointer(const ImageAccessor<Acc, T> &imgArg) : img(imgArg) {}
+  inline ImageTexel<Acc, T> operator[](size_t i) const {
+    return ImageTexel<Acc, T>(img, static_cast<int>(i % img.width),
+                              static_cast<int>(i / img.width));
+  }
+};
+
+/// \struct ImageAccessor
+/// \brief ImageAccessor is the accessor of an Image memory used by the
+/// evaluators. The texels are read through a sampler, which clamps the
+/// coordinates to the edge of the image, and written through the accessor.
+/// The frames of a batch are stored one below the other in the image.
+/// template parameters:
+/// \tparam Acc: the image accessor of the memory
+/// \tparam T: the pixel type of the memory
+template <typename Acc, typename T>
+struct ImageAccessor {
+  using value_type = T;
+  using Properties =
+      ImageProperties<T, typename MemoryProperties<T>::ChannelType>;
+  Acc acc;
+  /// the column size of the image
+  size_t width;
+  ImageAccessor(Acc accArg, size_t widthArg) : acc(accArg), width(widthArg) {}
+
+  /// \brief returns the pointer used by the evaluators to index the image
+  inline ImagePointer<Acc, T> get_pointer() const {
+    return ImagePointer<Acc, T>(*this);
+  }
+
+  /// \brief reads the pixel (c, r). The coordinates outside of the image are
+  /// clamped to its edge by the sampler.
+  inline T read(int c, int r) const {
+    return Properties::from_access(acc.read(
+        cl::sycl::int2(c, r),
+        cl::sycl::sampler(cl::sycl::coordinate_normalization_mode::unnormalized,
+                          cl::sycl::addressing_mode::clamp_edge,
+                          cl::sycl::filtering_mode::nearest)));
+  }
+
+  /// \brief writes the pixel (c, r)
+  inline void write(int c, int r, const T &v) const {
+    acc.write(cl::sycl::int2(c, r), Properties::to_access(v));
+  }
+
+  /// \brief reads the image at the position (x, y) with linear filtering,
+  /// where (c, r) is the position of the pixel (c, r). By default the
+  /// positions outside of the image take the value of its edge; with
+  /// addressing_mode::clamp they are blended with a zero border.
+  /// template parameters:
+  /// \tparam Addressing: the addressing mode of the sampler
+  template <cl::sycl::addressing_mode Addressing =
+                cl::sycl::addressing_mode::clamp_edge>
+  inline T sample(float x, float y) const {
+    return Properties::from_access(acc.read(
+        cl::sycl::float2(x + 0.5f, y + 0.5f),
+        cl::sycl::sampler(cl::sycl::coordinate_normalization_mode::unnormalized,
+                          Addressing, cl::sycl::filtering_mode::linear)));
+  }
+};
+
+}  // internal
+}  // visioncpp
+#endif  // VISIONCPP_INCLUDE_FRAMEWORK_MEMORY_MEM_IMAGE_HPP_
@@ -0,0 +1,107 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file mem_planar.hpp
+/// \brief This file contains the PlanarAccessor used by the evaluators to
+/// access a Planar2D memory, which stores each channel of the pixels in its
+/// own plane.
+
+#ifndef VISIONCPP_INCLUDE_FRAMEWORK_MEMORY_MEM_PLANAR_HPP_
+#define VISIONCPP_INCLUDE_FRAMEWORK_MEMORY_MEM_PLANAR_HPP_
+
+namespace visioncpp {
+namespace internal {
+/// \struct PlanarTexel
+/// \brief PlanarTexel stands for a pixel of a Planar2D memory in the
+/// evaluators. Reading it gathers the channels of the pixel from the planes
+/// and assigning to it scatters them, so that the neighbouring work-items
+/// access each plane with unit stride.
+/// template parameters:
+/// \tparam Ptr: the pointer on the channels of the memory
+/// \tparam T: the pixel type
+template <typename Ptr, typename T>
+struct PlanarTexel {
+  static constexpr size_t Channels = MemoryProperties<T>::ChannelSize;
+  Ptr ptr;
+  /// the index of the pixel in the first plane
+  size_t i;
+  /// the number of channels from a plane to the next one
+  size_t plane;
+  PlanarTexel(Ptr ptrArg, size_t iArg, size_t planeArg)
+      : ptr(ptrArg), i(iArg), plane(planeArg) {}
+  inline operator T() const {
+    T t;
+    for (size_t k = 0; k < Channels; k++) {
+      pixel_channel(t, k) = ptr[i + k * plane];
+    }
+    return t;
+  }
+  inline const PlanarTexel &operator=(T t) const {
+    for (size_t k = 0; k < Channels; k++) {
+      ptr[i + k * plane] = pixel_channel(t, k);
+    }
+    return *this;
+  }
+  /// copies the pixel of another texel rather than the texel itself
+  inline const PlanarTexel &operator=(const PlanarTexel &t) const {
+    return (*this = static_cast<T>(t));
+  }
+};
+
+/// \struct PlanarPointer
+/// \brief PlanarPointer is returned by the get_pointer of a PlanarAccessor.
+/// Its element i is the pixel i of the memory, so the evaluators index a
+/// Planar2D memory as they index an interleaved one.
+/// template parameters:
+/// \tparam Ptr: the pointer on the channels of the memory
+/// \tparam T: the pixel type
+template <typename Ptr, typename T>
+struct PlanarPointer {
+  Ptr ptr;
+  size_t plane;
+  PlanarPointer(Ptr ptrArg, size_t planeArg) : ptr(ptrArg), plane(planeArg) {}
+  inline PlanarTexel<Ptr, T> operator[](size_t i) const {
+    return PlanarTexel<Ptr, T>(ptr, i, plane);
+  }
+};
+
+/// \struct PlanarAccessor
+/// \brief PlanarAccessor is the accessor of a Planar2D memory used by the
+/// evaluators. The memory holds Channels planes of plane channels one after
+/// the other; the frames of a batch are one after the other in each plane.
+/// template parameters:
+/// \tparam Acc: the accessor on the channels of the memory
+/// \tparam T: the pixel type
+template <typename Acc, typename T>
+struct PlanarAccessor {
+  using value_type = T;
+  Acc acc;
+  /// the number of channels from a plane to the next one
+  size_t plane;
+  PlanarAccessor(Acc accArg, size_t planeArg) : acc(accArg), plane(planeArg) {}
+  /// \brief returns the pointer used by the evaluators to index the pixels
+  inline auto get_pointer() const
+      -> PlanarPointer<decltype(acc.get_pointer()), T> {
+    return PlanarPointer<decltype(acc.get_pointer()), T>(acc.get_pointer(),
+                                                         plane);
+  }
+};
+}  // internal
+}  // visioncpp
+#endif  // VISIONCPP_INCLUDE_FRAMEWORK_MEMORY_MEM_PLANAR_HPP_
@@ -0,0 +1,117 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file mem_pool.hpp
+/// \brief This file contains the BufferPool used to reuse the device only
+/// memories holding the intermediate results of an expression.
+
+#ifndef VISIONCPP_INCLUDE_FRAMEWORK_MEMORY_MEM_POOL_HPP_
+#define VISIONCPP_INCLUDE_FRAMEWORK_MEMORY_MEM_POOL_HPP_
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace visioncpp {
+namespace internal {
+/// \class BufferPool
+/// \brief BufferPool keeps the device only memories created for the
+/// intermediate results of the NoFuse policy and of the kernel breaks. A
+/// memory is in use as long as a node of an expression holds it, and it is
+/// given to the next intermediate result of the same type and size once all
+/// those nodes are gone. The kernels are submitted in order, so a kernel
+/// writing a reused memory runs after the kernels reading it. An expression
+/// of N nodes therefore needs as many memories as results alive at the same
+/// time, e.g. two for a chain of nodes. The pool is owned by the device and
+/// kept between executions.
+class BufferPool {
+  struct Entry {
+    const void *key;
+    size_t frames;
+    std::shared_ptr<void> buffer;
+  };
+  std::vector<Entry> entries;
+  std::mutex mtx;
+
+  template <typename Buffer, size_t LeafType, size_t Cols, size_t Rows>
+  static const void *key() {
+    static const char id = 0;
+    return &id;
+  }
+
+ public:
+  /// \brief returns a free memory with the type and size of Memory, creating
+  /// it when all of them are in use.
+  /// template parameters:
+  /// \tparam Memory: the VisionMemory type of the intermediate result
+  /// function parameters:
+  /// \param frames: the number of frames held by the memory
+  /// \return std::shared_ptr<Memory::syclBuffer>
+  template <typename Memory>
+  std::shared_ptr<typename Memory::syclBuffer> acquire(size_t frames = 1) {
+    using Buffer = typename Memory::syclBuffer;
+    const void *k = key<Buffer, Memory::LeafType, Memory::Cols, Memory::Rows>();
+    std::lock_guard<std::mutex> lock(mtx);
+    for (auto &e : entries) {
+      // only the pool holds the memory
+      if (e.key == k && e.frames == frames && e.buffer.use_count() == 1) {
+        return std::static_pointer_cast<Buffer>(e.buffer);
+      }
+    }
+    auto buffer = Memory(frames).syclData;
+    entries.push_back(Entry{k, frames, buffer});
+    return buffer;
+  }
+
+  /// \brief the number of memories created by the pool
+  size_t size() {
+    std::lock_guard<std::mutex> lock(mtx);
+    return entries.size();
+  }
+
+  /// \brief releases the memories which are not in use
+  void clear() {
+    std::lock_guard<std::mutex> lock(mtx);
+    std::vector<Entry> used;
+    for (auto &e : entries) {
+      if (e.buffer.use_count() > 1) {
+        used.push_back(e);
+      }
+    }
+    entries.swap(used);
+  }
+};
+
+/// \brief creates a terminal node for an intermediate result whose memory is
+/// taken from the pool of the device. The memory holds as many frames as the
+/// execution on the device.
+/// template parameters:
+/// \tparam Leaf: the LeafNode type of the intermediate result
+/// function parameters:
+/// \param dev: the device executing the expression
+/// \return Leaf
+template <typename Leaf, typename DeviceT>
+inline Leaf pooled_leaf(const DeviceT &dev) {
+  using Memory = typename Leaf::RHSExpr;
+  return Leaf(Memory(
+      dev.buffer_pool().template acquire<Memory>(dev.frames()), dev.frames()));
+}
+}  // internal
+}  // visioncpp
+#endif  // VISIONCPP_INCLUDE_FRAMEWORK_MEMORY_MEM_POOL_HPP_
@@ -93,6 +93,15 @@ struct MemoryProperties<float> {
   using ChannelType = float;
   static constexpr size_t ChannelSize = 1;
 };
+
+/// \brief Specialisation of the MemoryProperties when the output is
+/// cl::sycl::half
+template <>
+struct MemoryProperties<cl::sycl::half> {
+  static constexpr size_t ElementCategory = element_category::Basic;
+  using ChannelType = cl::sycl::half;
+  static constexpr size_t ChannelSize = 1;
+};
 }  // internal
 }  // visioncpp
 #endif  // VISIONCPP_INCLUDE_FRAMEWORK_MEMORY_MEM_PROP_HPP_
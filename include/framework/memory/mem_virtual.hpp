@@ -43,10 +43,10 @@ namespace internal {
 /// \tparam LR: is the row size of local memory
 /// \tparam LCT: is the column size of workgroup
 /// \tparam LRT: is the row size of workgroup
-template <bool PlcType, typename Node, size_t LC, size_t LR, size_t LCT,
-          size_t LRT>
+template <policy::PolicyType PlcType, typename Node, size_t LC, size_t LR,
+          size_t LCT, size_t LRT>
 struct VirtualMemory {
-  static constexpr bool policyType = PlcType;
+  static constexpr policy::PolicyType policyType = PlcType;
   using Type = typename Node::Type;
   using Scalar = typename Type::Scalar;
   using ElementType = typename Type::ElementType;
@@ -59,8 +59,34 @@ struct VirtualMemory {
   static constexpr bool SubExpressionEvaluationNeeded = true;
   static constexpr size_t Level = Node::Level;
   Node subTree;
+  /// \struct Result
+  /// \brief the result of the subexpression. It is shared by the copies of the
+  /// node, so a node used by several parents is executed once.
+  struct Result {
+    /// true until the subexpression is executed; reset sets it back before
+    /// each execution
+    bool pending;
+    /// the device only memory receiving the result. It is taken from the pool
+    /// of the device when the subexpression is executed, with as many frames
+    /// as the execution, and given back to the pool by reset.
+    internal::LeafNode<Type, Level> output;
+  };
+  std::shared_ptr<Result> result;
   using syclBuffer = Node;
-  VirtualMemory(Node nd) : subTree(nd){};
+  VirtualMemory(Node nd)
+      : subTree(nd),
+        result(std::make_shared<Result>(
+            Result{true, internal::LeafNode<Type, Level>(Type(
+                             std::shared_ptr<typename Type::syclBuffer>()))})) {
+  }
+
+  void reset(bool reset) {
+    if (reset) {
+      result->output.vilibMemory.syclData.reset();
+    }
+    result->pending = reset;
+    subTree.reset(reset);
+  }
   /// sub_expression_evaluation
   /// \brief This function is used to break the expression tree whenever
   /// necessary. The decision for breaking the tree will be determined based on
@@ -87,7 +113,12 @@ struct VirtualMemory {
       const DeviceT &dev) {
     // this is manually breaking so we have to break and we cannot use the
     // condition used in the subtree for evalifneeded
-    auto lhs = internal::LeafNode<Type, Level>();
+    if (!result->pending) {
+      return result->output;
+    }
+    result->pending = false;
+    auto lhs = pooled_leaf<internal::LeafNode<Type, Level>>(dev);
+    result->output = lhs;
     auto rhs =
         subTree.template sub_expression_evaluation<false, LC1, LR1, LRT1, LCT1>(
             dev);
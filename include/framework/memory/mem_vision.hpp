@@ -68,8 +68,7 @@ struct VisionMemory {
   template <cl::sycl::access::mode acMd>
   using Accessor = typename SyclAccessor<LeafType, Dim, acMd, ElementType,
                                          Scalar, scope>::Accessor;
-  // FIXME:: we have to make it work for image as well , the cl::sycl must be
-  // removed as well
+  // FIXME:: the cl::sycl must be removed
   template <cl::sycl::access::mode acMd>
   using HostAccessor =
       typename SyclAccessor<LeafType, Dim, acMd, ElementType, Scalar,
@@ -81,6 +80,12 @@ struct VisionMemory {
       typename SyclMem<HasMapAllocator, LeafType, Dim, ElementType>::Type;
   std::shared_ptr<syclBuffer> syclData;
   std::shared_ptr<HostAccessor<cl::sycl::access::mode::read>> hostAcc;
+  /// the number of frames of Cols x Rows held one after the other by the
+  /// memory. It is one unless the memory is used by a batched execution.
+  size_t frames;
+  /// the number of elements from the beginning of a row to the next one. It
+  /// differs from Cols only for a Pitched2D memory.
+  size_t pitch;
 
   static constexpr size_t used_memory() {
     return (Rows * Cols * Channels * sizeof(Scalar));
@@ -88,17 +93,52 @@ struct VisionMemory {
 
   static constexpr size_t get_size() { return (Type::used_memory()); }
 
-  VisionMemory(Scalar *dt) {
-    create_sycl_buffer<LeafType, ElementType, Scalar>(
-        syclData, dt, get_range<Dim>(Rows, Cols));
+  /// \brief returns the number of elements spanned by rows rows of cols
+  /// elements in the memory
+  inline size_t elements(size_t cols, size_t rows) const {
+    return (pitch * (rows - 1)) + cols;
+  }
+
+  /// \brief returns the sycl range of the memory. The rows of a Pitched2D
+  /// memory are a runtime pitch apart, so its range is a single row spanning
+  /// all of them. A Planar2D memory has a plane of Cols x Rows channels per
+  /// channel of the pixels, each of them holding all of the frames.
+  inline cl::sycl::range<Dim> storage_range() const {
+    return LeafType == memory_type::Pitched2D
+               ? get_range<Dim>(1, elements(Cols, Rows * frames))
+               : get_range<Dim>(Rows * frames *
+                                    (LeafType == memory_type::Planar2D
+                                         ? Channels
+                                         : 1),
+                                Cols);
+  }
+
+  /// \param dt: the host memory of the frames
+  /// \param framesArg: the number of frames of the memory
+  /// \param pitchArg: the number of elements from a row of dt to the next one.
+  /// It can only differ from Cols for a Pitched2D memory.
+  VisionMemory(Scalar *dt, size_t framesArg = 1, size_t pitchArg = Cols)
+      : frames(framesArg), pitch(pitchArg) {
+    create(dt, Pitched());
   }
   /// buffer copy is lightweight no need to pass by ref
-  VisionMemory(syclBuffer dt) { syclData = std::make_shared<syclBuffer>(dt); }
+  VisionMemory(syclBuffer dt) : frames(1), pitch(Cols) {
+    syclData = std::make_shared<syclBuffer>(dt);
+  }
+
+  /// \brief shares a memory created before, e.g. by the BufferPool
+  explicit VisionMemory(std::shared_ptr<syclBuffer> dt, size_t framesArg = 1)
+      : syclData(std::move(dt)), frames(framesArg), pitch(Cols) {}
 
-  VisionMemory() {
-    create_sycl_buffer<LeafType, ElementType, Scalar>(
-        syclData, get_range<Dim>(Rows, Cols));
+  /// \brief creates a device only memory
+  /// \param framesArg: the number of frames of the memory
+  explicit VisionMemory(size_t framesArg = 1)
+      : frames(framesArg), pitch(Cols) {
+    create_sycl_buffer<LeafType, ElementType, Scalar>(syclData,
+                                                      storage_range());
   }
+  /// \brief a terminal memory has nothing to reset before an execution
+  void reset(bool) {}
   /// sub_expression_evaluation
   /// \brief This function is used to break the expression tree whenever
   /// necessary. The decision for breaking the tree will be determined based on
@@ -133,14 +173,42 @@ struct VisionMemory {
   /// \return Accessor
   template <cl::sycl::access::mode accMode>
   Accessor<accMode> get_device_accessor(cl::sycl::handler &cgh) {
-    return Accessor<accMode>(*syclData, cgh);
+    return DeviceAccessor<Accessor<accMode>>::get(*syclData, cgh, pitch);
   }
   /// \brief reset_input is used to manually reset the input value of an input
   /// sycl buffer. This can be used when we are dealing with video streaming and
   /// we want to pass different input stream to the expression.
   /// \return void
   void reset_input(Scalar *dt) {
-    buffer_update<LeafType, Rows, Cols, ElementType, Scalar>(syclData, dt);
+    TraceScope scope("transfer", "reset_input", used_memory() * frames);
+    update(dt, Cols, Rows * frames, Pitched());
+  }
+
+  /// \brief reset_input for an image whose size is only known at runtime. The
+  /// cols x rows elements of dt are copied to the beginning of the buffer.
+  /// \return void
+  void reset_input(Scalar *dt, size_t cols, size_t rows) {
+    TraceScope scope("transfer", "reset_input",
+                     cols * rows * Channels * sizeof(Scalar));
+    update(dt, cols, rows, Pitched());
+  }
+
+  /// \brief read_output is used to copy the value of the sycl buffer to a
+  /// host pointer while keeping the buffer alive. This is used when the same
+  /// expression is executed for every frame of a video.
+  /// \return void
+  void read_output(Scalar *dt) {
+    TraceScope scope("transfer", "read_output", used_memory() * frames);
+    read(dt, Cols, Rows * frames, Pitched());
+  }
+
+  /// \brief read_output for an image whose size is only known at runtime.
+  /// The first cols x rows elements of the buffer are copied to dt.
+  /// \return void
+  void read_output(Scalar *dt, size_t cols, size_t rows) {
+    TraceScope scope("transfer", "read_output",
+                     cols * rows * Channels * sizeof(Scalar));
+    read(dt, cols, rows, Pitched());
   }
 
   /// \brief set_output function is used to destroy the sycl buffer and manually
@@ -149,6 +217,7 @@ struct VisionMemory {
   /// \param ptr: the pointer for manually allocating the data
   /// \return void
   void set_output(std::shared_ptr<Scalar> &ptr) {
+    TraceScope scope("transfer", "set_output", used_memory() * frames);
     syclData.get()->set_final_data(ptr);
     syclData.reset();  // that my needed to be added
   }
@@ -160,6 +229,7 @@ struct VisionMemory {
   /// want to display each frame of the video at the end of each iteration.
   /// \return void
   void lock() {
+    TraceScope scope("transfer", "lock", used_memory() * frames);
     hostAcc = std::make_shared<HostAccessor<cl::sycl::access::mode::read>>(
         HostAccessor<cl::sycl::access::mode::read>(*syclData));
   }
@@ -167,7 +237,62 @@ struct VisionMemory {
   /// called by user if the lock has been called in order to destroy the host
   /// accessor and release the execution.
   /// \return void
-  void unlock() { hostAcc.reset(); }
+  void unlock() {
+    TraceScope scope("transfer", "unlock");
+    hostAcc.reset();
+  }
+
+ private:
+  /// whether the rows of the memory are a runtime pitch apart
+  using Pitched =
+      std::integral_constant<bool, LeafType == memory_type::Pitched2D>;
+
+  /// \brief creates the buffer on the host memory dt
+  void create(Scalar *dt, std::false_type) {
+    create_sycl_buffer<LeafType, ElementType, Scalar>(syclData, dt,
+                                                      storage_range());
+  }
+
+  /// \brief creates the buffer of a Pitched2D memory, which writes back only
+  /// the elements of its rows to dt (see create_pitched_buffer)
+  void create(Scalar *dt, std::true_type) {
+    create_pitched_buffer(syclData,
+                          static_cast<ElementType *>(static_cast<void *>(dt)),
+                          storage_range(), Cols, Rows * frames, pitch);
+  }
+
+  /// \brief copies the cols x rows elements of dt to the buffer
+  void update(Scalar *dt, size_t cols, size_t rows, std::false_type) {
+    buffer_update<LeafType, Rows, Cols, ElementType, Scalar>(syclData, dt,
+                                                             cols * rows);
+  }
+
+  /// \brief copies the rows of dt to the buffer of a Pitched2D memory,
+  /// leaving the elements between them untouched
+  void update(Scalar *dt, size_t cols, size_t rows, std::true_type) {
+    auto host_acc =
+        syclData->template get_access<cl::sycl::access::mode::write,
+                                      cl::sycl::access::target::host_buffer>();
+    copy_rows(host_acc.get_pointer(),
+              static_cast<ElementType *>(static_cast<void *>(dt)), cols, rows,
+              pitch);
+  }
+
+  /// \brief copies the cols x rows elements of the buffer to dt
+  void read(Scalar *dt, size_t cols, size_t rows, std::false_type) {
+    buffer_read<LeafType, Rows, Cols, ElementType, Scalar>(syclData, dt,
+                                                           cols * rows);
+  }
+
+  /// \brief copies the rows of the buffer of a Pitched2D memory to dt,
+  /// leaving the elements of dt between them untouched
+  void read(Scalar *dt, size_t cols, size_t rows, std::true_type) {
+    auto host_acc =
+        syclData->template get_access<cl::sycl::access::mode::read,
+                                      cl::sycl::access::target::host_buffer>();
+    copy_rows(static_cast<ElementType *>(static_cast<void *>(dt)),
+              host_acc.get_pointer(), cols, rows, pitch);
+  }
 };
 }  // internal
 }  // visioncpp
@@ -38,6 +38,18 @@ template <bool MapAlloc, size_t ScalarType, size_t MemoryType, typename Sclr,
           size_t Sc, size_t Level>
 struct VisionMemory;
 
+/// The definition can be found in \ref ImageProperties
+template <typename T, typename Scalar>
+struct ImageProperties;
+
+/// The definition can be found in \ref ImageAccessor
+template <typename Acc, typename T>
+struct ImageAccessor;
+
+/// The definition can be found in \ref PlanarAccessor
+template <typename Acc, typename T>
+struct PlanarAccessor;
+
 /// \struct OutputMemory:
 /// \brief OutputMemory is used to deduce the output type of each node in the
 /// expression tree by using certain parameters from its child(ren).
@@ -51,8 +63,16 @@ struct VisionMemory;
 template <typename ElementType, size_t LeafType, size_t Cols, size_t Rows,
           size_t LVL>
 struct OutputMemory {
+  /// the output of a node computed from an Image is an Image too, unless its
+  /// pixel type has no image format
+  static constexpr size_t MemoryType =
+      (LeafType == memory_type::Image &&
+       !ImageProperties<ElementType, typename MemoryProperties<
+                                         ElementType>::ChannelType>::Supported)
+          ? memory_type::Buffer2D
+          : LeafType;
   using Type = VisionMemory<
-      false, MemoryProperties<ElementType>::ElementCategory, LeafType,
+      false, MemoryProperties<ElementType>::ElementCategory, MemoryType,
       typename MemoryProperties<ElementType>::ChannelType, Cols, Rows,
       ElementType, MemoryProperties<ElementType>::ChannelSize, scope::Global,
       LVL>;
@@ -62,12 +82,6 @@ struct OutputMemory {
 template <typename T>
 struct ConstMemory;
 
-/// \struct ImageProperties
-/// \brief this file is used to create the image properties required to create
-/// opencl image for different types of pixel
-template <typename T, typename Scalar>
-struct ImageProperties;
-
 /// \brief two category of element exist : basic which is the primary types and
 /// struct which is user define types like F32C3, U8C3, ...
 namespace element_category {
@@ -164,6 +178,13 @@ struct SyclScope<memory_type::Image, scope::Global> {
       cl::sycl::access::target::image;
 };
 
+/// \brief specialisation of the SyclScope when an Image is accessed on the host
+template <>
+struct SyclScope<memory_type::Image, scope::Host_Buffer> {
+  static constexpr cl::sycl::access::target scope =
+      cl::sycl::access::target::host_image;
+};
+
 /// \struct ConvertToVisionScope
 /// this struct is used to convert the sycl target to visioncpp target
 /// \tparam Sc represent the sycl target
@@ -204,6 +225,76 @@ struct ConvertToVisionScope<cl::sycl::access::target::image> {
   static constexpr size_t scope = scope::Global;
 };
 
+/// \brief specialisation of \ref ConvertToVisionScope where the target is
+/// host_image
+template <>
+struct ConvertToVisionScope<cl::sycl::access::target::host_image> {
+  static constexpr size_t scope = scope::Host_Buffer;
+};
+
+/// \struct PitchedAccessor
+/// \brief PitchedAccessor is the device accessor of a Pitched2D memory. It
+/// carries the row pitch of the memory to the kernel along with the accessor,
+/// and the evaluators read it through row_pitch.
+/// template parameters:
+/// \tparam Acc: the accessor on the memory
+template <typename Acc>
+struct PitchedAccessor {
+  using value_type = typename Acc::value_type;
+  Acc acc;
+  /// the number of elements from the beginning of a row to the next one
+  size_t pitch;
+  PitchedAccessor(Acc accArg, size_t pitchArg)
+      : acc(accArg), pitch(pitchArg) {}
+  auto get_pointer() const -> decltype(acc.get_pointer()) {
+    return acc.get_pointer();
+  }
+};
+
+/// \struct DeviceAccessor
+/// \brief DeviceAccessor is used to create the accessor of a memory used by a
+/// kernel.
+/// template parameters:
+/// \tparam Acc: the accessor type
+template <typename Acc>
+struct DeviceAccessor {
+  template <typename Buffer>
+  static inline Acc get(Buffer &buf, cl::sycl::handler &cgh, size_t) {
+    return Acc(buf, cgh);
+  }
+};
+/// \brief specialisation of the DeviceAccessor for a Pitched2D memory
+template <typename Acc>
+struct DeviceAccessor<PitchedAccessor<Acc>> {
+  template <typename Buffer>
+  static inline PitchedAccessor<Acc> get(Buffer &buf, cl::sycl::handler &cgh,
+                                         size_t pitch) {
+    return PitchedAccessor<Acc>(Acc(buf, cgh), pitch);
+  }
+};
+/// \brief specialisation of the DeviceAccessor for an Image memory. The
+/// column size of the image is passed with the accessor.
+template <typename Acc, typename T>
+struct DeviceAccessor<ImageAccessor<Acc, T>> {
+  template <typename Image>
+  static inline ImageAccessor<Acc, T> get(Image &img, cl::sycl::handler &cgh,
+                                          size_t cols) {
+    return ImageAccessor<Acc, T>(Acc(img, cgh), cols);
+  }
+};
+/// \brief specialisation of the DeviceAccessor for a Planar2D memory. The
+/// number of channels from a plane to the next one is passed with the
+/// accessor.
+template <typename Acc, typename T>
+struct DeviceAccessor<PlanarAccessor<Acc, T>> {
+  template <typename Buffer>
+  static inline PlanarAccessor<Acc, T> get(Buffer &buf, cl::sycl::handler &cgh,
+                                           size_t) {
+    return PlanarAccessor<Acc, T>(
+        Acc(buf, cgh), buf.get_count() / MemoryProperties<T>::ChannelSize);
+  }
+};
+
 /// \struct SyclAccessor
 /// \brief This struct is used to create a sycl accessor  type based on access
 /// mode; dimension and memory type.
@@ -225,9 +316,23 @@ template <size_t Dim, cl::sycl::access::mode AccMd, typename ElementType,
 struct SyclAccessor<memory_type::Image, Dim, AccMd, ElementType, Scalar,
                     scope> {
   using Properties = ImageProperties<ElementType, Scalar>;
+  using Accessor = ImageAccessor<
+      cl::sycl::accessor<typename Properties::access_type, Dim, AccMd,
+                         SyclScope<memory_type::Image, scope>::scope>,
+      ElementType>;
+  using access_type = typename Properties::access_type;
+};
+
+/// \brief specialisation of the \ref SyclAccessor when the memory_type is Image
+/// and the memory is accessed on the host
+template <size_t Dim, cl::sycl::access::mode AccMd, typename ElementType,
+          typename Scalar>
+struct SyclAccessor<memory_type::Image, Dim, AccMd, ElementType, Scalar,
+                    scope::Host_Buffer> {
+  using Properties = ImageProperties<ElementType, Scalar>;
   using Accessor =
       cl::sycl::accessor<typename Properties::access_type, Dim, AccMd,
-                         SyclScope<memory_type::Image, scope>::scope>;
+                         cl::sycl::access::target::host_image>;
   using access_type = typename Properties::access_type;
 };
 
@@ -241,6 +346,54 @@ struct SyclAccessor<memory_type::Const, Dim, AccMd, ElementType, Scalar,
   using Accessor = ConstMemory<ElementType>;
 };
 
+/// \brief specialisation of the \ref SyclAccessor when the memory_type is
+/// Pitched2D. The row pitch is passed to the kernel with the accessor.
+template <size_t Dim, cl::sycl::access::mode AccMd, typename ElementType,
+          typename Scalar, size_t scope>
+struct SyclAccessor<memory_type::Pitched2D, Dim, AccMd, ElementType, Scalar,
+                    scope> {
+  using Accessor = PitchedAccessor<
+      cl::sycl::accessor<ElementType, Dim, AccMd,
+                         SyclScope<memory_type::Pitched2D, scope>::scope>>;
+  using access_type = ElementType;
+};
+
+/// \brief specialisation of the \ref SyclAccessor when the memory_type is
+/// Pitched2D and the memory is accessed on the host
+template <size_t Dim, cl::sycl::access::mode AccMd, typename ElementType,
+          typename Scalar>
+struct SyclAccessor<memory_type::Pitched2D, Dim, AccMd, ElementType, Scalar,
+                    scope::Host_Buffer> {
+  using Accessor =
+      cl::sycl::accessor<ElementType, Dim, AccMd,
+                         cl::sycl::access::target::host_buffer>;
+  using access_type = ElementType;
+};
+
+/// \brief specialisation of the \ref SyclAccessor when the memory_type is
+/// Planar2D. The kernels access the channels of the pixels in their planes.
+template <size_t Dim, cl::sycl::access::mode AccMd, typename ElementType,
+          typename Scalar, size_t scope>
+struct SyclAccessor<memory_type::Planar2D, Dim, AccMd, ElementType, Scalar,
+                    scope> {
+  using Accessor = PlanarAccessor<
+      cl::sycl::accessor<Scalar, Dim, AccMd,
+                         SyclScope<memory_type::Planar2D, scope>::scope>,
+      ElementType>;
+  using access_type = ElementType;
+};
+
+/// \brief specialisation of the \ref SyclAccessor when the memory_type is
+/// Planar2D and the memory is accessed on the host
+template <size_t Dim, cl::sycl::access::mode AccMd, typename ElementType,
+          typename Scalar>
+struct SyclAccessor<memory_type::Planar2D, Dim, AccMd, ElementType, Scalar,
+                    scope::Host_Buffer> {
+  using Accessor = cl::sycl::accessor<Scalar, Dim, AccMd,
+                                      cl::sycl::access::target::host_buffer>;
+  using access_type = ElementType;
+};
+
 /// \struct SyclMem
 /// \brief SyclMem is used to create VisionMemory data storage. It has been
 /// specialised based on the memory type and input data
@@ -252,10 +405,38 @@ struct SyclAccessor<memory_type::Const, Dim, AccMd, ElementType, Scalar,
 /// \tparam ElementType: determines the type of each element in the storage
 template <bool MapAlloc, size_t LeafType, size_t Dim, typename ElementType>
 struct SyclMem;
-/// \brief specialisation of SyclMem when there is host memory allocated.
+
+#if VISIONCPP_SYCL_121
+/// \brief the sycl buffer created on a host memory. It uses the map_allocator,
+/// so that the cpu and host devices run directly on the host memory instead of
+/// a copy of it.
+template <typename T, size_t Dim>
+using HostBuffer = cl::sycl::buffer<T, Dim, cl::sycl::map_allocator<T>>;
+
+/// \brief creates a HostBuffer used in place on the host memory dt
+template <typename Buffer, typename T, typename RNG>
+inline Buffer make_host_buffer(T *dt, RNG rng) {
+  return Buffer(dt, rng, {cl::sycl::property::buffer::use_host_ptr()});
+}
+#else
+/// \brief the sycl buffer created on a host memory. SYCL 1.2 has no
+/// map_allocator, so the buffer works on a copy of the host memory, written
+/// back when the buffer is destroyed.
+template <typename T, size_t Dim>
+using HostBuffer = cl::sycl::buffer<T, Dim>;
+
+/// \brief creates a HostBuffer on a copy of the host memory dt
+template <typename Buffer, typename T, typename RNG>
+inline Buffer make_host_buffer(T *dt, RNG rng) {
+  return Buffer(dt, rng);
+}
+#endif
+
+/// \brief specialisation of SyclMem when there is host memory allocated. The
+/// buffer is created on the host memory (see HostBuffer).
 template <size_t LeafType, size_t Dim, typename ElementType>
 struct SyclMem<true, LeafType, Dim, ElementType> {
-  using Type = cl::sycl::buffer<ElementType, Dim>;
+  using Type = HostBuffer<ElementType, Dim>;
 };
 
 /// \brief specialisation of SyclMem when there is no host memory allocated.
@@ -271,6 +452,22 @@ struct SyclMem<true, memory_type::Image, Dim, ElementType> {
   using Type = cl::sycl::image<Dim>;
 };
 
+/// \brief specialisation of SyclMem when the memory_type is Planar2D. The
+/// buffer holds the channels of the pixels.
+template <size_t Dim, typename ElementType>
+struct SyclMem<true, memory_type::Planar2D, Dim, ElementType> {
+  using Scalar = typename MemoryProperties<ElementType>::ChannelType;
+  using Type = HostBuffer<Scalar, Dim>;
+};
+
+/// \brief specialisation of SyclMem when the memory_type is Planar2D and no
+/// host memory is allocated
+template <size_t Dim, typename ElementType>
+struct SyclMem<false, memory_type::Planar2D, Dim, ElementType> {
+  using Type = cl::sycl::buffer<
+      typename MemoryProperties<ElementType>::ChannelType, Dim>;
+};
+
 /// \brief specialisation of SyclMem when the memory_type is Constant
 /// variable
 template <size_t Dim, typename ElementType>
@@ -328,7 +525,10 @@ template <size_t LeafType, typename ElemType, typename Scalar,
 struct CreateSyclBuffer {
   /// function create_buffer
   /// \brief This function is used to create a sycl buffer when the host memory
-  /// allocated for synchronization.
+  /// allocated for synchronization. With SYCL 1.2.1 the buffer uses the host
+  /// memory itself rather than a copy of it; the copy is only avoided by the
+  /// devices sharing the host memory when it is suitably aligned (see
+  /// AlignedAllocator).
   /// parameters:
   /// \param ptr : shared_ptr containing the VisionMem
   /// \param dt : the input pointer for creating buffer
@@ -336,8 +536,8 @@ struct CreateSyclBuffer {
   /// \return void
   static inline void create_buffer(std::shared_ptr<VisionMem> &ptr, Scalar *dt,
                                    RNG rng) {
-    ptr = std::make_shared<VisionMem>(
-        VisionMem((static_cast<ElemType *>(static_cast<void *>(dt))), rng));
+    ptr = std::make_shared<VisionMem>(make_host_buffer<VisionMem>(
+        static_cast<ElemType *>(static_cast<void *>(dt)), rng));
   }
 
   /// function create_buffer
@@ -358,6 +558,9 @@ struct CreateSyclBuffer {
 template <typename ElemType, typename Scalar, typename VisionMem, typename RNG>
 struct CreateSyclBuffer<memory_type::Image, ElemType, Scalar, VisionMem, RNG> {
   using Properties = ImageProperties<ElemType, Scalar>;
+  static_assert(Properties::Supported,
+                "An Image memory must have 1, 2 or 4 float or unsigned char "
+                "channels");
   /// function create_buffer
   /// \brief This function is used to create a sycl buffer when the host memory
   /// is allocated for synchronization. parameters: \param ptr : shared_ptr
@@ -384,6 +587,36 @@ struct CreateSyclBuffer<memory_type::Image, ElemType, Scalar, VisionMem, RNG> {
   }
 };
 
+/// \brief specialisation of create CreateSyclBuffer when the memory type is
+/// Planar2D. The buffer is created on the planes of the host memory.
+template <typename ElemType, typename Scalar, typename VisionMem, typename RNG>
+struct CreateSyclBuffer<memory_type::Planar2D, ElemType, Scalar, VisionMem,
+                        RNG> {
+  /// function create_buffer
+  /// \brief This function is used to create a sycl buffer on the planes of
+  /// the host memory.
+  /// parameters:
+  /// \param ptr : shared_ptr containing the VisionMem
+  /// \param dt : the planes of the host memory
+  /// \param rng : the sycl range for creating buffer
+  /// \return void
+  static inline void create_buffer(std::shared_ptr<VisionMem> &ptr, Scalar *dt,
+                                   RNG rng) {
+    ptr = std::make_shared<VisionMem>(make_host_buffer<VisionMem>(dt, rng));
+  }
+
+  /// function create_buffer
+  /// \brief This function is used to create a device only buffer.
+  /// parameters:
+  /// \param ptr : shared_ptr containing the VisionMem
+  /// \param rng : the sycl range for creating buffer
+  /// \return void
+  static inline void create_buffer(std::shared_ptr<VisionMem> &ptr, RNG rng) {
+    CreateSyclBuffer<memory_type::Buffer2D, ElemType, Scalar, VisionMem,
+                     RNG>::create_buffer(ptr, rng);
+  }
+};
+
 /// \brief specialisation of create CreateSyclBuffer when the memory type is
 /// constant variable
 template <typename ElemType, typename Scalar, typename VisionMem, typename RNG>
@@ -421,6 +654,7 @@ template <size_t LeafType, typename ElemType, typename Scalar,
           typename VisionMem, typename RNG>
 inline void create_sycl_buffer(std::shared_ptr<VisionMem> &ptr, Scalar *dt,
                                RNG rng) {
+  TraceScope scope("memory", "create_buffer", rng.size() * sizeof(ElemType));
   CreateSyclBuffer<LeafType, ElemType, Scalar, VisionMem, RNG>::create_buffer(
       ptr, dt, rng);
 }
@@ -445,6 +679,7 @@ template <size_t LeafType, typename ElemType, typename Scalar,
           typename VisionMem, typename RNG>
 inline void create_sycl_buffer(std::shared_ptr<VisionMem> &ptr, VisionMem dt,
                                RNG rng) {
+  TraceScope scope("memory", "create_buffer");
   CreateSyclBuffer<memory_type::Const, ElemType, Scalar, VisionMem,
                    RNG>::create_buffer(ptr, dt, rng);
 }
@@ -466,10 +701,70 @@ inline void create_sycl_buffer(std::shared_ptr<VisionMem> &ptr, VisionMem dt,
 template <size_t LeafType, typename ElemType, typename Scalar,
           typename VisionMem, typename RNG>
 inline void create_sycl_buffer(std::shared_ptr<VisionMem> &ptr, RNG rng) {
+  TraceScope scope("memory", "create_buffer", rng.size() * sizeof(ElemType));
   CreateSyclBuffer<LeafType, ElemType, Scalar, VisionMem, RNG>::create_buffer(
       ptr, rng);
 }
 
+/// function copy_rows
+/// \brief copies rows rows of cols elements from src to dst, the rows of both
+/// being pitch elements apart. The elements between the rows are left
+/// untouched, as they may belong to another view of the same host image.
+/// parameters:
+/// \param dst : the first row written
+/// \param src : the first row read
+/// \param cols : the number of elements copied from each row
+/// \param rows : the number of rows copied
+/// \param pitch : the number of elements from a row to the next one
+/// \return void
+template <typename T>
+inline void copy_rows(T *dst, const T *src, size_t cols, size_t rows,
+                      size_t pitch) {
+  /// nothing to copy when the buffer is mapped on dst
+  if (dst != src) {
+    for (size_t r = 0; r < rows; r++) {
+      memcpy(dst + r * pitch, src + r * pitch, sizeof(T) * cols);
+    }
+  }
+}
+
+/// function create_pitched_buffer
+/// \brief creates the buffer of a Pitched2D memory on the host memory dt. The
+/// buffer spans the row padding between the rows, which may be written by
+/// another view of the same host image while the buffer is alive. So the
+/// buffer works on a copy of dt, and only the cols elements of each of its
+/// rows are written back to dt when the buffer is destroyed.
+/// template parameters:
+/// \tparam ElemType : determines the type of the element in each memory
+/// \tparam VisionMem: represent the type of the memory created by using SyclMem
+/// \tparam RNG : the sycl range type for creating memory
+/// parameters:
+/// \param ptr : shared_ptr containing the VisionMem
+/// \param dt : the first row of the host memory
+/// \param rng : the sycl range for creating buffer
+/// \param cols : the number of elements of each row
+/// \param rows : the number of rows of the memory
+/// \param pitch : the number of elements from a row of dt to the next one
+/// \return void
+template <typename ElemType, typename VisionMem, typename RNG>
+inline void create_pitched_buffer(std::shared_ptr<VisionMem> &ptr,
+                                  ElemType *dt, RNG rng, size_t cols,
+                                  size_t rows, size_t pitch) {
+  TraceScope scope("memory", "create_buffer", rng.size() * sizeof(ElemType));
+  ptr = std::shared_ptr<VisionMem>(
+      new VisionMem(static_cast<const ElemType *>(dt), rng),
+      [=](VisionMem *buffer) {
+        {
+          auto host_acc =
+              buffer->template get_access<
+                  cl::sycl::access::mode::read,
+                  cl::sycl::access::target::host_buffer>();
+          copy_rows(dt, host_acc.get_pointer(), cols, rows, pitch);
+        }
+        delete buffer;
+      });
+}
+
 /// \struct BufferUpdate
 /// \brief This is used to update the Vision Memory with new value
 /// update sycl buffer at the moment we use ptr.reset() because it was faster
@@ -489,16 +784,20 @@ struct BufferUpdate {
   /// parameters:
   /// \param ptr : is the shared_ptr containing the SyclMem
   /// \param dt: is the pointer containing the new value for the buffer
+  /// \param elems: is the number of elements copied to the buffer
   /// \return void
   static inline void buffer_update(std::shared_ptr<VisionMem> &ptr,
-                                   Scalar *dt) {
-    auto host_ptr =
+                                   Scalar *dt, size_t elems) {
+    auto host_acc =
         (*ptr)
             .template get_access<cl::sycl::access::mode::discard_write,
-                                 cl::sycl::access::target::host_buffer>()
-            .get_pointer();
+                                 cl::sycl::access::target::host_buffer>();
 
-    memcpy(host_ptr, dt, sizeof(Scalar) * ElemType::elements * Rows * Cols);
+    /// nothing to copy when the buffer is mapped on dt
+    if (static_cast<void *>(host_acc.get_pointer()) != dt) {
+      memcpy(host_acc.get_pointer(), dt,
+             sizeof(Scalar) * MemoryProperties<ElemType>::ChannelSize * elems);
+    }
   }
 };
 
@@ -508,15 +807,59 @@ template <size_t Rows, size_t Cols, typename ElemType, typename Scalar,
 struct BufferUpdate<memory_type::Image, Rows, Cols, ElemType, Scalar,
                     VisionMem> {
   /// function buffer_update
-  /// \brief this function is used to update the sycl buffer with a new value
+  /// \brief this function is used to update the image with a new value. The
+  /// element i of dt is written to the texel i of the image, in the same
+  /// order as the elements of a buffer.
   /// parameters:
   /// \param ptr : is the shared_ptr containing the SyclMem
   /// \param dt: is the pointer containing the new value for the buffer
+  /// \param elems: is the number of elements copied to the image
   /// \return void
   using Properties = ImageProperties<ElemType, Scalar>;
   static inline void buffer_update(std::shared_ptr<VisionMem> &ptr,
-                                   Scalar *dt) {
-    static_assert(true, "image is not supported in this version");
+                                   Scalar *dt, size_t elems) {
+    auto host_acc =
+        (*ptr)
+            .template get_access<typename Properties::access_type,
+                                 cl::sycl::access::mode::write>();
+    const ElemType *src = static_cast<ElemType *>(static_cast<void *>(dt));
+    for (size_t i = 0; i < elems; i++) {
+      host_acc.write(cl::sycl::int2(i % Cols, i / Cols),
+                     Properties::to_access(src[i]));
+    }
+  }
+};
+
+/// \brief specialisation of the BufferUpdate when the memory_type is Planar2D
+template <size_t Rows, size_t Cols, typename ElemType, typename Scalar,
+          typename VisionMem>
+struct BufferUpdate<memory_type::Planar2D, Rows, Cols, ElemType, Scalar,
+                    VisionMem> {
+  /// function buffer_update
+  /// \brief this function is used to update the planes of the buffer. The
+  /// planes of dt are as far apart as the ones of the buffer, and the first
+  /// elems channels of each of them are copied.
+  /// parameters:
+  /// \param ptr : is the shared_ptr containing the SyclMem
+  /// \param dt: is the pointer containing the new value for the buffer
+  /// \param elems: is the number of pixels copied to the buffer
+  /// \return void
+  static inline void buffer_update(std::shared_ptr<VisionMem> &ptr,
+                                   Scalar *dt, size_t elems) {
+    constexpr size_t Channels = MemoryProperties<ElemType>::ChannelSize;
+    const size_t plane = ptr->get_count() / Channels;
+    auto host_acc =
+        (*ptr)
+            .template get_access<cl::sycl::access::mode::discard_write,
+                                 cl::sycl::access::target::host_buffer>();
+
+    /// nothing to copy when the buffer is mapped on dt
+    if (static_cast<void *>(host_acc.get_pointer()) != dt) {
+      for (size_t k = 0; k < Channels; k++) {
+        memcpy(host_acc.get_pointer() + k * plane, dt + k * plane,
+               sizeof(Scalar) * elems);
+      }
+    }
   }
 };
 
@@ -533,7 +876,7 @@ struct BufferUpdate<memory_type::Const, Rows, Cols, ElemType, Scalar,
   /// \param dt: is the pointer containing the new value for the buffer
   /// \return void
   static inline void buffer_update(std::shared_ptr<VisionMem> &ptr,
-                                   VisionMem dt) {
+                                   VisionMem dt, size_t) {
     *ptr = dt;
   }
 };
@@ -550,18 +893,143 @@ struct BufferUpdate<memory_type::Const, Rows, Cols, ElemType, Scalar,
 /// function parameters:
 /// \param ptr : is the shared_ptr containing the SyclMem
 /// \param dt: is the pointer containing the new value for the buffer
+/// \param elems: is the number of elements copied to the buffer. By default
+/// the whole buffer is updated.
 /// \return void
 template <size_t LeafType, size_t Rows, size_t Cols, typename ElemType,
           typename Scalar, typename VisionMem>
-inline void buffer_update(std::shared_ptr<VisionMem> &ptr, Scalar *dt) {
+inline void buffer_update(std::shared_ptr<VisionMem> &ptr, Scalar *dt,
+                          size_t elems = Rows * Cols) {
   BufferUpdate<LeafType, Rows, Cols, ElemType, Scalar,
-               VisionMem>::buffer_update(ptr, dt);
+               VisionMem>::buffer_update(ptr, dt, elems);
+}
+
+/// \struct BufferRead
+/// \brief This is used to copy the content of the Vision Memory back to a
+/// host pointer without destroying the sycl buffer.
+/// template parameters:
+/// \tparam LeafType : is the memory type
+/// \tparam Rows: is the row size of the buffer
+/// \tparam Cols: is the column size of the buffer
+/// \tparam ElemType: is the type of element in the buffer
+/// \tparam Scalar is the type of each channel of the element
+/// \tparam VisionMem is the created SyclMem
+template <size_t LeafType, size_t Rows, size_t Cols, typename ElemType,
+          typename Scalar, typename VisionMem>
+struct BufferRead {
+  /// function buffer_read
+  /// \brief this function is used to copy the sycl buffer to the host pointer
+  /// parameters:
+  /// \param ptr : is the shared_ptr containing the SyclMem
+  /// \param dt: is the pointer receiving the value of the buffer
+  /// \param elems: is the number of elements copied from the buffer
+  /// \return void
+  static inline void buffer_read(std::shared_ptr<VisionMem> &ptr, Scalar *dt,
+                                 size_t elems) {
+    auto host_acc =
+        (*ptr)
+            .template get_access<cl::sycl::access::mode::read,
+                                 cl::sycl::access::target::host_buffer>();
+
+    /// nothing to copy when the buffer is mapped on dt
+    if (static_cast<void *>(host_acc.get_pointer()) != dt) {
+      memcpy(dt, host_acc.get_pointer(),
+             sizeof(Scalar) * MemoryProperties<ElemType>::ChannelSize * elems);
+    }
+  }
+};
+
+/// \brief specialisation of the BufferRead when the memory_type is Image
+template <size_t Rows, size_t Cols, typename ElemType, typename Scalar,
+          typename VisionMem>
+struct BufferRead<memory_type::Image, Rows, Cols, ElemType, Scalar,
+                  VisionMem> {
+  /// function buffer_read
+  /// \brief this function is used to copy the image to the host pointer. The
+  /// texel i of the image is copied to the element i of dt.
+  /// parameters:
+  /// \param ptr : is the shared_ptr containing the SyclMem
+  /// \param dt: is the pointer receiving the value of the image
+  /// \param elems: is the number of elements copied from the image
+  /// \return void
+  using Properties = ImageProperties<ElemType, Scalar>;
+  static inline void buffer_read(std::shared_ptr<VisionMem> &ptr, Scalar *dt,
+                                 size_t elems) {
+    auto host_acc =
+        (*ptr)
+            .template get_access<typename Properties::access_type,
+                                 cl::sycl::access::mode::read>();
+    ElemType *dst = static_cast<ElemType *>(static_cast<void *>(dt));
+    for (size_t i = 0; i < elems; i++) {
+      dst[i] = Properties::from_access(
+          host_acc.read(cl::sycl::int2(i % Cols, i / Cols)));
+    }
+  }
+};
+
+/// \brief specialisation of the BufferRead when the memory_type is Planar2D
+template <size_t Rows, size_t Cols, typename ElemType, typename Scalar,
+          typename VisionMem>
+struct BufferRead<memory_type::Planar2D, Rows, Cols, ElemType, Scalar,
+                  VisionMem> {
+  /// function buffer_read
+  /// \brief this function is used to copy the first elems channels of each
+  /// plane of the buffer to the same place of dt
+  /// parameters:
+  /// \param ptr : is the shared_ptr containing the SyclMem
+  /// \param dt: is the pointer receiving the value of the buffer
+  /// \param elems: is the number of pixels copied from the buffer
+  /// \return void
+  static inline void buffer_read(std::shared_ptr<VisionMem> &ptr, Scalar *dt,
+                                 size_t elems) {
+    constexpr size_t Channels = MemoryProperties<ElemType>::ChannelSize;
+    const size_t plane = ptr->get_count() / Channels;
+    auto host_acc =
+        (*ptr)
+            .template get_access<cl::sycl::access::mode::read,
+                                 cl::sycl::access::target::host_buffer>();
+
+    /// nothing to copy when the buffer is mapped on dt
+    if (static_cast<void *>(host_acc.get_pointer()) != dt) {
+      for (size_t k = 0; k < Channels; k++) {
+        memcpy(dt + k * plane, host_acc.get_pointer() + k * plane,
+               sizeof(Scalar) * elems);
+      }
+    }
+  }
+};
+
+/// function buffer_read
+/// \brief template deduction function for BufferRead
+/// template parameters:
+/// \tparam LeafType : is the memory type
+/// \tparam Rows: is the row size of the buffer
+/// \tparam Cols: is the column size of the buffer
+/// \tparam ElemType: is the type of element in the buffer
+/// \tparam Scalar is the type of each channel of the element
+/// \tparam VisionMem is the created SyclMem
+/// function parameters:
+/// \param ptr : is the shared_ptr containing the SyclMem
+/// \param dt: is the pointer receiving the value of the buffer
+/// \param elems: is the number of elements copied from the buffer. By default
+/// the whole buffer is read.
+/// \return void
+template <size_t LeafType, size_t Rows, size_t Cols, typename ElemType,
+          typename Scalar, typename VisionMem>
+inline void buffer_read(std::shared_ptr<VisionMem> &ptr, Scalar *dt,
+                        size_t elems = Rows * Cols) {
+  BufferRead<LeafType, Rows, Cols, ElemType, Scalar, VisionMem>::buffer_read(
+      ptr, dt, elems);
 }
 }  // namespace internal
 }  // namespace visioncpp
 
 // Vision Memories Headers
 #include "mem_const.hpp"
+#include "mem_host.hpp"
+#include "mem_image.hpp"
+#include "mem_planar.hpp"
+#include "mem_pool.hpp"
 #include "mem_prop.hpp"
 #include "mem_virtual.hpp"
 #include "mem_vision.hpp"
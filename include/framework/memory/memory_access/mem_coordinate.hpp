@@ -35,6 +35,227 @@ namespace mem_dim {
 static constexpr size_t ColDim = 0;
 static constexpr size_t RowDim = 1;
 };
+
+/// \struct ScaleExtent
+/// \brief ScaleExtent is used to deduce the runtime size of a node from the
+/// runtime size of the root of the expression. Both compile-time sizes must be
+/// a multiple of each other; otherwise the node keeps its compile-time size.
+/// It only applies to the nodes on the path of the images: the filters and the
+/// constant variables always keep their compile-time size, see fixed_location
+/// and extent_cols.
+/// template parameters:
+/// \tparam Size: the compile-time size of the node in that dimension
+/// \tparam RootSize: the compile-time size of the root in that dimension
+/// \tparam Bigger: whether or not the node is bigger than the root
+/// \tparam Multiple: whether or not one size is a multiple of the other one
+template <size_t Size, size_t RootSize, bool Bigger = (Size > RootSize),
+          bool Multiple = (Size > RootSize ? Size % RootSize == 0
+                                           : RootSize % Size == 0)>
+struct ScaleExtent {
+  static inline size_t get(size_t) { return Size; }
+};
+
+/// \brief specialisation of ScaleExtent when the node is Ratio times bigger
+/// than the root (e.g. the input of a down-sampling node)
+template <size_t Size, size_t RootSize>
+struct ScaleExtent<Size, RootSize, true, true> {
+  static inline size_t get(size_t rootExtent) {
+    return rootExtent * (Size / RootSize);
+  }
+};
+
+/// \brief specialisation of ScaleExtent when the node is Ratio times smaller
+/// than the root or has the same size
+template <size_t Size, size_t RootSize>
+struct ScaleExtent<Size, RootSize, false, true> {
+  static inline size_t get(size_t rootExtent) {
+    return (rootExtent + (RootSize / Size) - 1) / (RootSize / Size);
+  }
+};
+
+/// \struct ScaleOrigin
+/// \brief ScaleOrigin is the counterpart of ScaleExtent for the first row or
+/// column of a region. It is rounded down, while the size is rounded up, so the
+/// scaled region covers the region of the root.
+template <size_t Size, size_t RootSize, bool Bigger = (Size > RootSize),
+          bool Multiple = (Size > RootSize ? Size % RootSize == 0
+                                           : RootSize % Size == 0)>
+struct ScaleOrigin {
+  static inline size_t get(size_t) { return 0; }
+};
+
+/// \brief specialisation of ScaleOrigin when the node is Ratio times bigger
+/// than the root
+template <size_t Size, size_t RootSize>
+struct ScaleOrigin<Size, RootSize, true, true> {
+  static inline size_t get(size_t rootOrigin) {
+    return rootOrigin * (Size / RootSize);
+  }
+};
+
+/// \brief specialisation of ScaleOrigin when the node is Ratio times smaller
+/// than the root or has the same size
+template <size_t Size, size_t RootSize>
+struct ScaleOrigin<Size, RootSize, false, true> {
+  static inline size_t get(size_t rootOrigin) {
+    return rootOrigin / (RootSize / Size);
+  }
+};
+
+/// \struct StaticExtent
+/// \brief StaticExtent is used when the size of the images is known at compile
+/// time. Each node uses its own Cols and Rows template parameters.
+struct StaticExtent {
+  template <size_t Cols>
+  static constexpr size_t cols() {
+    return Cols;
+  }
+  template <size_t Rows>
+  static constexpr size_t rows() {
+    return Rows;
+  }
+  /// a single image is executed
+  static constexpr size_t frames() { return 1; }
+  static constexpr size_t frame_offset(size_t) { return 0; }
+  /// the whole image is executed
+  static constexpr size_t col_origin() { return 0; }
+  static constexpr size_t row_origin() { return 0; }
+};
+
+/// \struct DynamicExtent
+/// \brief DynamicExtent is used when the size of the images is only known at
+/// runtime. The Cols and Rows template parameters of the nodes are then used as
+/// the capacity of their memories, and the runtime size of each node is
+/// deduced from the runtime size of the root of the expression.
+/// template parameters:
+/// \tparam RootCols: the compile-time column size of the root of the expression
+/// \tparam RootRows: the compile-time row size of the root of the expression
+template <size_t RootCols, size_t RootRows>
+struct DynamicExtent {
+  size_t c;
+  size_t r;
+  DynamicExtent(size_t colsArg, size_t rowsArg) : c(colsArg), r(rowsArg) {}
+  template <size_t Cols>
+  inline size_t cols() const {
+    return ScaleExtent<Cols, RootCols>::get(c);
+  }
+  template <size_t Rows>
+  inline size_t rows() const {
+    return ScaleExtent<Rows, RootRows>::get(r);
+  }
+  /// a single image is executed
+  static constexpr size_t frames() { return 1; }
+  static constexpr size_t frame_offset(size_t) { return 0; }
+  /// the whole image is executed
+  static constexpr size_t col_origin() { return 0; }
+  static constexpr size_t row_origin() { return 0; }
+};
+
+/// \struct BatchExtent
+/// \brief BatchExtent is used when the expression is executed on a batch of
+/// frames of the compile-time size in a single kernel. Each global memory then
+/// holds its frames one after the other, and the frame of each work-group is
+/// set by the device before the expression is evaluated.
+struct BatchExtent : StaticExtent {
+  /// the number of frames of the batch
+  size_t n;
+  /// the frame computed by the work-item
+  size_t frame;
+  explicit BatchExtent(size_t framesArg) : n(framesArg), frame(0) {}
+  inline size_t frames() const { return n; }
+  /// \brief returns the offset of the current frame in a memory holding
+  /// elements values per frame
+  inline size_t frame_offset(size_t elements) const {
+    return frame * elements;
+  }
+};
+
+/// \struct RoiExtent
+/// \brief RoiExtent is used when only a region of interest of the root of the
+/// expression is computed. The nodes keep their compile-time size, which is
+/// used to index and clamp their memories, so the neighbour operations still
+/// read their halos outside of the region. Each kernel is launched over the
+/// work-groups of the whole image kernel which cover the region, so the
+/// results inside the region are the ones of the whole image.
+/// template parameters:
+/// \tparam RootCols: the column size of the root of the expression
+/// \tparam RootRows: the row size of the root of the expression
+template <size_t RootCols, size_t RootRows>
+struct RoiExtent : StaticExtent {
+  /// the region [c0, c1) x [r0, r1) in pixels of the root
+  size_t c0, r0, c1, r1;
+  /// the first thread of the kernel and the number of threads from it
+  size_t oc, orow, kc, kr;
+  RoiExtent(size_t c0Arg, size_t r0Arg, size_t c1Arg, size_t r1Arg)
+      : c0(c0Arg),
+        r0(r0Arg),
+        c1(c1Arg),
+        r1(r1Arg),
+        oc(0),
+        orow(0),
+        kc(0),
+        kr(0) {}
+  inline size_t col_origin() const { return oc; }
+  inline size_t row_origin() const { return orow; }
+  /// \brief returns the extent of a kernel of CThread x RThread threads with
+  /// LC x LR local memories. Its first thread is the first one of the
+  /// work-group containing the region.
+  template <size_t LC, size_t LR, size_t CThread, size_t RThread>
+  inline RoiExtent kernel() const {
+    RoiExtent ext = *this;
+    ext.oc = (ScaleOrigin<CThread, RootCols>::get(c0) / LC) * LC;
+    ext.orow = (ScaleOrigin<RThread, RootRows>::get(r0) / LR) * LR;
+    size_t ec = ScaleExtent<CThread, RootCols>::get(c1);
+    size_t er = ScaleExtent<RThread, RootRows>::get(r1);
+    ext.kc = (ec < CThread ? ec : CThread) - ext.oc;
+    ext.kr = (er < RThread ? er : RThread) - ext.orow;
+    return ext;
+  }
+};
+
+/// function kernel_extent
+/// \brief returns the extent of a kernel of CThread x RThread threads with
+/// LC x LR local memories. It is the extent given to the execution, except for
+/// a region of interest which is mapped to the threads of the kernel.
+template <size_t LC, size_t LR, size_t CThread, size_t RThread,
+          typename Extent>
+inline Extent kernel_extent(const Extent &ext) {
+  return ext;
+}
+/// \brief specialisation of kernel_extent for a region of interest
+template <size_t LC, size_t LR, size_t CThread, size_t RThread,
+          size_t RootCols, size_t RootRows>
+inline RoiExtent<RootCols, RootRows> kernel_extent(
+    const RoiExtent<RootCols, RootRows> &ext) {
+  return ext.template kernel<LC, LR, CThread, RThread>();
+}
+
+/// function kernel_cols
+/// \brief returns the number of column threads of a kernel from its first one
+/// \tparam CThread: the column size of the expression of the kernel
+template <size_t CThread, typename Extent>
+inline size_t kernel_cols(const Extent &ext) {
+  return ext.template cols<CThread>();
+}
+/// \brief specialisation of kernel_cols for a region of interest
+template <size_t CThread, size_t RootCols, size_t RootRows>
+inline size_t kernel_cols(const RoiExtent<RootCols, RootRows> &ext) {
+  return ext.kc;
+}
+
+/// function kernel_rows
+/// \brief returns the number of row threads of a kernel from its first one
+/// \tparam RThread: the row size of the expression of the kernel
+template <size_t RThread, typename Extent>
+inline size_t kernel_rows(const Extent &ext) {
+  return ext.template rows<RThread>();
+}
+/// \brief specialisation of kernel_rows for a region of interest
+template <size_t RThread, size_t RootCols, size_t RootRows>
+inline size_t kernel_rows(const RoiExtent<RootCols, RootRows> &ext) {
+  return ext.kr;
+}
+
 /// \struct Coordinate
 /// \brief Coordinate is used to specify
 /// local/global offset for local/global access to the local/global memory for
@@ -43,20 +264,54 @@ static constexpr size_t RowDim = 1;
 /// \tparam LC The column size for local memory
 /// \tparam LR The Row size for the local memory
 /// \tparam ItemID provided by sycl
-template <size_t LC, size_t LR, typename ItemID>
+/// \tparam Extent the runtime or compile-time size of the images
+/// \tparam InteriorTile whether or not the tile of the work-group and its halo
+/// lie inside the images, in which case the border checks of the neighbour
+/// operations are compiled out
+template <size_t LC, size_t LR, typename ItemID, typename Extent,
+          bool InteriorTile = false>
 struct Coordinate {
-  Coordinate(ItemID itemID)
+  static constexpr bool Interior = InteriorTile;
+  Coordinate(ItemID itemID, Extent extent)
       : itemID(itemID),
+        ext(extent),
         cLRng(itemID.get_local_range()[mem_dim::ColDim]),
         rLRng(itemID.get_local_range()[mem_dim::RowDim]),
         pointOp_gc(0),
         pointOp_gr(0),
-        g_c(itemID.get_local(mem_dim::ColDim) +
+        g_c(ext.col_origin() + itemID.get_local(mem_dim::ColDim) +
             (itemID.get_group(mem_dim::ColDim) * ((LC / cLRng) * cLRng))),
-        g_r(itemID.get_local(mem_dim::RowDim) +
+        g_r(ext.row_origin() + itemID.get_local(mem_dim::RowDim) +
             itemID.get_group(mem_dim::RowDim) * ((LR / rLRng) * rLRng)),
         l_c(itemID.get_local(mem_dim::ColDim)),
         l_r(itemID.get_local(mem_dim::RowDim)) {}
+  /// the same Coordinate evaluated with or without the border checks
+  template <bool OtherTile>
+  explicit Coordinate(const Coordinate<LC, LR, ItemID, Extent, OtherTile> &o)
+      : itemID(o.itemID),
+        ext(o.ext),
+        cLRng(o.cLRng),
+        rLRng(o.rLRng),
+        pointOp_gc(o.pointOp_gc),
+        pointOp_gr(o.pointOp_gr),
+        g_c(o.g_c),
+        g_r(o.g_r),
+        l_c(o.l_c),
+        l_r(o.l_r) {}
+  /// the same Coordinate with another image size
+  template <typename OtherExtent>
+  Coordinate(const Coordinate<LC, LR, ItemID, OtherExtent, InteriorTile> &o,
+             Extent extent)
+      : itemID(o.itemID),
+        ext(extent),
+        cLRng(o.cLRng),
+        rLRng(o.rLRng),
+        pointOp_gc(o.pointOp_gc),
+        pointOp_gr(o.pointOp_gr),
+        g_c(o.g_c),
+        g_r(o.g_r),
+        l_c(o.l_c),
+        l_r(o.l_r) {}
 
   /// function barrier is used to call sycl local barrier for local threads
   /// \return void
@@ -71,6 +326,7 @@ struct Coordinate {
   }
 
   ItemID itemID;
+  Extent ext;
   size_t cLRng;
   size_t rLRng;
   size_t pointOp_gc;
@@ -80,10 +336,108 @@ struct Coordinate {
   size_t l_c;
   size_t l_r;
 };
-/// deduction function for Coordinate
+/// deduction function for Coordinate when the size of the images is known at
+/// compile time
 template <size_t LC, size_t LR, typename ItemID>
-Coordinate<LC, LR, ItemID> memLocation(ItemID itemID) {
-  return Coordinate<LC, LR, ItemID>(itemID);
+Coordinate<LC, LR, ItemID, StaticExtent> memLocation(ItemID itemID) {
+  return Coordinate<LC, LR, ItemID, StaticExtent>(itemID, StaticExtent());
+}
+/// function frame_extent
+/// \brief returns the image size seen by a work-item. It is the size given to
+/// the kernel, except for a batch of frames where the frame of the work-item is
+/// its group in the third dimension of the kernel.
+template <typename ItemID, typename Extent>
+inline Extent frame_extent(const ItemID &, Extent ext) {
+  return ext;
+}
+/// \brief specialisation of frame_extent for a batch of frames
+template <typename ItemID>
+inline BatchExtent frame_extent(const ItemID &itemID, BatchExtent ext) {
+  ext.frame = itemID.get_group(2);
+  return ext;
+}
+/// deduction function for Coordinate with a given image size
+template <size_t LC, size_t LR, typename ItemID, typename Extent>
+Coordinate<LC, LR, ItemID, Extent> memLocation(ItemID itemID, Extent ext) {
+  return Coordinate<LC, LR, ItemID, Extent>(itemID,
+                                            frame_extent(itemID, ext));
+}
+
+/// function fixed_location
+/// \brief returns the Coordinate of the work-item for the filter of a
+/// neighbour operation. The filter keeps its compile-time size whatever the
+/// size of the images, and is shared by all the frames of a batch.
+/// \param cOffset: the Coordinate of the work-item
+/// \return Coordinate
+template <size_t LC, size_t LR, typename ItemID, typename Extent,
+          bool Interior>
+inline Coordinate<LC, LR, ItemID, StaticExtent, Interior> fixed_location(
+    const Coordinate<LC, LR, ItemID, Extent, Interior> &cOffset) {
+  return Coordinate<LC, LR, ItemID, StaticExtent, Interior>(cOffset,
+                                                            StaticExtent());
+}
+
+/// function extent_cols
+/// \brief returns the column size of a node for the current execution
+/// template parameters:
+/// \tparam Cols: the compile-time column size of the node
+/// \tparam Fixed: whether or not the node keeps its compile-time size, as the
+/// constant variables do
+/// \tparam Loc: the Coordinate type
+/// function parameters:
+/// \param cOffset: the Coordinate of the work-item
+/// \return size_t
+template <size_t Cols, bool Fixed = false, typename Loc>
+static inline size_t extent_cols(const Loc &cOffset) {
+  return Fixed ? Cols : cOffset.ext.template cols<Cols>();
+}
+
+/// function extent_rows
+/// \brief returns the row size of a node for the current execution
+/// template parameters:
+/// \tparam Rows: the compile-time row size of the node
+/// \tparam Fixed: whether or not the node keeps its compile-time size, as the
+/// constant variables do
+/// \tparam Loc: the Coordinate type
+/// function parameters:
+/// \param cOffset: the Coordinate of the work-item
+/// \return size_t
+template <size_t Rows, bool Fixed = false, typename Loc>
+static inline size_t extent_rows(const Loc &cOffset) {
+  return Fixed ? Rows : cOffset.ext.template rows<Rows>();
+}
+
+/// function frame_offset
+/// \brief returns the offset of the frame of the work-item in a global memory
+/// of cols x rows elements per frame. It is zero unless the expression is
+/// executed on a batch of frames, and always zero for the memories shared by
+/// all the frames, which are the local memories, the filters and the
+/// constant variables.
+/// template parameters:
+/// \tparam Shared: whether or not the memory is shared by all the frames
+/// \tparam Loc: the Coordinate type
+/// function parameters:
+/// \param cOffset: the Coordinate of the work-item
+/// \param cols: the column size of the memory
+/// \param rows: the row size of the memory
+/// \return size_t
+template <bool Shared, typename Loc>
+static inline size_t frame_offset(const Loc &cOffset, size_t cols,
+                                  size_t rows) {
+  return Shared ? 0 : cOffset.ext.frame_offset(cols * rows);
+}
+
+/// function get_global_threads
+/// \brief returns the global range of a kernel in one dimension
+/// template parameters:
+/// \tparam L: the local memory size in that dimension
+/// \tparam LT: the workgroup size in that dimension
+/// function parameters:
+/// \param threads: the size of the expression in that dimension
+/// \return size_t
+template <size_t L, size_t LT>
+static inline size_t get_global_threads(size_t threads) {
+  return ((threads + L - 1) / L) * LT;
 }
 }  // internal
 }  // visioncpp
@@ -33,7 +33,9 @@ namespace internal {
 /// neighbour operation is required.
 /// template parameters
 /// \tparam T is the pixel type for the local memory
-template <typename T>
+/// \tparam Interior whether or not the accesses are known to be inside the
+/// local memory, in which case they are not clamped
+template <typename T, bool Interior = false>
 struct LocalNeighbour {
  public:
   using PixelType = T;
@@ -59,9 +61,11 @@ struct LocalNeighbour {
   /// \param r: row index
   /// \return PixelType
   inline PixelType at(int c, int r) const {
-    c = (c >= 0 ? c : 0);
-    r = (r >= 0 ? r : 0);
-    return ptr[calculate_index(c, r, cols, rows)];
+    if (!Interior) {
+      c = (c >= 0 ? c : 0);
+      r = (r >= 0 ? r : 0);
+    }
+    return ptr[calculate_index<Interior>(c, r, cols, rows)];
   }
   /// function at provides access to a specific Coordinate for a 1d buffer
   /// parameters:
@@ -87,9 +91,23 @@ struct GlobalNeighbour {
   size_t I_r;
   size_t cols;
   size_t rows;
+  /// the offset of the frame in the global memory
+  size_t frame;
+  /// the number of elements from a row to the next one
+  size_t pitch;
   cl::sycl::global_ptr<T> &ptr;
-  GlobalNeighbour(cl::sycl::global_ptr<T> &ptr, size_t colsArg, size_t rowsArg)
-      : I_c(0), I_r(0), cols(colsArg), rows(rowsArg), ptr(ptr) {}
+  GlobalNeighbour(cl::sycl::global_ptr<T> &ptr, size_t colsArg, size_t rowsArg,
+                  size_t frameArg = 0)
+      : GlobalNeighbour(ptr, colsArg, rowsArg, frameArg, colsArg) {}
+  GlobalNeighbour(cl::sycl::global_ptr<T> &ptr, size_t colsArg, size_t rowsArg,
+                  size_t frameArg, size_t pitchArg)
+      : I_c(0),
+        I_r(0),
+        cols(colsArg),
+        rows(rowsArg),
+        frame(frameArg),
+        pitch(pitchArg),
+        ptr(ptr) {}
   /// function set_offset:
   /// \brief used to set the global memory offset for each global thread
   /// function parameters:
@@ -108,13 +126,13 @@ struct GlobalNeighbour {
   inline PixelType at(int c, int r) const {
     c = (c >= 0 ? c : 0);
     r = (r >= 0 ? r : 0);
-    return ptr[calculate_index(c, r, cols, rows)];
+    return ptr[calculate_index(c, r, cols, rows, pitch) + frame];
   }
   /// function at provides access to a specific coordinate for a 1d buffer
   /// parameters:
   /// \param c:  index
   /// \return PixelType
-  inline PixelType at(int c) const { return ptr[c]; }
+  inline PixelType at(int c) const { return ptr[c + frame]; }
 };
 /// \struct ConstNeighbour
 /// \brief ConstNeighbour is used to provide global access to the constant
@@ -123,9 +141,17 @@ struct GlobalNeighbour {
 /// filter node for convolution operation.
 /// template parameters
 /// \tparam T is the pixel type for the constant memory
-template <typename T>
+/// \tparam FilterCols is the column size of the constant memory when it is
+/// known at compile time, otherwise 0
+/// \tparam FilterRows is the row size of the constant memory when it is known
+/// at compile time, otherwise 0
+template <typename T, size_t FilterCols = 0, size_t FilterRows = 0>
 struct ConstNeighbour {
   using PixelType = T;
+  /// the compile time extent, so that the loops of a functor over the filter
+  /// can be unrolled
+  static constexpr size_t Cols = FilterCols;
+  static constexpr size_t Rows = FilterRows;
   cl::sycl::constant_ptr<T> &ptr;
   size_t cols;
   size_t rows;
@@ -139,7 +165,8 @@ struct ConstNeighbour {
   inline PixelType at(int c, int r) const {
     c = (c >= 0 ? c : 0);
     r = (r >= 0 ? r : 0);
-    return ptr[calculate_index(c, r, cols, rows)];
+    return ptr[calculate_index(c, r, FilterCols ? FilterCols : cols,
+                               FilterRows ? FilterRows : rows)];
   }
   /// function at provides access to an specific Coordinate for a 1d buffer
   /// parameters:
@@ -33,9 +33,8 @@ namespace internal {
 /// template parameters:
 /// \tparam Conds: determines whether or not the local variable should be used
 /// \tparam LDSize : determines the local dimension size
-/// \tparam GDSize: determines the global dimension size
 /// \tparam T determines the type of the dimension index
-template <bool Conds, size_t LDSize, size_t GDSize, typename T>
+template <bool Conds, size_t LDSize, typename T>
 struct CompareIdBasedScope {
   /// function get
   /// \brief returns the local range check:
@@ -43,27 +42,30 @@ struct CompareIdBasedScope {
   /// \param g is the global dimension size
   /// \param i is the offset needed to be added to the local dimension
   /// before comparison
+  /// \param gdSize is the global dimension size
   /// \return bool
-  static inline bool get(T &l, int &i, T &g) { return (l + i < LDSize); }
+  static inline bool get(T &l, int &i, T &g, size_t gdSize) {
+    return (l + i < LDSize);
+  }
 };
 
 /// \brief specialisation of the CompareIdBasedScope when the Conds is false in
 /// this case the range check is with the global size
 /// template parameters:
 /// \tparam LDSize : determines the local dimension size
-/// \tparam GDSize: determines the global dimension size
 /// \tparam T: determines the type of the dimension index
-template <size_t LDSize, size_t GDSize, typename T>
-struct CompareIdBasedScope<false, LDSize, GDSize, T> {
+template <size_t LDSize, typename T>
+struct CompareIdBasedScope<false, LDSize, T> {
   /// function get
   /// \brief returns the global range check:
   /// \param l is the local dimension size
   /// \param g is the global dimension size
   /// \param i is the offset needed to be added to the global dimension
   /// before comparison
+  /// \param gdSize is the global dimension size
   /// return bool
-  static inline bool get(T &l, int &i, T &g) {
-    return ((l + i < LDSize) && (g + i < GDSize));
+  static inline bool get(T &l, int &i, T &g, size_t gdSize) {
+    return ((l + i < LDSize) && (g + i < gdSize));
   }
 };
 /// function get_compare
@@ -71,17 +73,18 @@ struct CompareIdBasedScope<false, LDSize, GDSize, T> {
 /// template parameters:
 /// \tparam Conds: determines whether or not the local variable should be used
 /// \tparam LDSize : determines the local dimension size
-/// \tparam GDSize: determines the global dimension size
 /// \tparam T: determines the type of the dimension index
 /// function parameters:
 /// \param l is the local dimension size
 /// \param g is the global dimension size
 /// \param i is the offset needed to be added to the correct dimension
 /// before comparison
+/// \param gdSize is the global dimension size. It is the compile-time size of
+/// the node unless the expression is executed with a runtime size.
 /// return bool
-template <bool Conds, size_t LDSize, size_t GDSize, typename T>
-static inline bool get_compare(T l, int i, T g) {
-  return CompareIdBasedScope<Conds, LDSize, GDSize, T>::get(l, i, g);
+template <bool Conds, size_t LDSize, typename T>
+static inline bool get_compare(T l, int i, T g, size_t gdSize) {
+  return CompareIdBasedScope<Conds, LDSize, T>::get(l, i, g, gdSize);
 }
 
 /// \struct GetIdBasedScope
@@ -125,6 +128,21 @@ static inline T id_val(T l, T g) {
   return GetIdBasedScope<Conds, T>::get(l, g);
 }
 
+/// function get_ratio_range
+/// \brief returns the number of work-items per dimension of a work-group that
+/// write the output of a node whose output is Ratio times smaller than its
+/// input. The result is never less than one so that a work-group narrower than
+/// the ratio (e.g. a single work-item tile) still covers its whole tile.
+/// template parameters:
+/// \tparam Ratio: the ratio between the input and the output size
+/// function parameters:
+/// \param lRng: the local range of the work-group in that dimension
+/// \return size_t
+template <size_t Ratio>
+static inline size_t get_ratio_range(size_t lRng) {
+  return (lRng < Ratio) ? 1 : lRng / Ratio;
+}
+
 /// \struct MemoryTrait
 /// \brief This class is used to determine the ElementType of accessor
 /// template parameters
@@ -140,6 +158,23 @@ struct MemoryTrait<memory_type::Host, T> {
   using Type = typename tools::RemoveAll<T>::Type;
 };
 
+/// function calculate_index
+/// \brief this function is used to calculate the index access of the memory
+/// pointer on the device when the rows are pitch elements apart.
+/// parameters:
+/// \param c :  column index
+/// \param r : row index
+/// \param cols :  column dimension
+/// \param rows :  row dimension
+/// \param pitch :  the number of elements from a row to the next one
+/// \return size_t
+static inline size_t calculate_index(size_t c, size_t r, size_t cols,
+                                     size_t rows, size_t pitch) {
+  return (((r * pitch) + c) < (pitch * (rows - 1)) + cols)
+             ? ((r * pitch) + c)
+             : (pitch * (rows - 1)) + cols - 1;
+}
+
 /// function calculate_index
 /// \brief this function is used to calculate the index access of the memory
 /// pointer on the device.
@@ -151,8 +186,61 @@ struct MemoryTrait<memory_type::Host, T> {
 /// \return size_t
 static inline size_t calculate_index(size_t c, size_t r, size_t cols,
                                      size_t rows) {
-  return (((r * cols) + c) < cols * rows) ? ((r * cols) + c)
-                                          : (cols * rows) - 1;
+  return calculate_index(c, r, cols, rows, cols);
+}
+
+/// function calculate_index
+/// \brief this function is used to calculate the index access of the memory
+/// pointer on the device. When Interior is true, the access is known to be
+/// inside the memory and the index is not clamped.
+/// template parameters:
+/// \tparam Interior: whether or not the tile of the work-item is an interior
+/// tile
+/// parameters:
+/// \param c :  column index
+/// \param r : row index
+/// \param cols :  column dimension
+/// \param rows :  row dimension
+/// \param pitch :  the number of elements from a row to the next one
+/// \return size_t
+template <bool Interior>
+static inline size_t calculate_index(size_t c, size_t r, size_t cols,
+                                     size_t rows, size_t pitch) {
+  return Interior ? (r * pitch) + c : calculate_index(c, r, cols, rows, pitch);
+}
+
+/// function calculate_index
+/// \brief this function is used to calculate the index access of the memory
+/// pointer on the device, without clamping it when Interior is true.
+/// template parameters:
+/// \tparam Interior: whether or not the tile of the work-item is an interior
+/// tile
+/// parameters:
+/// \param c :  column index
+/// \param r : row index
+/// \param cols :  column dimension
+/// \param rows :  row dimension
+/// \return size_t
+template <bool Interior>
+static inline size_t calculate_index(size_t c, size_t r, size_t cols,
+                                     size_t rows) {
+  return calculate_index<Interior>(c, r, cols, rows, cols);
+}
+
+/// function row_pitch
+/// \brief returns the number of elements from a row of a memory to the next
+/// one. The rows of a memory are contiguous unless it is a Pitched2D memory.
+/// parameters:
+/// \param cols : the column size of the memory
+/// \return size_t
+template <typename Acc>
+static inline size_t row_pitch(const Acc &, size_t cols) {
+  return cols;
+}
+/// \brief specialisation of the row_pitch for a Pitched2D memory
+template <typename Acc>
+static inline size_t row_pitch(const PitchedAccessor<Acc> &acc, size_t) {
+  return acc.pitch;
 }
 }  // internal
 }  // visioncpp
@@ -86,6 +86,26 @@ struct Convertor<cl::sycl::float4> {
                             static_cast<float>(t[2]), static_cast<float>(t[3]));
   }
 
+  /// function convert
+  /// \brief Convert the F16C3 input type to the cl::sycl::float4 output type.
+  /// parameters:
+  /// \param t  input type to be converted
+  /// \return float4
+  static inline cl::sycl::float4 convert(visioncpp::pixel::F16C3 t) {
+    return cl::sycl::float4(static_cast<float>(t[0]), static_cast<float>(t[1]),
+                            static_cast<float>(t[2]), 0.0f);
+  }
+
+  /// function convert
+  /// \brief Convert the F16C4 input type to the cl::sycl::float4 output type.
+  /// parameters:
+  /// \param t  input type to be converted
+  /// \return float4
+  static inline cl::sycl::float4 convert(visioncpp::pixel::F16C4 t) {
+    return cl::sycl::float4(static_cast<float>(t[0]), static_cast<float>(t[1]),
+                            static_cast<float>(t[2]), static_cast<float>(t[3]));
+  }
+
   /// function convert
   /// \brief Convert the float input type to the cl::sycl::float4 output type.
   /// parameters:
@@ -138,6 +158,26 @@ struct Convertor<cl::sycl::int4> {
                           static_cast<int>(t[2]), static_cast<int>(t[3]));
   }
 
+  /// function convert
+  /// \brief Convert the S16C3 input type to the cl::sycl::int4 output type.
+  /// parameters:
+  /// \param t  input type to be converted
+  /// \return int4
+  static inline cl::sycl::int4 convert(visioncpp::pixel::S16C3 t) {
+    return cl::sycl::int4(static_cast<int>(t[0]), static_cast<int>(t[1]),
+                          static_cast<int>(t[2]), 0);
+  }
+
+  /// function convert
+  /// \brief Convert the S16C4 input type to the cl::sycl::int4 output type.
+  /// parameters:
+  /// \param t  input type to be converted
+  /// \return int4
+  static inline cl::sycl::int4 convert(visioncpp::pixel::S16C4 t) {
+    return cl::sycl::int4(static_cast<int>(t[0]), static_cast<int>(t[1]),
+                          static_cast<int>(t[2]), static_cast<int>(t[3]));
+  }
+
   /// function convert
   /// \brief Convert the int input type to the cl::sycl::int4 output type.
   /// parameters:
@@ -194,6 +234,28 @@ struct Convertor<cl::sycl::uint4> {
         static_cast<unsigned int>(t[2]), static_cast<unsigned int>(t[3]));
   }
 
+  /// function convert
+  /// \brief Convert the U16C3 input type to the cl::sycl::uint4 output type.
+  /// parameters:
+  /// \param t  input type to be converted
+  /// \return uint4
+  static inline cl::sycl::uint4 convert(visioncpp::pixel::U16C3 t) {
+    return cl::sycl::uint4(static_cast<unsigned int>(t[0]),
+                           static_cast<unsigned int>(t[1]),
+                           static_cast<unsigned int>(t[2]), 0);
+  }
+
+  /// function convert
+  /// \brief Convert the U16C4 input type to the cl::sycl::uint4 output type.
+  /// parameters:
+  /// \param t  input type to be converted
+  /// \return uint4
+  static inline cl::sycl::uint4 convert(visioncpp::pixel::U16C4 t) {
+    return cl::sycl::uint4(
+        static_cast<unsigned int>(t[0]), static_cast<unsigned int>(t[1]),
+        static_cast<unsigned int>(t[2]), static_cast<unsigned int>(t[3]));
+  }
+
   /// function convert
   /// \brief Convert the unsigned int input type to the cl::sycl::uint4 output
   /// type.
@@ -235,6 +297,17 @@ struct Convertor<visioncpp::pixel::F32C3> {
     return t;
   }
 
+  /// function convert
+  /// \brief Convert the F16C3 input type to the F32C3 output type.
+  /// parameters:
+  /// \param t  input type to be converted
+  /// \return F32C3
+  static inline visioncpp::pixel::F32C3 convert(visioncpp::pixel::F16C3 t) {
+    return visioncpp::pixel::F32C3(static_cast<float>(t[0]),
+                                   static_cast<float>(t[1]),
+                                   static_cast<float>(t[2]));
+  }
+
   /// function convert
   /// \brief Convert the cl::sycl::int4 input type to the F32C3 output type.
   /// parameters:
@@ -287,6 +360,17 @@ struct Convertor<visioncpp::pixel::F32C4> {
     return t;
   }
 
+  /// function convert
+  /// \brief Convert the F16C4 input type to the F32C4 output type.
+  /// parameters:
+  /// \param t  input type to be converted
+  /// \return F32C4
+  static inline visioncpp::pixel::F32C4 convert(visioncpp::pixel::F16C4 t) {
+    return visioncpp::pixel::F32C4(
+        static_cast<float>(t[0]), static_cast<float>(t[1]),
+        static_cast<float>(t[2]), static_cast<float>(t[3]));
+  }
+
   /// function convert
   /// \brief Convert the cl::sycl::int4 input type to the F32C4 output type.
   /// parameters:
@@ -422,6 +506,224 @@ struct Convertor<visioncpp::pixel::U8C4> {
         static_cast<unsigned char>(t.z()), static_cast<unsigned char>(t.w()));
   }
 };
+/// \brief specialisation of the Convertor when the output is F16C3
+template <>
+struct Convertor<visioncpp::pixel::F16C3> {
+  /// function convert
+  /// \brief Convert the cl::sycl::float4 input type to the F16C3 output type.
+  /// parameters:
+  /// \param t  input type to be converted
+  /// \return F16C3
+  static inline visioncpp::pixel::F16C3 convert(cl::sycl::float4 t) {
+    return visioncpp::pixel::F16C3(static_cast<cl::sycl::half>(t.x()),
+                                   static_cast<cl::sycl::half>(t.y()),
+                                   static_cast<cl::sycl::half>(t.z()));
+  }
+
+  /// function convert
+  /// \brief Returns the F16C3 input type.
+  /// parameters:
+  /// \param t  input type to be converted
+  /// \return F16C3
+  static inline visioncpp::pixel::F16C3 convert(visioncpp::pixel::F16C3 t) {
+    return t;
+  }
+
+  /// function convert
+  /// \brief Convert the F32C3 input type to the F16C3 output type.
+  /// parameters:
+  /// \param t  input type to be converted
+  /// \return F16C3
+  static inline visioncpp::pixel::F16C3 convert(visioncpp::pixel::F32C3 t) {
+    return visioncpp::pixel::F16C3(static_cast<cl::sycl::half>(t[0]),
+                                   static_cast<cl::sycl::half>(t[1]),
+                                   static_cast<cl::sycl::half>(t[2]));
+  }
+
+  /// function convert
+  /// \brief Convert the cl::sycl::half input type to the F16C3 output type.
+  /// parameters:
+  /// \param t  input type to be converted
+  /// \return F16C3
+  static inline visioncpp::pixel::F16C3 convert(cl::sycl::half t) {
+    return visioncpp::pixel::F16C3(t, t, t);
+  }
+};
+/// \brief specialisation of the Convertor when the output is F16C4
+template <>
+struct Convertor<visioncpp::pixel::F16C4> {
+  /// function convert
+  /// \brief Convert the cl::sycl::float4 input type to the F16C4 output type.
+  /// parameters:
+  /// \param t  input type to be converted
+  /// \return F16C4
+  static inline visioncpp::pixel::F16C4 convert(cl::sycl::float4 t) {
+    return visioncpp::pixel::F16C4(static_cast<cl::sycl::half>(t.x()),
+                                   static_cast<cl::sycl::half>(t.y()),
+                                   static_cast<cl::sycl::half>(t.z()),
+                                   static_cast<cl::sycl::half>(t.w()));
+  }
+
+  /// function convert
+  /// \brief Returns the F16C4 input type.
+  /// parameters:
+  /// \param t  input type to be converted
+  /// \return F16C4
+  static inline visioncpp::pixel::F16C4 convert(visioncpp::pixel::F16C4 t) {
+    return t;
+  }
+
+  /// function convert
+  /// \brief Convert the F32C4 input type to the F16C4 output type.
+  /// parameters:
+  /// \param t  input type to be converted
+  /// \return F16C4
+  static inline visioncpp::pixel::F16C4 convert(visioncpp::pixel::F32C4 t) {
+    return visioncpp::pixel::F16C4(static_cast<cl::sycl::half>(t[0]),
+                                   static_cast<cl::sycl::half>(t[1]),
+                                   static_cast<cl::sycl::half>(t[2]),
+                                   static_cast<cl::sycl::half>(t[3]));
+  }
+
+  /// function convert
+  /// \brief Convert the cl::sycl::half input type to the F16C4 output type.
+  /// parameters:
+  /// \param t  input type to be converted
+  /// \return F16C4
+  static inline visioncpp::pixel::F16C4 convert(cl::sycl::half t) {
+    return visioncpp::pixel::F16C4(t, t, t, t);
+  }
+};
+/// \brief specialisation of the Convertor when the output is U16C3
+template <>
+struct Convertor<visioncpp::pixel::U16C3> {
+  /// function convert
+  /// \brief Convert the cl::sycl::uint4 input type to the U16C3 output type.
+  /// parameters:
+  /// \param t  input type to be converted
+  /// \return U16C3
+  static inline visioncpp::pixel::U16C3 convert(cl::sycl::uint4 t) {
+    return visioncpp::pixel::U16C3(static_cast<unsigned short>(t.x()),
+                                   static_cast<unsigned short>(t.y()),
+                                   static_cast<unsigned short>(t.z()));
+  }
+
+  /// function convert
+  /// \brief Returns the U16C3 input type.
+  /// parameters:
+  /// \param t  input type to be converted
+  /// \return U16C3
+  static inline visioncpp::pixel::U16C3 convert(visioncpp::pixel::U16C3 t) {
+    return t;
+  }
+
+  /// function convert
+  /// \brief Convert the unsigned short input type to the U16C3 output type.
+  /// parameters:
+  /// \param t  input type to be converted
+  /// \return U16C3
+  static inline visioncpp::pixel::U16C3 convert(unsigned short t) {
+    return visioncpp::pixel::U16C3(t, t, t);
+  }
+};
+/// \brief specialisation of the Convertor when the output is U16C4
+template <>
+struct Convertor<visioncpp::pixel::U16C4> {
+  /// function convert
+  /// \brief Convert the cl::sycl::uint4 input type to the U16C4 output type.
+  /// parameters:
+  /// \param t  input type to be converted
+  /// \return U16C4
+  static inline visioncpp::pixel::U16C4 convert(cl::sycl::uint4 t) {
+    return visioncpp::pixel::U16C4(static_cast<unsigned short>(t.x()),
+                                   static_cast<unsigned short>(t.y()),
+                                   static_cast<unsigned short>(t.z()),
+                                   static_cast<unsigned short>(t.w()));
+  }
+
+  /// function convert
+  /// \brief Returns the U16C4 input type.
+  /// parameters:
+  /// \param t  input type to be converted
+  /// \return U16C4
+  static inline visioncpp::pixel::U16C4 convert(visioncpp::pixel::U16C4 t) {
+    return t;
+  }
+
+  /// function convert
+  /// \brief Convert the unsigned short input type to the U16C4 output type.
+  /// parameters:
+  /// \param t  input type to be converted
+  /// \return U16C4
+  static inline visioncpp::pixel::U16C4 convert(unsigned short t) {
+    return visioncpp::pixel::U16C4(t, t, t, t);
+  }
+};
+/// \brief specialisation of the Convertor when the output is S16C3
+template <>
+struct Convertor<visioncpp::pixel::S16C3> {
+  /// function convert
+  /// \brief Convert the cl::sycl::int4 input type to the S16C3 output type.
+  /// parameters:
+  /// \param t  input type to be converted
+  /// \return S16C3
+  static inline visioncpp::pixel::S16C3 convert(cl::sycl::int4 t) {
+    return visioncpp::pixel::S16C3(static_cast<short>(t.x()),
+                                   static_cast<short>(t.y()),
+                                   static_cast<short>(t.z()));
+  }
+
+  /// function convert
+  /// \brief Returns the S16C3 input type.
+  /// parameters:
+  /// \param t  input type to be converted
+  /// \return S16C3
+  static inline visioncpp::pixel::S16C3 convert(visioncpp::pixel::S16C3 t) {
+    return t;
+  }
+
+  /// function convert
+  /// \brief Convert the short input type to the S16C3 output type.
+  /// parameters:
+  /// \param t  input type to be converted
+  /// \return S16C3
+  static inline visioncpp::pixel::S16C3 convert(short t) {
+    return visioncpp::pixel::S16C3(t, t, t);
+  }
+};
+/// \brief specialisation of the Convertor when the output is S16C4
+template <>
+struct Convertor<visioncpp::pixel::S16C4> {
+  /// function convert
+  /// \brief Convert the cl::sycl::int4 input type to the S16C4 output type.
+  /// parameters:
+  /// \param t  input type to be converted
+  /// \return S16C4
+  static inline visioncpp::pixel::S16C4 convert(cl::sycl::int4 t) {
+    return visioncpp::pixel::S16C4(static_cast<short>(t.x()),
+                                   static_cast<short>(t.y()),
+                                   static_cast<short>(t.z()),
+                                   static_cast<short>(t.w()));
+  }
+
+  /// function convert
+  /// \brief Returns the S16C4 input type.
+  /// parameters:
+  /// \param t  input type to be converted
+  /// \return S16C4
+  static inline visioncpp::pixel::S16C4 convert(visioncpp::pixel::S16C4 t) {
+    return t;
+  }
+
+  /// function convert
+  /// \brief Convert the short input type to the S16C4 output type.
+  /// parameters:
+  /// \param t  input type to be converted
+  /// \return S16C4
+  static inline visioncpp::pixel::S16C4 convert(short t) {
+    return visioncpp::pixel::S16C4(t, t, t, t);
+  }
+};
 /// \brief specialisation of the Convertor when the output is unsigned char
 template <>
 struct Convertor<unsigned char> {
@@ -546,6 +848,28 @@ struct Convertor<float> {
   static inline float convert(float t) { return t; }
 };
 
+/// \brief specialisation of the Convertor when the output is cl::sycl::half
+template <>
+struct Convertor<cl::sycl::half> {
+  /// function convert
+  /// \brief Convert the cl::sycl::float4 input type to the cl::sycl::half
+  /// output type.
+  /// parameters:
+  /// \param t  input type needed to be converted
+  /// \return cl::sycl::half
+  static inline cl::sycl::half convert(cl::sycl::float4 t) {
+    return static_cast<cl::sycl::half>(t.x());
+  }
+
+  /// function convert
+  /// \brief Returns the cl::sycl::half input type. A float input is narrowed
+  /// to half.
+  /// parameters:
+  /// \param t  input type needed to be converted
+  /// \return cl::sycl::half
+  static inline cl::sycl::half convert(cl::sycl::half t) { return t; }
+};
+
 /// function convert
 /// \brief template deduction for Convertor struct
 /// template parameters
@@ -27,6 +27,7 @@
 #include "convert.hpp"
 #include "static_if.hpp"
 #include "time.hpp"
+#include "trace.hpp"
 #include "tuple.hpp"
 #include "type_dereferencer.hpp"
 #endif  // VISIONCPP_INCLUDE_FRAMEWORK_TOOLS_TOOLS_HPP_
@@ -0,0 +1,275 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file trace.hpp
+/// \brief This file contains the tracer writing a timeline of the host side of
+/// the library (memory creations, transfers, kernel submissions and waits) in
+/// the JSON format of chrome://tracing.
+
+#ifndef VISIONCPP_INCLUDE_FRAMEWORK_TOOLS_TRACE_HPP_
+#define VISIONCPP_INCLUDE_FRAMEWORK_TOOLS_TRACE_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace visioncpp {
+namespace internal {
+/// \class TraceLog
+/// \brief TraceLog is the process-wide list of the events of the tracer. The
+/// memories of the library are created before any device is known, so the
+/// log is not owned by a device. It only records events between trace::start
+/// and trace::stop, and costs one atomic load otherwise.
+class TraceLog {
+ public:
+  /// \brief one event of the timeline
+  struct Event {
+    std::string name;
+    const char *cat;
+    /// the phase of the event: 'X' for a scope, 'i' for an instant
+    char ph;
+    /// the start time and duration in microseconds
+    double ts;
+    double dur;
+    size_t tid;
+    /// the arguments of the event, already written as JSON members
+    std::string args;
+  };
+
+ private:
+  std::atomic<bool> on;
+  std::mutex lock;
+  std::string file;
+  /// the start of the timeline, in ticks of the steady clock. It is read by
+  /// now() without the lock while start may be setting it.
+  std::atomic<std::chrono::steady_clock::rep> origin;
+  std::vector<Event> events;
+  std::map<std::thread::id, size_t> threads;
+
+  TraceLog() : on(false), origin(0) {}
+
+  /// \brief escapes a string written in the JSON file
+  static std::string escape(const std::string &s) {
+    std::string out;
+    for (char c : s) {
+      if (c == '"' || c == '\\') {
+        out += '\\';
+      }
+      out += c;
+    }
+    return out;
+  }
+
+ public:
+  /// \brief returns the log of the process
+  static TraceLog &get() {
+    static TraceLog log;
+    return log;
+  }
+
+  /// \brief returns whether the events are being recorded
+  bool enabled() const { return on.load(std::memory_order_acquire); }
+
+  /// \brief returns the current time of the timeline in microseconds
+  double now() const {
+    return std::chrono::duration<double, std::micro>(
+               std::chrono::steady_clock::now().time_since_epoch() -
+               std::chrono::steady_clock::duration(
+                   origin.load(std::memory_order_relaxed)))
+        .count();
+  }
+
+  /// \brief starts recording; the file is written by stop
+  /// \param path: the JSON file receiving the timeline
+  void start(const std::string &path) {
+    std::lock_guard<std::mutex> guard(lock);
+    file = path;
+    events.clear();
+    threads.clear();
+    origin.store(std::chrono::steady_clock::now().time_since_epoch().count(),
+                 std::memory_order_relaxed);
+    on.store(true, std::memory_order_release);
+  }
+
+  /// \brief records an event
+  void add(std::string name, const char *cat, char ph, double ts, double dur,
+           std::string args = std::string()) {
+    std::lock_guard<std::mutex> guard(lock);
+    if (!on) {
+      return;
+    }
+    auto tid = threads.emplace(std::this_thread::get_id(), threads.size());
+    events.push_back(Event{std::move(name), cat, ph, ts, dur,
+                           tid.first->second, std::move(args)});
+  }
+
+  /// \brief stops recording and writes the timeline to the file given to
+  /// start
+  /// \return bool: false when the file cannot be written
+  bool stop() {
+    std::lock_guard<std::mutex> guard(lock);
+    if (!on) {
+      return false;
+    }
+    on = false;
+    std::ofstream os(file);
+    os << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    char times[96];
+    for (size_t i = 0; i < events.size(); i++) {
+      const auto &e = events[i];
+      std::snprintf(times, sizeof(times), "\"ts\":%.3f,\"dur\":%.3f", e.ts,
+                    e.dur);
+      os << (i ? ",\n" : "\n") << "{\"name\":\"" << escape(e.name)
+         << "\",\"cat\":\"" << e.cat << "\",\"ph\":\"" << e.ph << "\","
+         << times << ",\"pid\":0,\"tid\":" << e.tid
+         << (e.ph == 'i' ? ",\"s\":\"g\"" : "") << ",\"args\":{" << e.args
+         << "}}";
+    }
+    os << "\n]}\n";
+    events.clear();
+    return static_cast<bool>(os);
+  }
+};
+
+/// \class TraceScope
+/// \brief TraceScope records the time between its construction and its
+/// destruction as one event of the timeline, when the tracer is enabled.
+class TraceScope {
+ private:
+  const char *cat;
+  std::string name;
+  std::string args;
+  double start;
+
+ protected:
+  bool on;
+
+  /// \brief creates a scope whose name is given later by begin, so a derived
+  /// scope builds it only when the tracer is enabled
+  explicit TraceScope(const char *c) : cat(c), on(TraceLog::get().enabled()) {}
+
+  /// \brief starts the event of a scope created without a name
+  void begin(std::string n, std::string a) {
+    name = std::move(n);
+    args = std::move(a);
+    start = TraceLog::get().now();
+  }
+
+ public:
+  /// \param c: the category of the event (e.g. "kernel", "transfer")
+  /// \param n: the name of the event
+  /// \param bytes: the size of the memory created or moved, if any
+  TraceScope(const char *c, const char *n, size_t bytes = 0)
+      : cat(c), on(TraceLog::get().enabled()) {
+    if (on) {
+      name = n;
+      if (bytes) {
+        args = "\"bytes\":" + std::to_string(bytes);
+      }
+      start = TraceLog::get().now();
+    }
+  }
+
+  /// \param c: the category of the event
+  /// \param n: the name of the event
+  /// \param a: the arguments of the event, written as JSON members
+  TraceScope(const char *c, std::string n, std::string a)
+      : cat(c), on(TraceLog::get().enabled()) {
+    if (on) {
+      begin(std::move(n), std::move(a));
+    }
+  }
+
+  TraceScope(const TraceScope &) = delete;
+  TraceScope &operator=(const TraceScope &) = delete;
+
+  ~TraceScope() {
+    if (on) {
+      auto &log = TraceLog::get();
+      log.add(std::move(name), cat, 'X', start, log.now() - start,
+              std::move(args));
+    }
+  }
+};
+}  // internal
+
+/// \brief the tracer of the library. The events recorded are the creation of
+/// the memories, the transfers between the host and the device (reset_input,
+/// read_output, lock, unlock, set_output), the kernel submissions, the host
+/// waits and the execute calls around them. Frames mark the iterations of a
+/// streaming loop:
+/// \code
+///   visioncpp::trace::start("run.json");
+///   for (size_t i = 0; i < frames; i++) {
+///     visioncpp::trace::Frame frame(i);
+///     pipeline.run(in, out);
+///   }
+///   visioncpp::trace::stop();
+/// \endcode
+/// The file can be opened in chrome://tracing. On the sycl backend a kernel
+/// event is its submission; the time spent on the device is given by the
+/// Profiler of the device.
+namespace trace {
+/// \brief starts recording the events of the library
+/// \param file: the JSON file written by stop
+/// \return void
+inline void start(const std::string &file) {
+  internal::TraceLog::get().start(file);
+}
+
+/// \brief stops recording and writes the file given to start
+/// \return bool: false when the tracer was not started or the file cannot be
+/// written
+inline bool stop() { return internal::TraceLog::get().stop(); }
+
+/// \brief returns whether the tracer is recording
+inline bool enabled() { return internal::TraceLog::get().enabled(); }
+
+/// \brief records an instant event, e.g. a frame being dropped
+/// \param name: the name of the event
+/// \return void
+inline void mark(const std::string &name) {
+  auto &log = internal::TraceLog::get();
+  if (log.enabled()) {
+    log.add(name, "mark", 'i', log.now(), 0);
+  }
+}
+
+/// \class Frame
+/// \brief a scope marking one iteration of a streaming loop. Its name is only
+/// built when the tracer is enabled.
+class Frame : public internal::TraceScope {
+ public:
+  /// \param index: the number of the frame
+  explicit Frame(size_t index) : internal::TraceScope("frame") {
+    if (on) {
+      begin("frame " + std::to_string(index),
+            "\"frame\":" + std::to_string(index));
+    }
+  }
+};
+}  // trace
+}  // visioncpp
+#endif  // VISIONCPP_INCLUDE_FRAMEWORK_TOOLS_TRACE_HPP_
@@ -0,0 +1,36 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file OP_F32C3ToU16C3.hpp
+/// \brief it converts F32C3 pixel to U16C3 pixel
+
+namespace visioncpp {
+/// \brief This functor performs conversion from [0.0f, 1.0f] to [0, 65535]
+struct OP_F32C3ToU16C3 {
+  /// \param in - three-channel float
+  /// \return U16C3 - three-channel unsigned short
+  visioncpp::pixel::U16C3 operator()(visioncpp::pixel::F32C3 in) {
+    const float FLOAT_TO_WORD = 65535.0f;
+    return visioncpp::pixel::U16C3(
+        static_cast<unsigned short>(in[0] * FLOAT_TO_WORD),
+        static_cast<unsigned short>(in[1] * FLOAT_TO_WORD),
+        static_cast<unsigned short>(in[2] * FLOAT_TO_WORD));
+  }
+};
+}
@@ -32,5 +32,19 @@ struct OP_F32C3ToU8C3 {
         static_cast<unsigned char>(in[1] * FLOAT_TO_BYTE),
         static_cast<unsigned char>(in[2] * FLOAT_TO_BYTE));
   }
+  /// \brief converts a packet of pixels
+  /// \param in - packet of three-channel float
+  /// \param out - packet of three-channel unsigned char
+  template <size_t Width>
+  void packet(
+      const visioncpp::pixel::Packet<visioncpp::pixel::F32C3, Width> &in,
+      visioncpp::pixel::Packet<visioncpp::pixel::U8C3, Width> &out) {
+    const float FLOAT_TO_BYTE = 255.0f;
+    for (size_t i = 0; i < Width; i++) {
+      for (size_t c = 0; c < 3; c++) {
+        out[i][c] = static_cast<unsigned char>(in[i][c] * FLOAT_TO_BYTE);
+      }
+    }
+  }
 };
 }
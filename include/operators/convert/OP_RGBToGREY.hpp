@@ -32,5 +32,16 @@ struct OP_RGBToGREY {
     // luminance , the most accurate one
     return 0.299f * in[0] + 0.587f * in[1] + 0.114f * in[2];
   }
+  /// \brief converts a packet of pixels
+  /// \param in - packet of RGB pixels.
+  /// \param out - packet of greyscale values.
+  template <size_t Width>
+  void packet(
+      const visioncpp::pixel::Packet<visioncpp::pixel::F32C3, Width> &in,
+      visioncpp::pixel::Packet<float, Width> &out) {
+    for (size_t i = 0; i < Width; i++) {
+      out[i] = 0.299f * in[i][0] + 0.587f * in[i][1] + 0.114f * in[i][2];
+    }
+  }
 };
 }
@@ -0,0 +1,37 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// \file OP_U16C3ToF32C3.hpp
+/// \brief it converts U16C3 pixel to F32C3 pixel
+
+namespace visioncpp {
+/// \brief This functor performs conversion from [0, 65535] to [0.0f, 1.0f].
+/// The 10 or 12-bit data of a sensor can be scaled afterwards by OP_Scale.
+struct OP_U16C3ToF32C3 {
+  /// \param in - three-channel unsigned short
+  /// \return F32C3 - three-channel float
+  visioncpp::pixel::F32C3 operator()(visioncpp::pixel::U16C3 in) {
+    const float FLOAT_TO_WORD = 65535.0f;
+    const float WORD_TO_FLOAT = 1.0f / FLOAT_TO_WORD;
+    return visioncpp::pixel::F32C3(static_cast<float>(in[0] * WORD_TO_FLOAT),
+                                   static_cast<float>(in[1] * WORD_TO_FLOAT),
+                                   static_cast<float>(in[2] * WORD_TO_FLOAT));
+  }
+};
+}
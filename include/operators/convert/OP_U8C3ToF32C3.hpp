@@ -32,5 +32,19 @@ struct OP_U8C3ToF32C3 {
                                    static_cast<float>(in[1] * BYTE_TO_FLOAT),
                                    static_cast<float>(in[2] * BYTE_TO_FLOAT));
   }
+  /// \brief converts a packet of pixels
+  /// \param in - packet of three-channel unsigned char
+  /// \param out - packet of three-channel float
+  template <size_t Width>
+  void packet(
+      const visioncpp::pixel::Packet<visioncpp::pixel::U8C3, Width> &in,
+      visioncpp::pixel::Packet<visioncpp::pixel::F32C3, Width> &out) {
+    const float BYTE_TO_FLOAT = 1.0f / 255.0f;
+    for (size_t i = 0; i < Width; i++) {
+      for (size_t c = 0; c < 3; c++) {
+        out[i][c] = static_cast<float>(in[i][c]) * BYTE_TO_FLOAT;
+      }
+    }
+  }
 };
 }
@@ -24,11 +24,15 @@
 #define VISIONCPP_INCLUDE_OPERATORS_CONVERT_OPS_CONVERT_HPP_
 
 #include "OP_BGRToRGB.hpp"
+#include "OP_F16C3ToF32C3.hpp"
+#include "OP_F32C3ToF16C3.hpp"
+#include "OP_F32C3ToU16C3.hpp"
 #include "OP_F32C3ToU8C3.hpp"
 #include "OP_HSVToRGB.hpp"
 #include "OP_HSVToU8C3.hpp"
 #include "OP_RGBToBGR.hpp"
 #include "OP_RGBToGREY.hpp"
 #include "OP_RGBToHSV.hpp"
+#include "OP_U16C3ToF32C3.hpp"
 #include "OP_U8C3ToF32C3.hpp"
 #endif  // VISIONCPP_INCLUDE_OPERATORS_CONVERT_OPS_CONVERT_HPP_
\ No newline at end of file
@@ -32,8 +32,9 @@ struct OP_Filter2D {
   template <typename NeighbourT, typename FilterT>
   typename NeighbourT::PixelType operator()(NeighbourT& nbr, FilterT& fltr) {
     int i, i2, j, j2;
-    int hs_c = (fltr.cols / 2);
-    int hs_r = (fltr.rows / 2);
+    // the filter size is a constant, so the loops are unrolled
+    constexpr int hs_c = (FilterT::Cols / 2);
+    constexpr int hs_r = (FilterT::Rows / 2);
     typename NeighbourT::PixelType out{};
     for (i2 = -hs_c, i = 0; i2 <= hs_c; i2++, i++)
       for (j2 = -hs_r, j = 0; j2 <= hs_r; j2++, j++)
@@ -53,8 +54,9 @@ struct OP_Filter2D_One {
   template <typename NeighbourT, typename FilterT>
   float operator()(NeighbourT& nbr, FilterT& fltr) {
     int i, i2, j, j2;
-    int hs_c = (fltr.cols / 2);
-    int hs_r = (fltr.rows / 2);
+    // the filter size is a constant, so the loops are unrolled
+    constexpr int hs_c = (FilterT::Cols / 2);
+    constexpr int hs_r = (FilterT::Rows / 2);
     float out = 0;
     for (i2 = -hs_c, i = 0; i2 <= hs_c; i2++, i++)
       for (j2 = -hs_r, j = 0; j2 <= hs_r; j2++, j++)
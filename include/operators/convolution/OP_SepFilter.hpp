@@ -32,8 +32,9 @@ struct OP_SepFilterRow {
   template <typename NeighbourT, typename FilterT>
   typename NeighbourT::PixelType operator()(NeighbourT& nbr, FilterT& fltr) {
     int i, i2;
-    int hs_r = (fltr.rows / 2);
-    auto out = nbr.at(nbr.I_c, nbr.I_r - 1) * fltr.at(0, 0);
+    // the filter size is a constant, so the loop is unrolled
+    constexpr int hs_r = (FilterT::Rows / 2);
+    auto out = nbr.at(nbr.I_c, nbr.I_r - hs_r) * fltr.at(0, 0);
     for (i2 = -hs_r + 1, i = 1; i2 <= hs_r; i2++, i++) {
       out += nbr.at(nbr.I_c, nbr.I_r + i2) * fltr.at(0, i);
     }
@@ -50,8 +51,9 @@ struct OP_SepFilterCol {
   template <typename NeighbourT, typename FilterT>
   typename NeighbourT::PixelType operator()(NeighbourT& nbr, FilterT& fltr) {
     int i, i2;
-    int hs_c = (fltr.cols / 2);
-    auto out = nbr.at(nbr.I_c - 1, nbr.I_r) * fltr.at(0, 0);
+    // the filter size is a constant, so the loop is unrolled
+    constexpr int hs_c = (FilterT::Cols / 2);
+    auto out = nbr.at(nbr.I_c - hs_c, nbr.I_r) * fltr.at(0, 0);
     for (i2 = -hs_c + 1, i = 1; i2 <= hs_c; i2++, i++) {
       out += nbr.at(nbr.I_c + i2, nbr.I_r) * fltr.at(i, 0);
     }
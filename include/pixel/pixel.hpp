@@ -24,10 +24,14 @@
 /// {F/U/S}{SIZE_OF_CHANNEL}C{NUMBER_OF_CHANNELS} \n
 /// F32C4 - represents float[4] \n
 /// U8C3  - represents unsigned char[3] \n
+/// F16C1 - represents cl::sycl::half[1] \n
+/// S16C2 - represents short[2] \n
 
 #ifndef VISIONCPP_INCLUDE_PIXEL_PIXEL_HPP_
 #define VISIONCPP_INCLUDE_PIXEL_PIXEL_HPP_
 
+#include <type_traits>
+
 #include "../framework/tools/tuple.hpp"
 
 namespace visioncpp {
@@ -49,37 +53,63 @@ struct AssignValueToArray<false, K, PixelType, Params...> {
   static void avta(PixelType &dt,
                    visioncpp::internal::tools::tuple::Tuple<Params...> &t) {}
 };
+
+/// \brief checks that each of the Params can be converted to the channel type
+/// Scalar. It keeps a pixel from being built out of another pixel type, so
+/// that the pixel conversions are left to the Convertor.
+template <typename Scalar, typename... Params>
+struct ChannelsConvertible : std::true_type {};
+
+template <typename Scalar, typename Param, typename... Params>
+struct ChannelsConvertible<Scalar, Param, Params...>
+    : std::integral_constant<
+          bool, std::is_convertible<Param, Scalar>::value &&
+                    ChannelsConvertible<Scalar, Params...>::value> {};
 }  // namespace internal
 /// \brief Contains VisionCpp pixel type definitions.
 namespace pixel {
-#define REGISTER_OPERATORS(Op, T)             \
-  template <typename RHSScalar>               \
-  T &operator Op##=(const RHSScalar &val) {   \
-    for (int i = 0; i < elements; i++) {      \
-      m_data[i] Op## = val;                   \
-    }                                         \
-    return *this;                             \
-  }                                           \
-  T &operator Op##=(const T &val) {           \
-    for (int i = 0; i < elements; i++) {      \
-      m_data[i] Op## = val[i];                \
-    }                                         \
-    return *this;                             \
-  }                                           \
-  friend T operator Op(T lhs, const T &rhs) { \
-    for (int i = 0; i < elements; i++) {      \
-      lhs[i] Op## = rhs[i];                   \
-    }                                         \
-    return lhs;                               \
+/// The operators taking a scalar apply it to each of the channels. They only
+/// accept the arithmetic types, as an unconstrained template conflicts with
+/// the operator overloads from computecpp 0.5. Without them the scalar would
+/// be converted to a pixel holding it in its first channel only.
+#define REGISTER_OPERATORS(Op, T)                                     \
+  template <typename RHSScalar>                                       \
+  T &operator Op##=(const RHSScalar &val) {                           \
+    for (int i = 0; i < elements; i++) {                              \
+      m_data[i] Op## = val;                                           \
+    }                                                                 \
+    return *this;                                                     \
+  }                                                                   \
+  T &operator Op##=(const T &val) {                                   \
+    for (int i = 0; i < elements; i++) {                              \
+      m_data[i] Op## = val[i];                                        \
+    }                                                                 \
+    return *this;                                                     \
+  }                                                                   \
+  friend T operator Op(T lhs, const T &rhs) {                         \
+    for (int i = 0; i < elements; i++) {                              \
+      lhs[i] Op## = rhs[i];                                           \
+    }                                                                 \
+    return lhs;                                                       \
+  }                                                                   \
+  template <typename RHSScalar,                                       \
+            typename = typename std::enable_if<                       \
+                std::is_arithmetic<RHSScalar>::value>::type>          \
+  friend T operator Op(T lhs, const RHSScalar &rhs) {                 \
+    for (int i = 0; i < elements; i++) {                              \
+      lhs[i] Op## = rhs;                                              \
+    }                                                                 \
+    return lhs;                                                       \
+  }                                                                   \
+  template <typename ScalarLHS,                                       \
+            typename = typename std::enable_if<                       \
+                std::is_arithmetic<ScalarLHS>::value>::type>          \
+  friend T operator Op(const ScalarLHS &lhs, T rhs) {                 \
+    for (int i = 0; i < elements; i++) {                              \
+      rhs[i] = lhs Op rhs[i];                                         \
+    }                                                                 \
+    return rhs;                                                       \
   }
-// [TODO] This macro conflicts with the operator overload from computecpp 0.5
-// template <typename RHSScalar>                       \
-// friend T operator Op(T lhs, const RHSScalar &rhs) { \
-//   for (int i = 0; i < elements; i++) {              \
-//     lhs[i] Op## = rhs;                              \
-//   }                                                 \
-//   return lhs;                                       \
-// }
 
 template <typename LHSScalar, size_t Channels>
 struct Storage {
@@ -92,8 +122,12 @@ struct Storage {
   REGISTER_OPERATORS(-, Storage)
   REGISTER_OPERATORS(/, Storage)
   REGISTER_OPERATORS(*, Storage)
-  template <typename... P>
-  Storage(P... p) {
+  /// \brief builds the pixel from its channels. The channels which are not
+  /// given are zero, so Storage{} is a black pixel as for the scalar types.
+  template <typename... P,
+            typename = typename std::enable_if<
+                internal::ChannelsConvertible<LHSScalar, P...>::value>::type>
+  Storage(P... p) : m_data() {
     auto tp = visioncpp::internal::tools::tuple::make_tuple(p...);
     internal::AssignValueToArray<0 != sizeof...(P), 0, decltype(m_data),
                                  P...>::avta(m_data, tp);
@@ -140,6 +174,85 @@ typedef Storage<unsigned char, 3> U8C3;
 /// is perfect for storing pixels of RGBA and permutations.
 typedef Storage<unsigned char, 4> U8C4;
 
+/// \struct F16C1
+/// \brief This struct is generalisation for one channel half precision float
+/// that is perfect for storing pixels of R.
+typedef Storage<cl::sycl::half, 1> F16C1;
+
+/// \struct F16C2
+/// \brief This struct is generalisation for two channels half precision float
+/// that is perfect for storing pixels of RG and permutations.
+typedef Storage<cl::sycl::half, 2> F16C2;
+
+/// \struct F16C3
+/// \brief This struct is generalisation for three channels half precision float
+/// that is perfect for storing pixels of RGB and permutations.
+typedef Storage<cl::sycl::half, 3> F16C3;
+
+/// \struct F16C4
+/// \brief This struct is generalisation for four channels half precision float
+/// that is perfect for storing pixels of RGBA and permutations.
+typedef Storage<cl::sycl::half, 4> F16C4;
+
+/// \struct U16C1
+/// \brief This struct is generalisation for one channel unsigned short that is
+/// perfect for storing pixels of R.
+typedef Storage<unsigned short, 1> U16C1;
+
+/// \struct U16C2
+/// \brief This struct is generalisation for two channels unsigned short that is
+/// perfect for storing pixels of RG and permutations.
+typedef Storage<unsigned short, 2> U16C2;
+
+/// \struct U16C3
+/// \brief This struct is generalisation for three channels unsigned short that
+/// is perfect for storing pixels of RGB and permutations.
+typedef Storage<unsigned short, 3> U16C3;
+
+/// \struct U16C4
+/// \brief This struct is generalisation for four channels unsigned short that
+/// is perfect for storing pixels of RGBA and permutations.
+typedef Storage<unsigned short, 4> U16C4;
+
+/// \struct S16C1
+/// \brief This struct is generalisation for one channel short that is perfect
+/// for storing pixels of R.
+typedef Storage<short, 1> S16C1;
+
+/// \struct S16C2
+/// \brief This struct is generalisation for two channels short that is perfect
+/// for storing pixels of RG and permutations.
+typedef Storage<short, 2> S16C2;
+
+/// \struct S16C3
+/// \brief This struct is generalisation for three channels short that is
+/// perfect for storing pixels of RGB and permutations.
+typedef Storage<short, 3> S16C3;
+
+/// \struct S16C4
+/// \brief This struct is generalisation for four channels short that is perfect
+/// for storing pixels of RGBA and permutations.
+typedef Storage<short, 4> S16C4;
+
+/// \struct Packet
+/// \brief Packet holds Width pixels which are next to each other in a row.
+/// The point operation kernels evaluate a packet of pixels at a time on the
+/// devices running a row of pixels per work-item. A functor can provide a
+/// packet member taking the packets of its operands and writing the packet of
+/// its results, which is then used instead of applying the functor to each
+/// pixel of the packets.
+/// template parameters:
+/// \tparam PixelType: the type of each pixel of the packet
+/// \tparam Width: the number of pixels of the packet
+template <typename PixelType, size_t Width>
+struct Packet {
+  typedef PixelType data_type;
+  constexpr static size_t width = Width;
+  PixelType m_data[width];
+  const data_type &operator[](size_t idx) const { return m_data[idx]; }
+  data_type &operator[](size_t idx) { return m_data[idx]; }
+};
+
 }  // end of pixel
 }  // namespace visioncpp
 #endif  // VISIONCPP_INCLUDE_PIXEL_PIXEL_HPP_
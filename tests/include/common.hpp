@@ -58,6 +58,28 @@ void verify(const cv::Mat &ref, std::shared_ptr<T> img) {
   }
 }
 
+// verification function for floating point results that takes an OpenCV Mat
+// of floats as a reference and the host storage of the VisionCpp output. The
+// tolerance is relative to the magnitude of the expected value.
+template <typename T>
+void verify(const cv::Mat &ref, const T *img, float tolerance) {
+  // opencv channels
+  int cv_cn = ref.channels();
+
+  for (int i = 0; i < ref.rows; i++) {
+    const float *pixelPtr = ref.ptr<float>(i);
+    for (int j = 0; j < ref.cols; j++) {
+      for (int c = 0; c < cv_cn; c++) {
+        auto expected = pixelPtr[j * cv_cn + c];
+        auto tested = (float)(img[i * ref.cols * cv_cn + j * cv_cn + c]);
+        ASSERT_NEAR(expected, tested, tolerance * (1 + std::fabs(expected)))
+            << "\nrow: " << i << " col: " << j << " channel: " << c
+            << " expected: " << expected << " tested: " << tested;
+      }
+    }
+  }
+}
+
 // singleton that is used for generating a data for tests
 // create 256 textures that are 256x256 with all possible combinations of pixel
 // values for unsigned char storage.
@@ -114,6 +136,22 @@ auto getBuffer2D(size_t i) -> decltype(visioncpp::terminal<
       common::singleton::DataSet::Instance().m_data[i].get());
 }
 
+// utility function that wraps the singleton data in an OpenCV Mat
+cv::Mat getFrame(size_t i) {
+  return cv::Mat(common::singleton::DataSet::m_height,
+                 common::singleton::DataSet::m_width, CV_8UC3,
+                 common::singleton::DataSet::Instance().m_data[i].get());
+}
+
+// utility function that computes the grey image of the singleton data in
+// [0.0f, 1.0f], which is what OP_CVBGRToRGB followed by OP_RGBToGREY computes
+cv::Mat getGrey(size_t i) {
+  cv::Mat frame, grey;
+  getFrame(i).convertTo(frame, CV_32F, 1.0 / 255.0);
+  cv::cvtColor(frame, grey, cv::COLOR_BGR2GRAY);
+  return grey;
+}
+
 }  // internal
 
 #endif  // VISIONCPP_TESTS_INCLUDE_COMMON_HPP_
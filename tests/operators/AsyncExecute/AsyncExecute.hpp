@@ -0,0 +1,68 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../../include/common.hpp"
+
+template <size_t TERMINAL, size_t POLICY, typename QUEUE, typename DATA>
+void run_test(QUEUE &q, DATA data, int i) {
+  constexpr size_t COLS = common::singleton::DataSet::m_width;
+  constexpr size_t ROWS = common::singleton::DataSet::m_height;
+  // custom filter
+  float filter_array[9] = {1.0 / 16.0, 2.0 / 16.0, 1.0 / 16.0,
+                           3.0 / 16.0, 2.0 / 16.0, 1.0 / 16.0,
+                           1.0 / 16.0, 4.0 / 16.0, 1.0 / 16.0};
+  std::vector<float> grey(COLS * ROWS), blur(COLS * ROWS);
+  // 1) create gold_standard images
+  cv::Mat ref_grey = common::getGrey(i), ref_blur;
+  cv::Mat kernel(3, 3, CV_32F, filter_array);
+  cv::filter2D(ref_grey, ref_blur, -1, kernel, cv::Point(-1, -1), 0,
+               cv::BORDER_REPLICATE);
+
+  {
+    // 2) define graph
+    auto grey_node =
+        visioncpp::terminal<float, COLS, ROWS,
+                            visioncpp::memory_type::Buffer2D>(grey.data());
+    auto blur_node =
+        visioncpp::terminal<float, COLS, ROWS,
+                            visioncpp::memory_type::Buffer2D>(blur.data());
+    auto filter_node =
+        visioncpp::terminal<float, 3, 3, visioncpp::memory_type::Buffer2D,
+                            visioncpp::scope::Constant>(filter_array);
+    auto node = visioncpp::point_operation<visioncpp::OP_CVBGRToRGB>(data);
+    auto node2 = visioncpp::point_operation<visioncpp::OP_RGBToGREY>(node);
+    auto node3 = visioncpp::neighbour_operation<visioncpp::OP_Filter2D_One>(
+        node2, filter_node);
+    auto assign_grey = visioncpp::assign(grey_node, node2);
+    auto assign_blur = visioncpp::assign(blur_node, node3);
+
+    // 3) submit both expressions before waiting on any of them
+    auto event = visioncpp::execute_async<POLICY, 16, 16, 8, 8>(assign_grey, q);
+    auto event2 =
+        visioncpp::execute_async<POLICY, 16, 16, 8, 8>(assign_blur, q);
+    auto done = event2.then([]() { return 1; });
+    event.wait();
+    ASSERT_TRUE(event.is_complete());
+    ASSERT_EQ(1, done.get());
+    ASSERT_TRUE(event2.is_complete());
+  }
+  // 4) verify
+  verify(ref_grey, grey.data(), 1e-5f);
+  verify(ref_blur, blur.data(), 1e-5f);
+}
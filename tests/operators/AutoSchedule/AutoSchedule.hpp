@@ -0,0 +1,72 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../../include/common.hpp"
+
+template <size_t TERMINAL, size_t POLICY, typename QUEUE, typename DATA>
+void run_test(QUEUE &q, DATA data, int i) {
+  constexpr size_t COLS = common::singleton::DataSet::m_width;
+  constexpr size_t ROWS = common::singleton::DataSet::m_height;
+  // the chain of four 5x5 filters
+  constexpr int STAGES = 4;
+  // custom filter
+  float filter_array[25];
+  for (int k = 0; k < 25; k++) {
+    filter_array[k] = (k % 7 + 1) / 100.0f;
+  }
+  cv::Mat kernel(5, 5, CV_32F, filter_array);
+  std::vector<float> out(COLS * ROWS);
+  // 1) create gold_standard image, one filter at a time
+  cv::Mat ref = common::getGrey(i);
+  for (int k = 0; k < STAGES; k++) {
+    cv::filter2D(ref, ref, -1, kernel, cv::Point(-1, -1), 0,
+                 cv::BORDER_REPLICATE);
+  }
+
+  {
+    // 2) define graph, where the kernels are broken by the policy
+    auto out_node =
+        visioncpp::terminal<float, COLS, ROWS,
+                            visioncpp::memory_type::Buffer2D>(out.data());
+    auto filter_node =
+        visioncpp::terminal<float, 5, 5, visioncpp::memory_type::Buffer2D,
+                            visioncpp::scope::Constant>(filter_array);
+    auto node = visioncpp::point_operation<visioncpp::OP_CVBGRToRGB>(data);
+    auto node2 = visioncpp::point_operation<visioncpp::OP_RGBToGREY>(node);
+    auto node3 = visioncpp::neighbour_operation<visioncpp::OP_Filter2D_One>(
+        node2, filter_node);
+    auto node4 = visioncpp::neighbour_operation<visioncpp::OP_Filter2D_One>(
+        node3, filter_node);
+    auto node5 = visioncpp::neighbour_operation<visioncpp::OP_Filter2D_One>(
+        node4, filter_node);
+    auto node6 = visioncpp::neighbour_operation<visioncpp::OP_Filter2D_One>(
+        node5, filter_node);
+    auto assign_node = visioncpp::assign(out_node, node6);
+
+    // 3) execute pipe twice: the kernel breaks are planned once per type, and
+    // their buffers are reused by the next execution
+    q.buffer_pool().clear();
+    visioncpp::execute<POLICY, 16, 16, 8, 8>(assign_node, q);
+    size_t pooled = q.buffer_pool().size();
+    visioncpp::execute<POLICY, 16, 16, 8, 8>(assign_node, q);
+    ASSERT_EQ(pooled, q.buffer_pool().size());
+  }
+  // 4) verify
+  verify(ref, out.data(), 1e-5f);
+}
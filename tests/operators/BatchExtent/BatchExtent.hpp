@@ -0,0 +1,89 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../../include/common.hpp"
+
+template <size_t TERMINAL, size_t POLICY, typename QUEUE, typename DATA>
+void run_test(QUEUE &q, DATA data, int i) {
+  constexpr size_t COLS = common::singleton::DataSet::m_width;
+  constexpr size_t ROWS = common::singleton::DataSet::m_height;
+  constexpr size_t FRAMES = 3;
+  // custom filter
+  float filter_array[9] = {1.0 / 16.0, 2.0 / 16.0, 1.0 / 16.0,
+                           3.0 / 16.0, 2.0 / 16.0, 1.0 / 16.0,
+                           1.0 / 16.0, 4.0 / 16.0, 1.0 / 16.0};
+  cv::Mat kernel(3, 3, CV_32F, filter_array);
+  // 1) pack consecutive frames one after the other
+  std::vector<unsigned char> in(COLS * ROWS * 3 * FRAMES);
+  std::vector<float> grey(COLS * ROWS * FRAMES), blur(COLS * ROWS * FRAMES);
+  for (size_t f = 0; f < FRAMES; f++) {
+    size_t frame = (i + f) % common::singleton::DataSet::m_depth;
+    std::memcpy(&in[f * COLS * ROWS * 3],
+                common::singleton::DataSet::Instance().m_data[frame].get(),
+                COLS * ROWS * 3);
+  }
+
+  {
+    // 2) define graph
+    auto in_node = visioncpp::terminal<visioncpp::pixel::U8C3, COLS, ROWS,
+                                       visioncpp::memory_type::Buffer2D>(
+        in.data(), FRAMES);
+    // device only output of the batch
+    auto grey_node = visioncpp::terminal<float, COLS, ROWS,
+                                         visioncpp::memory_type::Buffer2D>(
+        FRAMES);
+    auto blur_node =
+        visioncpp::terminal<float, COLS, ROWS,
+                            visioncpp::memory_type::Buffer2D>(blur.data(),
+                                                              FRAMES);
+    auto filter_node =
+        visioncpp::terminal<float, 3, 3, visioncpp::memory_type::Buffer2D,
+                            visioncpp::scope::Constant>(filter_array);
+    auto node = visioncpp::point_operation<visioncpp::OP_CVBGRToRGB>(in_node);
+    auto node2 = visioncpp::point_operation<visioncpp::OP_RGBToGREY>(node);
+    auto assign_grey = visioncpp::assign(grey_node, node2);
+    // the scheduled subexpression holds the whole batch
+    auto node3 = visioncpp::neighbour_operation<visioncpp::OP_Filter2D_One>(
+        node2, filter_node);
+    auto node4 = visioncpp::schedule<POLICY, 16, 16, 8, 8>(node3);
+    auto node5 = visioncpp::neighbour_operation<visioncpp::OP_Filter2D_One>(
+        node4, filter_node);
+    auto assign_blur = visioncpp::assign(blur_node, node5);
+
+    // 3) execute pipe
+    visioncpp::execute_batch<POLICY, 16, 16, 8, 8>(assign_grey, q, FRAMES);
+    grey_node.read_output(grey.data());
+    visioncpp::execute_batch<POLICY, 16, 16, 8, 8>(assign_blur, q, FRAMES);
+    // an empty batch is rejected
+    ASSERT_THROW(
+        (visioncpp::execute_batch<POLICY, 16, 16, 8, 8>(assign_grey, q, 0)),
+        std::invalid_argument);
+  }
+  // 4) verify each frame against its own gold_standard image
+  for (size_t f = 0; f < FRAMES; f++) {
+    size_t frame = (i + f) % common::singleton::DataSet::m_depth;
+    cv::Mat ref_grey = common::getGrey(frame), ref_blur;
+    cv::filter2D(ref_grey, ref_blur, -1, kernel, cv::Point(-1, -1), 0,
+                 cv::BORDER_REPLICATE);
+    cv::filter2D(ref_blur, ref_blur, -1, kernel, cv::Point(-1, -1), 0,
+                 cv::BORDER_REPLICATE);
+    verify(ref_grey, &grey[f * COLS * ROWS], 1e-5f);
+    verify(ref_blur, &blur[f * COLS * ROWS], 1e-5f);
+  }
+}
@@ -0,0 +1,112 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../../include/common.hpp"
+
+// the pixel read outside of the image by the user defined constant border
+struct GreyBorder {
+  float operator()() const { return 0.5f; }
+};
+
+// OpenCV filter with the pixels outside of the image taken from cv_border, as
+// cv::filter2D does not support every border mode
+cv::Mat border_filter(const cv::Mat &src, const cv::Mat &kernel, int cv_border,
+                      float value) {
+  cv::Mat padded, filtered;
+  cv::copyMakeBorder(src, padded, kernel.rows / 2, kernel.rows / 2,
+                     kernel.cols / 2, kernel.cols / 2, cv_border,
+                     cv::Scalar(value));
+  cv::filter2D(padded, filtered, -1, kernel, cv::Point(-1, -1), 0,
+               cv::BORDER_CONSTANT);
+  return filtered(cv::Rect(kernel.cols / 2, kernel.rows / 2, src.cols,
+                           src.rows)).clone();
+}
+
+// runs a filter and two chained filters with the border mode BORDER, and
+// compares them with a filter per pass in OpenCV
+template <size_t BORDER, typename BORDER_VALUE, size_t POLICY, typename QUEUE,
+          typename DATA>
+void run_border(QUEUE &q, DATA data, int i, int cv_border, float value,
+                bool chained) {
+  constexpr size_t COLS = common::singleton::DataSet::m_width;
+  constexpr size_t ROWS = common::singleton::DataSet::m_height;
+  // custom filter, which is not symmetric so that a flipped read is caught
+  float filter_array[25];
+  for (int k = 0; k < 25; k++) {
+    filter_array[k] = (k % 7 + 1) / 100.0f;
+  }
+  std::vector<float> out(COLS * ROWS), out2(COLS * ROWS);
+  // 1) create gold_standard images
+  cv::Mat kernel(5, 5, CV_32F, filter_array);
+  cv::Mat ref = border_filter(common::getGrey(i), kernel, cv_border, value);
+  cv::Mat ref2 = border_filter(ref, kernel, cv_border, value);
+
+  {
+    // 2) define graph
+    auto out_node =
+        visioncpp::terminal<float, COLS, ROWS,
+                            visioncpp::memory_type::Buffer2D>(out.data());
+    auto out2_node =
+        visioncpp::terminal<float, COLS, ROWS,
+                            visioncpp::memory_type::Buffer2D>(out2.data());
+    auto filter_node =
+        visioncpp::terminal<float, 5, 5, visioncpp::memory_type::Buffer2D,
+                            visioncpp::scope::Constant>(filter_array);
+    auto node = visioncpp::point_operation<visioncpp::OP_CVBGRToRGB>(data);
+    auto node2 = visioncpp::point_operation<visioncpp::OP_RGBToGREY>(node);
+    auto node3 = visioncpp::neighbour_operation<visioncpp::OP_Filter2D_One,
+                                                BORDER, BORDER_VALUE>(
+        node2, filter_node);
+    auto node4 = visioncpp::neighbour_operation<visioncpp::OP_Filter2D_One,
+                                                BORDER, BORDER_VALUE>(
+        node3, filter_node);
+    auto assign_node = visioncpp::assign(out_node, node3);
+    auto assign_node2 = visioncpp::assign(out2_node, node4);
+    // 3) execute pipe
+    visioncpp::execute<POLICY, 16, 16, 8, 8>(assign_node, q);
+    if (chained) {
+      visioncpp::execute<POLICY, 16, 16, 8, 8>(assign_node2, q);
+    }
+  }
+  // 4) verify
+  verify(ref, out.data(), 1e-5f);
+  if (chained) {
+    verify(ref2, out2.data(), 1e-5f);
+  }
+}
+
+template <size_t TERMINAL, size_t POLICY, typename QUEUE, typename DATA>
+void run_test(QUEUE &q, DATA data, int i) {
+  using Zero = visioncpp::internal::ZeroBorder;
+  run_border<visioncpp::border_type::Replicate, Zero, POLICY>(
+      q, data, i, cv::BORDER_REPLICATE, 0.0f, true);
+  // the fused replicated border only matches a filter per pass for a single
+  // filter, see visioncpp::border_type::ReplicateFused
+  run_border<visioncpp::border_type::ReplicateFused, Zero, POLICY>(
+      q, data, i, cv::BORDER_REPLICATE, 0.0f,
+      POLICY == visioncpp::policy::NoFuse);
+  run_border<visioncpp::border_type::Reflect101, Zero, POLICY>(
+      q, data, i, cv::BORDER_REFLECT_101, 0.0f, true);
+  run_border<visioncpp::border_type::Wrap, Zero, POLICY>(
+      q, data, i, cv::BORDER_WRAP, 0.0f, true);
+  run_border<visioncpp::border_type::Constant, Zero, POLICY>(
+      q, data, i, cv::BORDER_CONSTANT, 0.0f, true);
+  run_border<visioncpp::border_type::Constant, GreyBorder, POLICY>(
+      q, data, i, cv::BORDER_CONSTANT, 0.5f, true);
+}
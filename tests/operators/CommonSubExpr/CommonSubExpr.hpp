@@ -0,0 +1,81 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../../include/common.hpp"
+
+template <size_t TERMINAL, size_t POLICY, typename QUEUE, typename DATA>
+void run_test(QUEUE &q, DATA data, int i) {
+  constexpr size_t COLS = common::singleton::DataSet::m_width;
+  constexpr size_t ROWS = common::singleton::DataSet::m_height;
+  // custom filter, large enough for the shared subtree to be worth a kernel
+  float filter_array[9] = {1.0 / 25.0, 2.0 / 25.0, 3.0 / 25.0,
+                           4.0 / 25.0, 5.0 / 25.0, 4.0 / 25.0,
+                           3.0 / 25.0, 2.0 / 25.0, 1.0 / 25.0};
+  std::vector<float> out(COLS * ROWS);
+  // 1) create gold_standard image
+  cv::Mat blur, ref(ROWS, COLS, CV_32F);
+  cv::Mat kernel(9, 1, CV_32F, filter_array);
+  cv::sepFilter2D(common::getGrey(i), blur, -1, kernel, kernel,
+                  cv::Point(-1, -1), 0, cv::BORDER_REPLICATE);
+  for (size_t r = 0; r < ROWS; r++) {
+    for (size_t c = 0; c < COLS; c++) {
+      float b = blur.at<float>(r, c);
+      ref.at<float>(r, c) = b * 0.5f + b * b;
+    }
+  }
+
+  {
+    // 2) define graph, where the blurred image is used by three nodes
+    auto out_node =
+        visioncpp::terminal<float, COLS, ROWS,
+                            visioncpp::memory_type::Buffer2D>(out.data());
+    auto filter_col =
+        visioncpp::terminal<float, 9, 1, visioncpp::memory_type::Buffer2D,
+                            visioncpp::scope::Constant>(filter_array);
+    auto filter_row =
+        visioncpp::terminal<float, 1, 9, visioncpp::memory_type::Buffer2D,
+                            visioncpp::scope::Constant>(filter_array);
+    auto half_node =
+        visioncpp::terminal<float, visioncpp::memory_type::Const>(0.5f);
+    auto node = visioncpp::point_operation<visioncpp::OP_CVBGRToRGB>(data);
+    auto node2 = visioncpp::point_operation<visioncpp::OP_RGBToGREY>(node);
+    auto node3 = visioncpp::neighbour_operation<visioncpp::OP_SepFilterCol>(
+        node2, filter_col);
+    auto blur_node =
+        visioncpp::neighbour_operation<visioncpp::OP_SepFilterRow>(
+            node3, filter_row);
+    auto node4 =
+        visioncpp::point_operation<visioncpp::OP_Mul>(blur_node, half_node);
+    auto node5 =
+        visioncpp::point_operation<visioncpp::OP_Mul>(blur_node, blur_node);
+    auto node6 = visioncpp::point_operation<visioncpp::OP_Add>(node4, node5);
+    auto assign_node = visioncpp::assign(out_node, node6);
+
+    // 3) execute pipe twice: the shared subtree is computed once per
+    // execution, in a buffer of the pool reused by the next one
+    q.buffer_pool().clear();
+    visioncpp::execute<POLICY, 16, 16, 8, 8>(assign_node, q);
+    size_t pooled = q.buffer_pool().size();
+    ASSERT_LT(0u, pooled);
+    visioncpp::execute<POLICY, 16, 16, 8, 8>(assign_node, q);
+    ASSERT_EQ(pooled, q.buffer_pool().size());
+  }
+  // 4) verify
+  verify(ref, out.data(), 1e-5f);
+}
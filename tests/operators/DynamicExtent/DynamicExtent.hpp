@@ -0,0 +1,91 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../../include/common.hpp"
+
+template <size_t TERMINAL, size_t POLICY, typename QUEUE, typename DATA>
+void run_test(QUEUE &q, DATA data, int i) {
+  constexpr size_t COLS = common::singleton::DataSet::m_width;
+  constexpr size_t ROWS = common::singleton::DataSet::m_height;
+  // the runtime size of the images, smaller than the compile-time one
+  const int cols = 200, rows = 150;
+  // custom filter
+  float filter_array[9] = {1.0 / 16.0, 2.0 / 16.0, 1.0 / 16.0,
+                           3.0 / 16.0, 2.0 / 16.0, 1.0 / 16.0,
+                           1.0 / 16.0, 4.0 / 16.0, 1.0 / 16.0};
+  // 1) pack the top left corner of the frame with a row stride of cols
+  cv::Mat frame = common::getFrame(i)(cv::Rect(0, 0, cols, rows)).clone();
+  cv::Mat grey = common::getGrey(i)(cv::Rect(0, 0, cols, rows)).clone();
+  std::vector<float> out(COLS * ROWS), pyr(COLS * ROWS / 4);
+
+  // 2) create gold_standard images
+  cv::Mat ref, half;
+  grey.convertTo(half, CV_32F, 0.5);
+  cv::filter2D(half, ref, -1, cv::Mat(3, 3, CV_32F, filter_array),
+               cv::Point(-1, -1), 0, cv::BORDER_REPLICATE);
+  cv::Mat ref_pyr(rows / 2, cols / 2, CV_32F);
+  for (int r = 0; r < ref_pyr.rows; r++) {
+    for (int c = 0; c < ref_pyr.cols; c++) {
+      ref_pyr.at<float>(r, c) = grey.at<float>(2 * r, 2 * c) +
+                                grey.at<float>(2 * r + 1, 2 * c + 1) / 2.0f;
+    }
+  }
+
+  {
+    // 3) define graph. The filter and the constant keep their size.
+    auto in_node = visioncpp::terminal<visioncpp::pixel::U8C3, COLS, ROWS,
+                                       visioncpp::memory_type::Buffer2D>(
+        frame.data);
+    auto out_node =
+        visioncpp::terminal<float, COLS, ROWS,
+                            visioncpp::memory_type::Buffer2D>(out.data());
+    auto pyr_node =
+        visioncpp::terminal<float, COLS / 2, ROWS / 2,
+                            visioncpp::memory_type::Buffer2D>(pyr.data());
+    auto filter_node =
+        visioncpp::terminal<float, 3, 3, visioncpp::memory_type::Buffer2D,
+                            visioncpp::scope::Constant>(filter_array);
+    auto half_node =
+        visioncpp::terminal<float, visioncpp::memory_type::Const>(0.5f);
+    auto node = visioncpp::point_operation<visioncpp::OP_CVBGRToRGB>(in_node);
+    auto node2 = visioncpp::point_operation<visioncpp::OP_RGBToGREY>(node);
+    auto node3 =
+        visioncpp::point_operation<visioncpp::OP_Mul>(node2, half_node);
+    auto node4 = visioncpp::neighbour_operation<visioncpp::OP_Filter2D_One>(
+        node3, filter_node);
+    auto assign_node = visioncpp::assign(out_node, node4);
+    // the input of the downsampling is scaled from the runtime size of root
+    auto node5 = visioncpp::neighbour_operation<
+        visioncpp::OP_DownsampleAverage, COLS / 2, ROWS / 2,
+        visioncpp::memory_type::Buffer2D>(node2);
+    auto assign_pyr = visioncpp::assign(pyr_node, node5);
+
+    // 4) execute pipe
+    visioncpp::execute<POLICY, 16, 16, 8, 8>(assign_node, q, cols, rows);
+    visioncpp::execute<POLICY, 16, 16, 8, 8>(assign_pyr, q, cols / 2,
+                                             rows / 2);
+    // a size larger than the terminals is rejected
+    ASSERT_THROW((visioncpp::execute<POLICY, 16, 16, 8, 8>(
+                     assign_node, q, COLS + 1, rows)),
+                 std::invalid_argument);
+  }
+  // 5) verify
+  verify(ref, out.data(), 1e-5f);
+  verify(ref_pyr, pyr.data(), 1e-5f);
+}
@@ -0,0 +1,81 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../../include/common.hpp"
+
+template <size_t TERMINAL, size_t POLICY, typename QUEUE, typename DATA>
+void run_test(QUEUE &q, DATA data, int i) {
+  constexpr size_t COLS = common::singleton::DataSet::m_width;
+  constexpr size_t ROWS = common::singleton::DataSet::m_height;
+  // 1) scale the frame to the range of unsigned short, in the RGB order of
+  // VisionCpp
+  cv::Mat frame, frame16;
+  cv::cvtColor(common::getFrame(i), frame, cv::COLOR_BGR2RGB);
+  frame.convertTo(frame16, CV_16U, 257.0);
+  std::vector<unsigned short> in(COLS * ROWS * 3), out(COLS * ROWS * 3);
+  std::vector<cl::sycl::half> half(COLS * ROWS * 3);
+  std::vector<float> out32(COLS * ROWS * 3), out16(COLS * ROWS * 3);
+  for (size_t r = 0; r < ROWS; r++) {
+    std::memcpy(&in[r * COLS * 3], frame16.ptr<unsigned short>(r),
+                COLS * 3 * sizeof(unsigned short));
+  }
+  // 2) create gold_standard images
+  cv::Mat ref, ref16;
+  frame.convertTo(ref, CV_32F, 1.0 / 255.0);
+  frame16.convertTo(ref16, CV_32F);
+
+  {
+    // 3) define graph, which goes through a half precision buffer
+    auto in_node =
+        visioncpp::terminal<visioncpp::pixel::U16C3, COLS, ROWS,
+                            visioncpp::memory_type::Buffer2D>(in.data());
+    auto half_node =
+        visioncpp::terminal<visioncpp::pixel::F16C3, COLS, ROWS,
+                            visioncpp::memory_type::Buffer2D>(half.data());
+    auto out32_node =
+        visioncpp::terminal<visioncpp::pixel::F32C3, COLS, ROWS,
+                            visioncpp::memory_type::Buffer2D>(out32.data());
+    auto out16_node =
+        visioncpp::terminal<visioncpp::pixel::F32C3, COLS, ROWS,
+                            visioncpp::memory_type::Buffer2D>(out16.data());
+    auto out_node =
+        visioncpp::terminal<visioncpp::pixel::U16C3, COLS, ROWS,
+                            visioncpp::memory_type::Buffer2D>(out.data());
+    auto node =
+        visioncpp::point_operation<visioncpp::OP_U16C3ToF32C3>(in_node);
+    auto assign_f32 = visioncpp::assign(out32_node, node);
+    auto node2 = visioncpp::point_operation<visioncpp::OP_F32C3ToF16C3>(node);
+    auto assign_f16 = visioncpp::assign(half_node, node2);
+    auto node3 =
+        visioncpp::point_operation<visioncpp::OP_F16C3ToF32C3>(half_node);
+    auto assign_back = visioncpp::assign(out16_node, node3);
+    auto node4 = visioncpp::point_operation<visioncpp::OP_F32C3ToU16C3>(node3);
+    auto assign_u16 = visioncpp::assign(out_node, node4);
+    // 4) execute pipe
+    visioncpp::execute<POLICY, 16, 16, 8, 8>(assign_f32, q);
+    visioncpp::execute<POLICY, 16, 16, 8, 8>(assign_f16, q);
+    visioncpp::execute<POLICY, 16, 16, 8, 8>(assign_back, q);
+    visioncpp::execute<POLICY, 16, 16, 8, 8>(assign_u16, q);
+  }
+  // 5) verify, where the half precision keeps 11 bits of the mantissa and
+  // the conversion to unsigned short truncates
+  verify(ref, out32.data(), 1e-5f);
+  verify(ref, out16.data(), 1e-3f);
+  verify(ref16, out.data(), 4e-3f);
+}
@@ -0,0 +1,67 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../../include/common.hpp"
+
+template <size_t TERMINAL, size_t POLICY, typename QUEUE, typename DATA>
+void run_test(QUEUE &q, DATA data, int i) {
+  constexpr size_t COLS = common::singleton::DataSet::m_width;
+  constexpr size_t ROWS = common::singleton::DataSet::m_height;
+  // custom filter
+  float filter_array[9] = {1.0 / 16.0, 2.0 / 16.0, 1.0 / 16.0,
+                           3.0 / 16.0, 2.0 / 16.0, 1.0 / 16.0,
+                           1.0 / 16.0, 4.0 / 16.0, 1.0 / 16.0};
+  cv::Mat grey = common::getGrey(i);
+  std::vector<float> out(COLS * ROWS), out2(COLS * ROWS);
+  // 1) create gold_standard images
+  cv::Mat ref, ref2;
+  cv::filter2D(grey, ref, -1, cv::Mat(3, 3, CV_32F, filter_array),
+               cv::Point(-1, -1), 0, cv::BORDER_REPLICATE);
+  cv::filter2D(ref, ref2, -1, cv::Mat(3, 3, CV_32F, filter_array),
+               cv::Point(-1, -1), 0, cv::BORDER_REPLICATE);
+
+  {
+    // 2) define graph, reading and writing images
+    auto in_node = visioncpp::terminal<float, COLS, ROWS,
+                                       visioncpp::memory_type::Image>(
+        reinterpret_cast<float *>(grey.data));
+    auto out_node = visioncpp::terminal<float, COLS, ROWS,
+                                        visioncpp::memory_type::Image>(
+        out.data());
+    auto out2_node =
+        visioncpp::terminal<float, COLS, ROWS,
+                            visioncpp::memory_type::Image>(out2.data());
+    auto filter_node =
+        visioncpp::terminal<float, 3, 3, visioncpp::memory_type::Buffer2D,
+                            visioncpp::scope::Constant>(filter_array);
+    auto node = visioncpp::neighbour_operation<visioncpp::OP_Filter2D_One>(
+        in_node, filter_node);
+    auto assign_node = visioncpp::assign(out_node, node);
+    // the neighbour operation reads an image written by the first kernel
+    auto node2 = visioncpp::neighbour_operation<visioncpp::OP_Filter2D_One>(
+        out_node, filter_node);
+    auto assign_node2 = visioncpp::assign(out2_node, node2);
+    // 3) execute pipe
+    visioncpp::execute<POLICY, 16, 16, 8, 8>(assign_node, q);
+    visioncpp::execute<POLICY, 16, 16, 8, 8>(assign_node2, q);
+  }
+  // 4) verify
+  verify(ref, out.data(), 1e-5f);
+  verify(ref2, out2.data(), 1e-5f);
+}
@@ -0,0 +1,95 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../../include/common.hpp"
+
+// runs neighbour operations on a COLS x ROWS crop of the frame. The tiles of
+// the work-groups are split into the interior, which is read without border
+// checks, and the border, so the sizes cover images with no interior tile,
+// images which are not a multiple of the tile and images which are.
+template <size_t COLS, size_t ROWS, size_t POLICY, typename QUEUE>
+void run_crop(QUEUE &q, int i) {
+  // custom filters
+  float filter3[9] = {1.0 / 16.0, 2.0 / 16.0, 1.0 / 16.0,
+                      3.0 / 16.0, 2.0 / 16.0, 1.0 / 16.0,
+                      1.0 / 16.0, 4.0 / 16.0, 1.0 / 16.0};
+  float filter5[25];
+  for (int k = 0; k < 25; k++) {
+    filter5[k] = (k % 7 + 1) / 100.0f;
+  }
+  // 1) copy the crop to buffers of its size
+  cv::Rect roi(256 - COLS, 256 - ROWS, COLS, ROWS);
+  cv::Mat frame, grey = common::getGrey(i)(roi).clone();
+  common::getFrame(i)(roi).convertTo(frame, CV_32F, 1.0 / 255.0);
+  std::vector<float> in(COLS * ROWS), in3(COLS * ROWS * 3);
+  std::vector<float> out(COLS * ROWS), out3(COLS * ROWS * 3);
+  for (size_t r = 0; r < ROWS; r++) {
+    std::memcpy(&in[r * COLS], grey.ptr<float>(r), COLS * sizeof(float));
+    std::memcpy(&in3[r * COLS * 3], frame.ptr<float>(r),
+                COLS * 3 * sizeof(float));
+  }
+  // 2) create gold_standard images
+  cv::Mat ref, ref3;
+  cv::filter2D(grey, ref, -1, cv::Mat(5, 5, CV_32F, filter5),
+               cv::Point(-1, -1), 0, cv::BORDER_REPLICATE);
+  cv::filter2D(frame, ref3, -1, cv::Mat(3, 3, CV_32F, filter3),
+               cv::Point(-1, -1), 0, cv::BORDER_REPLICATE);
+
+  {
+    // 3) define graph
+    auto in_node =
+        visioncpp::terminal<float, COLS, ROWS,
+                            visioncpp::memory_type::Buffer2D>(in.data());
+    auto in3_node =
+        visioncpp::terminal<visioncpp::pixel::F32C3, COLS, ROWS,
+                            visioncpp::memory_type::Buffer2D>(in3.data());
+    auto out_node =
+        visioncpp::terminal<float, COLS, ROWS,
+                            visioncpp::memory_type::Buffer2D>(out.data());
+    auto out3_node =
+        visioncpp::terminal<visioncpp::pixel::F32C3, COLS, ROWS,
+                            visioncpp::memory_type::Buffer2D>(out3.data());
+    auto filter3_node =
+        visioncpp::terminal<float, 3, 3, visioncpp::memory_type::Buffer2D,
+                            visioncpp::scope::Constant>(filter3);
+    auto filter5_node =
+        visioncpp::terminal<float, 5, 5, visioncpp::memory_type::Buffer2D,
+                            visioncpp::scope::Constant>(filter5);
+    auto node = visioncpp::neighbour_operation<visioncpp::OP_Filter2D_One>(
+        in_node, filter5_node);
+    auto assign_node = visioncpp::assign(out_node, node);
+    auto node3 = visioncpp::neighbour_operation<visioncpp::OP_Filter2D>(
+        in3_node, filter3_node);
+    auto assign_node3 = visioncpp::assign(out3_node, node3);
+    // 4) execute pipe
+    visioncpp::execute<POLICY, 16, 16, 8, 8>(assign_node, q);
+    visioncpp::execute<POLICY, 16, 16, 8, 8>(assign_node3, q);
+  }
+  // 5) verify
+  verify(ref, out.data(), 1e-5f);
+  verify(ref3, out3.data(), 1e-5f);
+}
+
+template <size_t TERMINAL, size_t POLICY, typename QUEUE, typename DATA>
+void run_test(QUEUE &q, DATA data, int i) {
+  run_crop<3, 2, POLICY>(q, i);
+  run_crop<37, 23, POLICY>(q, i);
+  run_crop<32, 16, POLICY>(q, i);
+  run_crop<256, 256, POLICY>(q, i);
+}
@@ -0,0 +1,82 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../../include/common.hpp"
+
+template <size_t TERMINAL, size_t POLICY, typename QUEUE, typename DATA>
+void run_test(QUEUE &q, DATA data, int i) {
+  constexpr size_t COLS = common::singleton::DataSet::m_width;
+  constexpr size_t ROWS = common::singleton::DataSet::m_height;
+  // custom filters
+  float filter3[9] = {1.0 / 16.0, 2.0 / 16.0, 1.0 / 16.0,
+                      3.0 / 16.0, 2.0 / 16.0, 1.0 / 16.0,
+                      1.0 / 16.0, 4.0 / 16.0, 1.0 / 16.0};
+  float filter5[25];
+  for (int k = 0; k < 25; k++) {
+    filter5[k] = (k % 7 + 1) / 100.0f;
+  }
+  cv::Mat kernel3(3, 3, CV_32F, filter3), kernel5(5, 5, CV_32F, filter5);
+  std::vector<float> out(COLS * ROWS);
+  // 1) create gold_standard image, with a filter per pass
+  cv::Mat frame, ref;
+  common::getFrame(i).convertTo(frame, CV_32F, 1.0 / 255.0);
+  cv::filter2D(frame, frame, -1, kernel3, cv::Point(-1, -1), 0,
+               cv::BORDER_REFLECT_101);
+  cv::cvtColor(frame, ref, cv::COLOR_BGR2GRAY);
+  cv::filter2D(ref, ref, -1, kernel3, cv::Point(-1, -1), 0,
+               cv::BORDER_REFLECT_101);
+  cv::filter2D(ref, ref, -1, kernel5, cv::Point(-1, -1), 0,
+               cv::BORDER_REFLECT_101);
+  cv::filter2D(ref, ref, -1, kernel3, cv::Point(-1, -1), 0,
+               cv::BORDER_REFLECT_101);
+
+  {
+    // 2) define graph, which is fused into a kernel where the local memories
+    // of the three channel tiles are reused by the one channel tiles once
+    // they are no longer read
+    constexpr size_t BORDER = visioncpp::border_type::Reflect101;
+    auto out_node =
+        visioncpp::terminal<float, COLS, ROWS,
+                            visioncpp::memory_type::Buffer2D>(out.data());
+    auto filter3_node =
+        visioncpp::terminal<float, 3, 3, visioncpp::memory_type::Buffer2D,
+                            visioncpp::scope::Constant>(filter3);
+    auto filter5_node =
+        visioncpp::terminal<float, 5, 5, visioncpp::memory_type::Buffer2D,
+                            visioncpp::scope::Constant>(filter5);
+    auto node = visioncpp::point_operation<visioncpp::OP_CVBGRToRGB>(data);
+    auto node2 = visioncpp::neighbour_operation<visioncpp::OP_Filter2D, BORDER>(
+        node, filter3_node);
+    auto node3 = visioncpp::point_operation<visioncpp::OP_RGBToGREY>(node2);
+    auto node4 =
+        visioncpp::neighbour_operation<visioncpp::OP_Filter2D_One, BORDER>(
+            node3, filter3_node);
+    auto node5 =
+        visioncpp::neighbour_operation<visioncpp::OP_Filter2D_One, BORDER>(
+            node4, filter5_node);
+    auto node6 =
+        visioncpp::neighbour_operation<visioncpp::OP_Filter2D_One, BORDER>(
+            node5, filter3_node);
+    auto assign_node = visioncpp::assign(out_node, node6);
+    // 3) execute pipe
+    visioncpp::execute<POLICY, 16, 16, 8, 8>(assign_node, q);
+  }
+  // 4) verify
+  verify(ref, out.data(), 1e-5f);
+}
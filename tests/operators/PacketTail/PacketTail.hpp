@@ -0,0 +1,72 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../../include/common.hpp"
+
+// runs point operations on a COLS x ROWS crop of the frame, whose rows are not
+// a multiple of the packet width, so that the last pixels of each row are
+// computed by the scalar tail
+template <size_t COLS, size_t ROWS, size_t POLICY, typename QUEUE>
+void run_crop(QUEUE &q, int i) {
+  // 1) copy the crop to a buffer of its size, in the RGB order of VisionCpp
+  cv::Mat crop = common::getFrame(i)(cv::Rect(3, 5, COLS, ROWS)).clone();
+  cv::Mat crop_rgb;
+  cv::cvtColor(crop, crop_rgb, cv::COLOR_BGR2RGB);
+  std::vector<unsigned char> in(COLS * ROWS * 3), out(COLS * ROWS * 3);
+  std::vector<float> grey(COLS * ROWS);
+  for (size_t r = 0; r < ROWS; r++) {
+    std::memcpy(&in[r * COLS * 3], crop_rgb.ptr<unsigned char>(r), COLS * 3);
+  }
+  // 2) create gold_standard images
+  cv::Mat ref, ref_grey;
+  crop.convertTo(ref_grey, CV_32F, 1.0 / 255.0);
+  cv::cvtColor(ref_grey, ref_grey, cv::COLOR_BGR2GRAY);
+  crop_rgb.convertTo(ref, CV_32F);
+
+  {
+    // 3) define graph
+    auto in_node =
+        visioncpp::terminal<visioncpp::pixel::U8C3, COLS, ROWS,
+                            visioncpp::memory_type::Buffer2D>(in.data());
+    auto out_node =
+        visioncpp::terminal<visioncpp::pixel::U8C3, COLS, ROWS,
+                            visioncpp::memory_type::Buffer2D>(out.data());
+    auto grey_node =
+        visioncpp::terminal<float, COLS, ROWS,
+                            visioncpp::memory_type::Buffer2D>(grey.data());
+    auto node = visioncpp::point_operation<visioncpp::OP_U8C3ToF32C3>(in_node);
+    auto node2 = visioncpp::point_operation<visioncpp::OP_RGBToGREY>(node);
+    auto assign_grey = visioncpp::assign(grey_node, node2);
+    auto node3 = visioncpp::point_operation<visioncpp::OP_F32C3ToU8C3>(node);
+    auto assign_node = visioncpp::assign(out_node, node3);
+    // 4) execute pipe
+    visioncpp::execute<POLICY, 16, 16, 8, 8>(assign_grey, q);
+    visioncpp::execute<POLICY, 16, 16, 8, 8>(assign_node, q);
+  }
+  // 5) verify
+  verify(ref_grey, grey.data(), 1e-5f);
+  verify(ref, out.data(), 1e-5f);
+}
+
+template <size_t TERMINAL, size_t POLICY, typename QUEUE, typename DATA>
+void run_test(QUEUE &q, DATA data, int i) {
+  run_crop<61, 37, POLICY>(q, i);
+  run_crop<3, 2, POLICY>(q, i);
+  run_crop<17, 1, POLICY>(q, i);
+}
@@ -0,0 +1,73 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../../include/common.hpp"
+
+template <size_t TERMINAL, size_t POLICY, typename QUEUE, typename DATA>
+void run_test(QUEUE &q, DATA data, int i) {
+  constexpr size_t COLS = common::singleton::DataSet::m_width;
+  constexpr size_t ROWS = common::singleton::DataSet::m_height;
+  constexpr int FRAMES = 3;
+  // custom filter
+  float filter_array[9] = {1.0 / 16.0, 2.0 / 16.0, 1.0 / 16.0,
+                           3.0 / 16.0, 2.0 / 16.0, 1.0 / 16.0,
+                           1.0 / 16.0, 4.0 / 16.0, 1.0 / 16.0};
+  cv::Mat kernel(3, 3, CV_32F, filter_array);
+  std::vector<float> out(COLS * ROWS);
+
+  // 1) define graph once, on device only terminals
+  auto in_node = visioncpp::terminal<visioncpp::pixel::U8C3, COLS, ROWS,
+                                     visioncpp::memory_type::Buffer2D>();
+  auto out_node = visioncpp::terminal<float, COLS, ROWS,
+                                      visioncpp::memory_type::Buffer2D>();
+  auto filter_node =
+      visioncpp::terminal<float, 3, 3, visioncpp::memory_type::Buffer2D,
+                          visioncpp::scope::Constant>(filter_array);
+  auto node = visioncpp::point_operation<visioncpp::OP_CVBGRToRGB>(in_node);
+  auto node2 = visioncpp::point_operation<visioncpp::OP_RGBToGREY>(node);
+  auto node3 = visioncpp::schedule<POLICY, 16, 16, 8, 8>(node2);
+  auto node4 = visioncpp::neighbour_operation<visioncpp::OP_Filter2D_One>(
+      node3, filter_node);
+  auto assign_node = visioncpp::assign(out_node, node4);
+  auto pipeline =
+      visioncpp::make_pipeline<POLICY, 16, 16, 8, 8>(assign_node, q);
+
+  // 2) run the pipeline on consecutive frames
+  size_t pooled = 0;
+  for (int f = 0; f < FRAMES; f++) {
+    size_t frame = (i + f) % common::singleton::DataSet::m_depth;
+    cv::Mat ref;
+    cv::filter2D(common::getGrey(frame), ref, -1, kernel, cv::Point(-1, -1), 0,
+                 cv::BORDER_REPLICATE);
+    auto in = common::singleton::DataSet::Instance().m_data[frame].get();
+    if (f % 2 == 0) {
+      pipeline.run(in, out.data());
+    } else {
+      pipeline.run_async(in).wait();
+      pipeline.read_output(out.data());
+    }
+    // the buffers of the first run are reused by the next ones
+    if (f == 0) {
+      pooled = q.buffer_pool().size();
+    }
+    ASSERT_EQ(pooled, q.buffer_pool().size());
+    // 3) verify
+    verify(ref, out.data(), 1e-5f);
+  }
+}
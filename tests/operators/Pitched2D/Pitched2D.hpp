@@ -0,0 +1,104 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../../include/common.hpp"
+
+template <size_t TERMINAL, size_t POLICY, typename QUEUE, typename DATA>
+void run_test(QUEUE &q, DATA data, int i) {
+  constexpr size_t COLS = common::singleton::DataSet::m_width;
+  constexpr size_t ROWS = common::singleton::DataSet::m_height;
+  // the two side by side sub-images processed in place
+  constexpr size_t SUB_COLS = 64, SUB_ROWS = 96;
+  const int col = 40, row = 30;
+  // custom filter
+  float filter_array[9] = {1.0 / 16.0, 2.0 / 16.0, 1.0 / 16.0,
+                           3.0 / 16.0, 2.0 / 16.0, 1.0 / 16.0,
+                           1.0 / 16.0, 4.0 / 16.0, 1.0 / 16.0};
+  cv::Mat frame = common::getFrame(i).clone();
+  std::vector<float> out(COLS * ROWS, -1.0f);
+  // 1) create gold_standard image of each sub-image, whose borders are the
+  // borders of its terminal
+  cv::Rect left(col, row, SUB_COLS, SUB_ROWS);
+  cv::Rect right(col + SUB_COLS, row, SUB_COLS, SUB_ROWS);
+  cv::Mat ref_left, ref_right;
+  cv::filter2D(common::getGrey(i)(left).clone(), ref_left, -1,
+               cv::Mat(3, 3, CV_32F, filter_array), cv::Point(-1, -1), 0,
+               cv::BORDER_REPLICATE);
+  cv::filter2D(common::getGrey(i)(right).clone(), ref_right, -1,
+               cv::Mat(3, 3, CV_32F, filter_array), cv::Point(-1, -1), 0,
+               cv::BORDER_REPLICATE);
+
+  {
+    // 2) define graph on the sub-images of the frame and of the output. The
+    // rows of each view span the columns of the other one, and both views
+    // are alive until the end of the scope.
+    auto in_left =
+        visioncpp::terminal<visioncpp::pixel::U8C3, SUB_COLS, SUB_ROWS,
+                            visioncpp::memory_type::Pitched2D>(
+            frame.ptr<unsigned char>(row) + col * 3, 1, COLS);
+    auto in_right =
+        visioncpp::terminal<visioncpp::pixel::U8C3, SUB_COLS, SUB_ROWS,
+                            visioncpp::memory_type::Pitched2D>(
+            frame.ptr<unsigned char>(row) + (col + SUB_COLS) * 3, 1, COLS);
+    auto out_left =
+        visioncpp::terminal<float, SUB_COLS, SUB_ROWS,
+                            visioncpp::memory_type::Pitched2D>(
+            &out[row * COLS + col], 1, COLS);
+    auto out_right =
+        visioncpp::terminal<float, SUB_COLS, SUB_ROWS,
+                            visioncpp::memory_type::Pitched2D>(
+            &out[row * COLS + col + SUB_COLS], 1, COLS);
+    auto filter_node =
+        visioncpp::terminal<float, 3, 3, visioncpp::memory_type::Buffer2D,
+                            visioncpp::scope::Constant>(filter_array);
+    auto node = visioncpp::point_operation<visioncpp::OP_CVBGRToRGB>(in_left);
+    auto node2 = visioncpp::point_operation<visioncpp::OP_RGBToGREY>(node);
+    auto node3 = visioncpp::neighbour_operation<visioncpp::OP_Filter2D_One>(
+        node2, filter_node);
+    auto node4 =
+        visioncpp::point_operation<visioncpp::OP_CVBGRToRGB>(in_right);
+    auto node5 = visioncpp::point_operation<visioncpp::OP_RGBToGREY>(node4);
+    auto node6 = visioncpp::neighbour_operation<visioncpp::OP_Filter2D_One>(
+        node5, filter_node);
+    auto assign_left = visioncpp::assign(out_left, node3);
+    auto assign_right = visioncpp::assign(out_right, node6);
+    // 3) execute pipe
+    visioncpp::execute<POLICY, 16, 16, 8, 8>(assign_left, q);
+    visioncpp::execute<POLICY, 16, 16, 8, 8>(assign_right, q);
+    // a pitch smaller than the row is rejected
+    ASSERT_THROW((visioncpp::terminal<float, SUB_COLS, SUB_ROWS,
+                                      visioncpp::memory_type::Pitched2D>(
+                     out.data(), 1, SUB_COLS - 1)),
+                 std::invalid_argument);
+  }
+  // 4) verify each sub-image, and that the rest of the output is untouched
+  cv::Mat result(ROWS, COLS, CV_32F, out.data());
+  cv::Mat tested_left = result(left).clone();
+  cv::Mat tested_right = result(right).clone();
+  verify(ref_left, reinterpret_cast<float *>(tested_left.data), 1e-5f);
+  verify(ref_right, reinterpret_cast<float *>(tested_right.data), 1e-5f);
+  for (size_t r = 0; r < ROWS; r++) {
+    for (size_t c = 0; c < COLS; c++) {
+      if (!left.contains(cv::Point(c, r)) &&
+          !right.contains(cv::Point(c, r))) {
+        ASSERT_EQ(-1.0f, out[r * COLS + c]) << "row: " << r << " col: " << c;
+      }
+    }
+  }
+}
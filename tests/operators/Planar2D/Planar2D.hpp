@@ -0,0 +1,78 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../../include/common.hpp"
+
+template <size_t TERMINAL, size_t POLICY, typename QUEUE, typename DATA>
+void run_test(QUEUE &q, DATA data, int i) {
+  constexpr size_t COLS = common::singleton::DataSet::m_width;
+  constexpr size_t ROWS = common::singleton::DataSet::m_height;
+  // custom filter
+  float filter_array[9] = {1.0 / 16.0, 2.0 / 16.0, 1.0 / 16.0,
+                           3.0 / 16.0, 2.0 / 16.0, 1.0 / 16.0,
+                           1.0 / 16.0, 4.0 / 16.0, 1.0 / 16.0};
+  // 1) store the channels of the frame one plane after the other, in the RGB
+  // order of VisionCpp
+  cv::Mat frame;
+  common::getFrame(i).convertTo(frame, CV_32F, 1.0 / 255.0);
+  cv::cvtColor(frame, frame, cv::COLOR_BGR2RGB);
+  std::vector<cv::Mat> planes;
+  cv::split(frame, planes);
+  std::vector<float> in(COLS * ROWS * 3), out(COLS * ROWS * 3),
+      grey(COLS * ROWS);
+  for (size_t k = 0; k < 3; k++) {
+    std::memcpy(&in[k * COLS * ROWS], planes[k].data,
+                COLS * ROWS * sizeof(float));
+  }
+  // 2) create gold_standard images
+  cv::Mat ref;
+  cv::filter2D(frame, ref, -1, cv::Mat(3, 3, CV_32F, filter_array),
+               cv::Point(-1, -1), 0, cv::BORDER_REPLICATE);
+  std::vector<cv::Mat> ref_planes;
+  cv::split(ref, ref_planes);
+
+  {
+    // 3) define graph
+    auto in_node =
+        visioncpp::terminal<visioncpp::pixel::F32C3, COLS, ROWS,
+                            visioncpp::memory_type::Planar2D>(in.data());
+    auto out_node =
+        visioncpp::terminal<visioncpp::pixel::F32C3, COLS, ROWS,
+                            visioncpp::memory_type::Planar2D>(out.data());
+    auto grey_node =
+        visioncpp::terminal<float, COLS, ROWS,
+                            visioncpp::memory_type::Buffer2D>(grey.data());
+    auto filter_node =
+        visioncpp::terminal<float, 3, 3, visioncpp::memory_type::Buffer2D,
+                            visioncpp::scope::Constant>(filter_array);
+    auto node = visioncpp::neighbour_operation<visioncpp::OP_Filter2D>(
+        in_node, filter_node);
+    auto assign_node = visioncpp::assign(out_node, node);
+    auto node2 = visioncpp::point_operation<visioncpp::OP_RGBToGREY>(in_node);
+    auto assign_grey = visioncpp::assign(grey_node, node2);
+    // 4) execute pipe
+    visioncpp::execute<POLICY, 16, 16, 8, 8>(assign_node, q);
+    visioncpp::execute<POLICY, 16, 16, 8, 8>(assign_grey, q);
+  }
+  // 5) verify each plane
+  for (size_t k = 0; k < 3; k++) {
+    verify(ref_planes[k], &out[k * COLS * ROWS], 1e-5f);
+  }
+  verify(common::getGrey(i), grey.data(), 1e-5f);
+}
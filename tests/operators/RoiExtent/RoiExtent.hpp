@@ -0,0 +1,75 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../../include/common.hpp"
+
+template <size_t TERMINAL, size_t POLICY, typename QUEUE, typename DATA>
+void run_test(QUEUE &q, DATA data, int i) {
+  constexpr size_t COLS = common::singleton::DataSet::m_width;
+  constexpr size_t ROWS = common::singleton::DataSet::m_height;
+  // the region of interest
+  const int col = 37, row = 21, cols = 90, rows = 70;
+  // custom filter
+  float filter_array[9] = {1.0 / 16.0, 2.0 / 16.0, 1.0 / 16.0,
+                           3.0 / 16.0, 2.0 / 16.0, 1.0 / 16.0,
+                           1.0 / 16.0, 4.0 / 16.0, 1.0 / 16.0};
+  cv::Mat kernel(3, 3, CV_32F, filter_array);
+  std::vector<float> out(COLS * ROWS);
+  // 1) create gold_standard image of the whole frame
+  cv::Mat ref = common::getGrey(i);
+  for (int k = 0; k < 3; k++) {
+    cv::filter2D(ref, ref, -1, kernel, cv::Point(-1, -1), 0,
+                 cv::BORDER_REPLICATE);
+  }
+
+  {
+    // 2) define graph: three filters joined by schedule, whose subexpressions
+    // read their halos outside of the region
+    auto out_node =
+        visioncpp::terminal<float, COLS, ROWS,
+                            visioncpp::memory_type::Buffer2D>(out.data());
+    auto filter_node =
+        visioncpp::terminal<float, 3, 3, visioncpp::memory_type::Buffer2D,
+                            visioncpp::scope::Constant>(filter_array);
+    auto node = visioncpp::point_operation<visioncpp::OP_CVBGRToRGB>(data);
+    auto node2 = visioncpp::point_operation<visioncpp::OP_RGBToGREY>(node);
+    auto node3 = visioncpp::neighbour_operation<visioncpp::OP_Filter2D_One>(
+        node2, filter_node);
+    auto node4 = visioncpp::schedule<POLICY, 16, 16, 8, 8>(node3);
+    auto node5 = visioncpp::neighbour_operation<visioncpp::OP_Filter2D_One>(
+        node4, filter_node);
+    auto node6 = visioncpp::schedule<POLICY, 16, 16, 8, 8>(node5);
+    auto node7 = visioncpp::neighbour_operation<visioncpp::OP_Filter2D_One>(
+        node6, filter_node);
+    auto assign_node = visioncpp::assign(out_node, node7);
+
+    // 3) execute pipe on the region only
+    visioncpp::execute_roi<POLICY, 16, 16, 8, 8>(assign_node, q, col, row,
+                                                 cols, rows);
+    // a region crossing the border of the image is rejected
+    ASSERT_THROW((visioncpp::execute_roi<POLICY, 16, 16, 8, 8>(
+                     assign_node, q, COLS - 8, row, 16, rows)),
+                 std::invalid_argument);
+  }
+  // 4) verify the region
+  cv::Mat result(ROWS, COLS, CV_32F, out.data());
+  cv::Mat roi = result(cv::Rect(col, row, cols, rows)).clone();
+  verify(ref(cv::Rect(col, row, cols, rows)).clone(),
+         reinterpret_cast<float *>(roi.data), 1e-5f);
+}
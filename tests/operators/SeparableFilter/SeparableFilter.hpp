@@ -0,0 +1,90 @@
+// This file is part of VisionCpp, a lightweight C++ template library
+// for computer vision and image processing.
+//
+// Copyright (C) 2016 Codeplay Software Limited. All Rights Reserved.
+//
+// Contact: visioncpp@codeplay.com
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../../include/common.hpp"
+
+template <size_t TERMINAL, size_t POLICY, typename QUEUE, typename DATA>
+void run_test(QUEUE &q, DATA data, int i) {
+  constexpr size_t COLS = common::singleton::DataSet::m_width;
+  constexpr size_t ROWS = common::singleton::DataSet::m_height;
+  // custom filters of 5 and 9 taps, with a different filter for the rows
+  float filter5_col[5] = {1.0 / 16.0, 4.0 / 16.0, 6.0 / 16.0, 4.0 / 16.0,
+                          1.0 / 16.0};
+  float filter5_row[5] = {1.0 / 10.0, 2.0 / 10.0, 4.0 / 10.0, 2.0 / 10.0,
+                          1.0 / 10.0};
+  float filter9_col[9] = {1.0 / 25.0, 2.0 / 25.0, 3.0 / 25.0,
+                          4.0 / 25.0, 5.0 / 25.0, 4.0 / 25.0,
+                          3.0 / 25.0, 2.0 / 25.0, 1.0 / 25.0};
+  float filter9_row[9] = {1.0 / 9.0, 1.0 / 9.0, 1.0 / 9.0,
+                          1.0 / 9.0, 1.0 / 9.0, 1.0 / 9.0,
+                          1.0 / 9.0, 1.0 / 9.0, 1.0 / 9.0};
+  std::vector<float> out5(COLS * ROWS), out9(COLS * ROWS);
+  // 1) create gold_standard images
+  cv::Mat ref5, ref9;
+  cv::sepFilter2D(common::getGrey(i), ref5, -1,
+                  cv::Mat(5, 1, CV_32F, filter5_col),
+                  cv::Mat(5, 1, CV_32F, filter5_row), cv::Point(-1, -1), 0,
+                  cv::BORDER_REFLECT_101);
+  cv::sepFilter2D(common::getGrey(i), ref9, -1,
+                  cv::Mat(9, 1, CV_32F, filter9_col),
+                  cv::Mat(9, 1, CV_32F, filter9_row), cv::Point(-1, -1), 0,
+                  cv::BORDER_REPLICATE);
+
+  {
+    // 2) define graph
+    auto out5_node =
+        visioncpp::terminal<float, COLS, ROWS,
+                            visioncpp::memory_type::Buffer2D>(out5.data());
+    auto out9_node =
+        visioncpp::terminal<float, COLS, ROWS,
+                            visioncpp::memory_type::Buffer2D>(out9.data());
+    auto col5_node =
+        visioncpp::terminal<float, 5, 1, visioncpp::memory_type::Buffer2D,
+                            visioncpp::scope::Constant>(filter5_col);
+    auto row5_node =
+        visioncpp::terminal<float, 1, 5, visioncpp::memory_type::Buffer2D,
+                            visioncpp::scope::Constant>(filter5_row);
+    auto col9_node =
+        visioncpp::terminal<float, 9, 1, visioncpp::memory_type::Buffer2D,
+                            visioncpp::scope::Constant>(filter9_col);
+    auto row9_node =
+        visioncpp::terminal<float, 1, 9, visioncpp::memory_type::Buffer2D,
+                            visioncpp::scope::Constant>(filter9_row);
+    auto node = visioncpp::point_operation<visioncpp::OP_CVBGRToRGB>(data);
+    auto node2 = visioncpp::point_operation<visioncpp::OP_RGBToGREY>(node);
+    auto node3 = visioncpp::neighbour_operation<
+        visioncpp::OP_SepFilterCol, visioncpp::border_type::Reflect101>(
+        node2, col5_node);
+    auto node4 = visioncpp::neighbour_operation<
+        visioncpp::OP_SepFilterRow, visioncpp::border_type::Reflect101>(
+        node3, row5_node);
+    auto assign5 = visioncpp::assign(out5_node, node4);
+    auto node5 = visioncpp::neighbour_operation<visioncpp::OP_SepFilterCol>(
+        node2, col9_node);
+    auto node6 = visioncpp::neighbour_operation<visioncpp::OP_SepFilterRow>(
+        node5, row9_node);
+    auto assign9 = visioncpp::assign(out9_node, node6);
+    // 3) execute pipe
+    visioncpp::execute<POLICY, 16, 16, 8, 8>(assign5, q);
+    visioncpp::execute<POLICY, 16, 16, 8, 8>(assign9, q);
+  }
+  // 4) verify
+  verify(ref5, out5.data(), 1e-5f);
+  verify(ref9, out9.data(), 1e-5f);
+}
@@ -36,33 +36,35 @@ def main():
     # read it
     templatesrc = Template( templatein.read() )
 
-    # define targets
-    targets = [ "cpu", "gpu" ]
+    # define backends and the targets supported by each of them
+    backends = [ ( "sycl", [ "cpu", "gpu" ] ), ( "threads", [ "cpu" ] ) ]
     storages = [ "Buffer2D" ]
-    executions = [ "Fuse", "NoFuse" ]
+    executions = [ "Fuse", "NoFuse", "Auto" ]
 
     # walk through each folder
     for root, dirs, files in os.walk(".", topdown=False):
       # for each folder
       for name in dirs:
-        # for each target
-        for target in targets:
-          # for each storage
-          for storage in storages:
-            # for each execution policy
-            for execution in executions:
-                d={ 'test_name':name, 'test_target':target,
-                'test_storage': storage, 'test_execution':execution,
-                'test_dir' : args.testdir[0] }
-                # replace
-                result = templatesrc.substitute(d)
-                s = [args.builddir[0],'autogen/'+ name +'/'+ name.upper()+'_'+storage.upper()+'_'+ target.upper() +'_'+execution.upper()+'.cpp']
-                path = os.path.join('',*s)
-                print(path)
-                os.makedirs(os.path.dirname(path), exist_ok=True)
-                # write file
-                with open(path, 'w') as file_:
-                  file_.write(autogenwarning + result)
+        # for each backend
+        for backend, targets in backends:
+          # for each target
+          for target in targets:
+            # for each storage
+            for storage in storages:
+              # for each execution policy
+              for execution in executions:
+                  d={ 'test_name':name, 'test_backend':backend,
+                  'test_target':target, 'test_storage': storage,
+                  'test_execution':execution, 'test_dir' : args.testdir[0] }
+                  # replace
+                  result = templatesrc.substitute(d)
+                  s = [args.builddir[0],'autogen/'+ name +'/'+ name.upper()+'_'+storage.upper()+'_'+ backend.upper() +'_'+ target.upper() +'_'+execution.upper()+'.cpp']
+                  path = os.path.join('',*s)
+                  print(path)
+                  os.makedirs(os.path.dirname(path), exist_ok=True)
+                  # write file
+                  with open(path, 'w') as file_:
+                    file_.write(autogenwarning + result)
 
 if __name__ == '__main__':
   sys.exit(main())